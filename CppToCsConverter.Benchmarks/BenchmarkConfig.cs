@@ -0,0 +1,59 @@
+using System.Linq;
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace CppToCsConverter.Benchmarks
+{
+    /// <summary>
+    /// Reports allocated bytes and input lines per second for every benchmark
+    /// </summary>
+    public class BenchmarkConfig : ManualConfig
+    {
+        public BenchmarkConfig()
+        {
+            AddDiagnoser(MemoryDiagnoser.Default);
+            AddColumn(new LinesPerSecondColumn());
+        }
+    }
+
+    /// <summary>
+    /// Throughput in input lines per second, from the mean time and the line counts of the corpus in the "Files" parameter
+    /// </summary>
+    public class LinesPerSecondColumn : IColumn
+    {
+        public string Id => nameof(LinesPerSecondColumn);
+        public string ColumnName => "Lines/s";
+        public bool AlwaysShow => true;
+        public ColumnCategory Category => ColumnCategory.Custom;
+        public int PriorityInCategory => 0;
+        public bool IsNumeric => true;
+        public UnitType UnitType => UnitType.Dimensionless;
+        public string Legend => "Input lines processed per second";
+
+        public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase) => false;
+
+        public bool IsAvailable(Summary summary) => true;
+
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase) => GetValue(summary, benchmarkCase, SummaryStyle.Default);
+
+        public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+        {
+            var meanNanoseconds = summary[benchmarkCase]?.ResultStatistics?.Mean;
+            if (meanNanoseconds == null || meanNanoseconds <= 0 || benchmarkCase.Parameters["Files"] is not int fileCount)
+                return "-";
+
+            var corpus = CorpusInfo.Load(BenchmarkCorpus.GetDirectory(fileCount));
+            if (corpus == null)
+                return "-";
+
+            var categories = benchmarkCase.Descriptor.Categories;
+            var lines = categories.Contains(BenchmarkCorpus.HeaderCategory) ? corpus.HeaderLines
+                : categories.Contains(BenchmarkCorpus.SourceCategory) ? corpus.SourceLines
+                : corpus.TotalLines;
+            return (lines / (meanNanoseconds.Value / 1e9)).ToString("N0");
+        }
+    }
+}
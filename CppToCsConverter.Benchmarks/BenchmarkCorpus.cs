@@ -0,0 +1,46 @@
+using System;
+using System.IO;
+using System.Linq;
+
+namespace CppToCsConverter.Benchmarks
+{
+    /// <summary>
+    /// Generated corpora shared by the benchmarks, cached in the temp directory per size
+    /// </summary>
+    public static class BenchmarkCorpus
+    {
+        // Average file size of the corpus; 10,000 files give 2,000,000 lines
+        public const int LinesPerFile = 200;
+
+        // Categories telling the throughput column which lines a benchmark processes; other benchmarks process the whole corpus
+        public const string HeaderCategory = "Headers";
+        public const string SourceCategory = "Sources";
+
+        public static string GetDirectory(int fileCount)
+        {
+            return Path.Combine(Path.GetTempPath(), "CppToCsConverter.Benchmarks", $"corpus-{fileCount}-{(long)fileCount * LinesPerFile}");
+        }
+
+        public static CorpusInfo Ensure(int fileCount)
+        {
+            return CorpusGenerator.EnsureCorpus(GetDirectory(fileCount), fileCount, (long)fileCount * LinesPerFile);
+        }
+
+        public static string[] GetHeaderFiles(int fileCount)
+        {
+            return GetFiles(fileCount, "*.h");
+        }
+
+        public static string[] GetSourceFiles(int fileCount)
+        {
+            return GetFiles(fileCount, "*.cpp");
+        }
+
+        private static string[] GetFiles(int fileCount, string pattern)
+        {
+            var files = Directory.GetFiles(GetDirectory(fileCount), pattern);
+            Array.Sort(files, StringComparer.Ordinal);
+            return files;
+        }
+    }
+}
@@ -0,0 +1,534 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+using System.Text.Json;
+
+namespace CppToCsConverter.Benchmarks
+{
+    /// <summary>
+    /// Line counts of a generated corpus, stored next to it as corpus.json
+    /// </summary>
+    public class CorpusInfo
+    {
+        public const string InfoFileName = "corpus.json";
+
+        public int HeaderFiles { get; set; }
+        public int SourceFiles { get; set; }
+        public long HeaderLines { get; set; }
+        public long SourceLines { get; set; }
+        public int MethodsPerClass { get; set; }
+
+        public long TotalLines => HeaderLines + SourceLines;
+
+        public static CorpusInfo? Load(string directory)
+        {
+            var path = Path.Combine(directory, InfoFileName);
+            return File.Exists(path) ? JsonSerializer.Deserialize<CorpusInfo>(File.ReadAllText(path)) : null;
+        }
+
+        public void Save(string directory)
+        {
+            File.WriteAllText(Path.Combine(directory, InfoFileName), JsonSerializer.Serialize(this));
+        }
+    }
+
+    /// <summary>
+    /// Generates a large C++ corpus from the patterns in SamplesAndExpectations. Every set of eight files holds
+    /// a public interface (ISample), a class with defines, structs, comments, regions, overloads and local
+    /// structs/methods (CSample), a partial class implemented across three .cpp files (CPartialSample) and a
+    /// class with only static members (CStaticClass). The classes get extra methods until the line target is met.
+    /// Output is deterministic for the same file and line counts.
+    /// </summary>
+    public static class CorpusGenerator
+    {
+        public const int FilesPerSet = 8;
+
+        /// <summary>
+        /// Returns the corpus in a directory, generating it if the directory does not hold one of the requested size
+        /// </summary>
+        public static CorpusInfo EnsureCorpus(string directory, int fileCount, long lineCount)
+        {
+            var existing = CorpusInfo.Load(directory);
+            var setCount = GetSetCount(fileCount);
+            if (existing != null && existing.HeaderFiles + existing.SourceFiles == setCount * FilesPerSet &&
+                existing.MethodsPerClass == GetMethodsPerClass(setCount, lineCount))
+            {
+                return existing;
+            }
+
+            if (Directory.Exists(directory))
+                Directory.Delete(directory, true);
+            return Generate(directory, fileCount, lineCount);
+        }
+
+        /// <summary>
+        /// Writes about <paramref name="fileCount"/> files (rounded up to whole sets) with about <paramref name="lineCount"/> lines in total
+        /// </summary>
+        public static CorpusInfo Generate(string directory, int fileCount, long lineCount)
+        {
+            Directory.CreateDirectory(directory);
+            var setCount = GetSetCount(fileCount);
+            var info = new CorpusInfo { MethodsPerClass = GetMethodsPerClass(setCount, lineCount) };
+
+            for (int set = 0; set < setCount; set++)
+            {
+                foreach (var (fileName, content) in CreateSet(set, info.MethodsPerClass))
+                {
+                    File.WriteAllText(Path.Combine(directory, fileName), content);
+                    var lines = CountLines(content);
+                    if (fileName.EndsWith(".h", StringComparison.Ordinal))
+                    {
+                        info.HeaderFiles++;
+                        info.HeaderLines += lines;
+                    }
+                    else
+                    {
+                        info.SourceFiles++;
+                        info.SourceLines += lines;
+                    }
+                }
+            }
+
+            info.Save(directory);
+            return info;
+        }
+
+        private static int GetSetCount(int fileCount)
+        {
+            return Math.Max(1, (fileCount + FilesPerSet - 1) / FilesPerSet);
+        }
+
+        private static int GetMethodsPerClass(int setCount, long lineCount)
+        {
+            // Set size grows linearly with the number of extra methods
+            const int SampleMethods = 16;
+            var baseLines = CreateSet(0, 0).Sum(file => CountLines(file.Content));
+            var linesPerMethod = (CreateSet(0, SampleMethods).Sum(file => CountLines(file.Content)) - baseLines) / (double)SampleMethods;
+            var targetPerSet = (double)lineCount / setCount;
+            return (int)Math.Max(0, Math.Round((targetPerSet - baseLines) / linesPerMethod));
+        }
+
+        private static long CountLines(string content)
+        {
+            return content.Count(c => c == '\n');
+        }
+
+        private static IEnumerable<(string FileName, string Content)> CreateSet(int set, int methods)
+        {
+            var suffix = set.ToString("D5");
+            yield return ($"ISample{suffix}.h", CreateInterfaceHeader(suffix));
+            yield return ($"CSample{suffix}.h", CreateSampleHeader(suffix, methods));
+            yield return ($"CSample{suffix}.cpp", CreateSampleSource(suffix, methods));
+            yield return ($"CPartialSample{suffix}.h", CreatePartialHeader(suffix, methods));
+            yield return ($"CPartialSample{suffix}.cpp", CreatePartialSource(suffix, methods));
+            yield return ($"CPartialSample{suffix}Methods.cpp", CreatePartialMethodsSource(suffix, methods));
+            yield return ($"CStaticClass{suffix}.h", CreateStaticHeader(suffix, methods));
+            yield return ($"CStaticClass{suffix}.cpp", CreateStaticSource(suffix, methods));
+        }
+
+        private static string CreateInterfaceHeader(string suffix)
+        {
+            return $@"#pragma once
+
+// Some define
+#define IN_INTERFACE_DEF{suffix}_01 1
+#define IN_INTERFACE_DEF{suffix}_02 2 // Another define
+
+/* My struct */
+typedef struct
+{{
+    bool MyBoolField;
+    agrint MyIntField;
+}} MyStruct{suffix};
+
+/* The Interface */
+class __declspec(dllexport) ISample{suffix}
+{{
+public:
+    virtual ~ISample{suffix}(){{}};
+    static ISample{suffix}* GetInstance();
+
+    virtual void MethodOne(const CString& cParam1,
+                           const bool &bParam2,
+                           CString *pcParam3) = 0;
+
+    virtual bool MethodTwo() = 0;
+}};
+";
+        }
+
+        private static string CreateSampleHeader(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"#pragma once
+
+#include ""ISample{suffix}.h""
+
+// Top defines
+#define MY_DEFINE{suffix} 1
+// Comment for define 2
+#define MY_DEFINE{suffix}_2 2
+
+struct StructOne{suffix}
+{{
+protected:
+    agrint lTestType;
+
+#pragma region Just a h-file pragma test
+public:
+
+    // att-id member comment
+    TAttId attId;
+    TDimValue dimVal;
+#pragma endregion // Comment test
+}};
+
+// Comment for class
+class CSample{suffix} : public ISample{suffix}
+{{
+private:
+    agrint m_value1;
+
+    CString cValue1;
+    CString cValue2; // Second value
+    CAgrMT* m_pmtReport; //Res/Rate-Reporting
+
+    // Static member
+    static agrint m_iIndex;
+
+    CString PrivateMemberWithBodyInHfile(const TAttId &att_id)
+    {{
+        if (cValue1.IsEmpty()) return _T("""");
+
+        return cValue1;
+    }}
+
+    void TrickyToMatch(const CString& cResTab,
+        const bool& bGetAgeAndTaxNumberFromResTab, /* agrint &oldParameter,*/ CAgrMT* pmtTable);
+
+public:
+    CSample{suffix}();
+    ~CSample{suffix}();
+
+    void MethodOne(const CString& cParam1,
+                   const bool &bParam2,
+                   CString *pcParam3);
+
+    // Method with body in header file
+    bool MethodTwo() {{ return cValue1 == cValue2; }}
+
+private:
+    // Comment from .h
+    bool MethodP1(const TDimValue& dim1, const agrint& int1, const agrint& int2=0, bool bool1=false);
+    bool MethodWithOverloads(const TDimValue& dim1);
+    bool MethodWithOverloads(const TDimValue& dim1, const agrint& int1);
+");
+            for (int i = 0; i < methods; i++)
+            {
+                builder.Append($@"
+    // Generated method {i}
+    bool GeneratedMethod{i}(const TDimValue& dim1, const agrint& int1, const CString& cText = _T(""{i}""));
+");
+            }
+            builder.Append(@"
+    int m_iAnotherPrivateInteger;
+};
+");
+            return builder.ToString();
+        }
+
+        private static string CreateSampleSource(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"/* Top comment for CSample{suffix} file
+ * We expect this comment on the top of the generated file before the using statements.
+ */
+#include ""StdAfx.h""
+#include ""CSample{suffix}.h""
+
+/* DEFINES IN CPP*/
+#define CPP_DEFINE{suffix} 10
+// Comment for cpp define 2
+#define CPP_DEFINE{suffix}_2 20
+
+// Demo of non-class methods
+bool LocalFunction{suffix}(const agrint& valueIn /* value in */)
+{{
+    struct LocalStruct
+    {{
+        agrint lValue;
+    }};
+
+    return valueIn > 0 && valueIn < 100;
+}}
+
+ISample{suffix}* ISample{suffix}::GetInstance()
+{{
+    CSample{suffix}* pSample = new CSample{suffix}();
+    return pSample;
+}};
+
+agrint CSample{suffix}::m_iIndex = -1;
+
+#pragma region Construction
+CSample{suffix}::CSample{suffix}()
+{{
+    m_value1 = 0;
+
+    cValue1 = _T(""ABC"");
+    cValue2 = _T(""DEF"");
+}};
+
+CSample{suffix}::~CSample{suffix}()
+{{
+    // Cleanup code here
+}};
+#pragma endregion
+
+void CSample{suffix}::MethodOne(const CString& cParam1,
+                   const bool &bParam2,
+                   CString *pcParam3)
+{{
+    // Implementation of MethodOne
+}}
+
+// Comment from .cpp
+bool CSample{suffix}::MethodP1(const TDimValue& dimPd, const agrint& lLimitHorizon, const agrint& iValue, bool bError)
+{{
+    if (dimPd.IsEmpty())
+        return bError;
+
+    return lLimitHorizon >= iValue;
+}}
+
+bool CSample{suffix}::MethodWithOverloads(const TDimValue& dim1)
+{{
+    // Implementation of the first overload
+    return !dim1.IsEmpty();
+}}
+
+bool CSample{suffix}::MethodWithOverloads(const TDimValue& dim1, const agrint& int1)
+{{
+    // Implementation of the second overload
+    return !dim1.IsEmpty() && int1 > 0;
+}}
+
+ void  CSample{suffix}::TrickyToMatch(
+    /* IN*/const CString& cResTab,
+    /* IN */ const bool& bGetAgeAndTaxNumberFromResTab,
+    /* OUT */ CAgrMT* pmtTable
+) {{
+    // Implementation of TrickyToMatch
+    if (cResTab.IsEmpty() || pmtTable == NULL) {{
+        return;
+    }}
+}}
+");
+            for (int i = 0; i < methods; i++)
+            {
+                builder.Append($@"
+/*
+** Generated method {i}
+*/
+bool CSample{suffix}::GeneratedMethod{i}(const TDimValue& dim1, const agrint& int1, const CString& cText)
+{{
+    if (dim1.IsEmpty() || cText.IsEmpty())
+    {{
+        return false;
+    }}
+
+    return int1 > {i};
+}}
+");
+            }
+            return builder.ToString();
+        }
+
+        private static string CreatePartialHeader(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"#pragma once
+
+#include ""ISample{suffix}.h""
+
+// This should go into CPartialSample{suffix}.cs
+struct PartialStruct{suffix}
+{{
+    agrint lTestType;
+
+    // att-id member comment
+    TAttId attId;
+    TDimValue dimVal;
+}};
+
+// Comment for class
+class CPartialSample{suffix}
+{{
+private:
+    agrint m_value1;
+
+    // Static member
+    static agrint m_iIndex;
+
+protected:
+    bool GetRelValue(const agrint& lIdRes, const TAttId& attRelId, const TDimValue& dimPostId, const CString& cTransDateFrom, const CString& cTransDateTo,
+        TDimValue& dimRelValue, CString& cValidFrom, CString& cValidTo);
+
+public:
+    CPartialSample{suffix}();
+    ~CPartialSample{suffix}();
+
+    void MethodOneInPartial(const CString& cParam1,
+                   const bool &bParam2,
+                   CString *pcParam3);
+
+    agrint GetRate(CAgrMT* pmtTrans, double& dValue, const TDimValue& dimValueId, CString& cTransDateFrom, CString& cTransDateTo, const CString& cDateLimit, const double& dPostFlag);
+");
+            for (int i = 0; i < methods; i++)
+            {
+                builder.Append($@"    void PartialMethod{i}(const CString& cParam1, agrint* plResult);
+");
+            }
+            builder.Append(@"};
+");
+            return builder.ToString();
+        }
+
+        private static string CreatePartialSource(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"/* Top comment for CPartialSample{suffix} file
+ */
+#include ""StdAfx.h""
+#include ""CPartialSample{suffix}.h""
+
+agrint CPartialSample{suffix}::m_iIndex = 0;
+
+CPartialSample{suffix}::CPartialSample{suffix}()
+{{
+    m_value1 = 0;
+}}
+
+CPartialSample{suffix}::~CPartialSample{suffix}()
+{{
+}}
+
+bool CPartialSample{suffix}::GetRelValue(const agrint& lIdRes, const TAttId& attRelId, const TDimValue& dimPostId, const CString& cTransDateFrom, const CString& cTransDateTo,
+        TDimValue& dimRelValue, CString& cValidFrom, CString& cValidTo)
+{{
+    // Implementation of GetRelValue
+    return lIdRes > 0;
+}}
+");
+            for (int i = 0; i < methods; i += 2)
+            {
+                AppendPartialMethod(builder, suffix, i);
+            }
+            return builder.ToString();
+        }
+
+        private static string CreatePartialMethodsSource(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"/* Top comment for CPartialSample{suffix}Methods file
+ */
+#include ""StdAfx.h""
+#include ""CPartialSample{suffix}.h""
+
+// This is a method comment and is associated to MethodOneInPartial
+void CPartialSample{suffix}::MethodOneInPartial(const CString& cParam1,
+                   const bool &bParam2,
+                   CString *pcParam3)
+{{
+    struct DistrStruct
+    {{
+    public:
+        TAttId attId;
+        TDimValue dimVal;
+        DistrStruct(){{;}};
+    }};
+
+    DistrStruct as[7];
+    // Implementation of MethodOneInPartial
+}}
+
+// Demo of non-class methods in partial implementation
+bool LocalFunction{suffix}_2(const agrint& valueIn /* value in */)
+{{
+    return valueIn > 0 && valueIn < 100;
+}}
+
+/*
+**  Find the appropriate value (dValue) for the current transaction.
+*/
+agrint CPartialSample{suffix}::GetRate (
+                 CAgrMT *pmtTrans, /*IN/OUT: Memory table with open cursor */
+                 double &dValue, /*OUT: Return value (rate) */
+                 const TDimValue &dimValueId, /*IN: Value reference to retrieve value for */
+                 CString &cTransDateFrom, /*IN/OUT: Date interval to retrieve rate for */
+                 CString &cTransDateTo,   /*IN/OUT: ---''--- */
+                 const CString &cDateLimit, /*IN: Set = ""N"" to avoid any split */
+                 const double &dPostFlag) /*IN: Set = 1 to look for rate according to position */
+{{
+    TDimValue dimValueRate(_T(""""));
+    return 0;
+}}
+");
+            for (int i = 1; i < methods; i += 2)
+            {
+                AppendPartialMethod(builder, suffix, i);
+            }
+            return builder.ToString();
+        }
+
+        private static void AppendPartialMethod(StringBuilder builder, string suffix, int index)
+        {
+            builder.Append($@"
+// Partial method {index}
+void CPartialSample{suffix}::PartialMethod{index}(const CString& cParam1, agrint* plResult)
+{{
+    *plResult = cParam1.GetLength() + {index};
+}}
+");
+        }
+
+        private static string CreateStaticHeader(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"#pragma once
+
+class CStaticClass{suffix}
+{{
+public:
+    static const CString ColFrom[4];
+    static const CString ColTo[4];
+");
+            for (int i = 0; i < methods; i += 4)
+            {
+                builder.Append($@"    static const agrint Limit{i};
+");
+            }
+            builder.Append(@"};
+");
+            return builder.ToString();
+        }
+
+        private static string CreateStaticSource(string suffix, int methods)
+        {
+            var builder = new StringBuilder();
+            builder.Append($@"#include ""StdAfx.h""
+
+const CString CStaticClass{suffix}::ColFrom[] = {{ _T(""from_1""), _T(""from_2""), _T(""from_3""), _T(""from_4"") }};
+const CString CStaticClass{suffix}::ColTo[] = {{ _T(""to_1""), _T(""to_2""), _T(""to_3""), _T(""to_4"") }};
+");
+            for (int i = 0; i < methods; i += 4)
+            {
+                builder.Append($@"const agrint CStaticClass{suffix}::Limit{i} = {i};
+");
+            }
+            return builder.ToString();
+        }
+    }
+}
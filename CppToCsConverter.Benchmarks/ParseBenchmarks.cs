@@ -0,0 +1,185 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using BenchmarkDotNet.Attributes;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Logging;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+using CppToCsConverter.Core.Parsers.ParameterParsing;
+
+namespace CppToCsConverter.Benchmarks
+{
+    /// <summary>
+    /// Parse stage: every header and source file of the corpus, one file at a time
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class ParseBenchmarks
+    {
+        private readonly CppHeaderParser _headerParser = new CppHeaderParser();
+        private CppSourceParser _sourceParser = null!;
+        private string[] _headerFiles = Array.Empty<string>();
+        private string[] _sourceFiles = Array.Empty<string>();
+
+        [Params(1_000, 10_000)]
+        public int Files { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            BenchmarkCorpus.Ensure(Files);
+            _headerFiles = BenchmarkCorpus.GetHeaderFiles(Files);
+            _sourceFiles = BenchmarkCorpus.GetSourceFiles(Files);
+            _sourceParser = new CppSourceParser(null, _headerParser);
+        }
+
+        [Benchmark]
+        [BenchmarkCategory(BenchmarkCorpus.HeaderCategory)]
+        public int ParseHeaderFile()
+        {
+            int classes = 0;
+            foreach (var file in _headerFiles)
+            {
+                classes += _headerParser.ParseHeaderFile(file).Count;
+            }
+            return classes;
+        }
+
+        [Benchmark]
+        [BenchmarkCategory(BenchmarkCorpus.SourceCategory)]
+        public int ParseSourceFileComplete()
+        {
+            int methods = 0;
+            foreach (var file in _sourceFiles)
+            {
+                methods += _sourceParser.ParseSourceFileComplete(file).Methods.Count;
+            }
+            return methods;
+        }
+    }
+
+    /// <summary>
+    /// Loading the parse results of every header and source file from a warm parse cache, for comparison with <see cref="ParseBenchmarks"/>.
+    /// Includes hashing each input, which is how the cache finds its entry.
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class ParsedModelCacheBenchmarks
+    {
+        private ParsedModelCache _cache = null!;
+        private string[] _headerFiles = Array.Empty<string>();
+        private string[] _sourceFiles = Array.Empty<string>();
+
+        [Params(1_000, 10_000)]
+        public int Files { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            BenchmarkCorpus.Ensure(Files);
+            _headerFiles = BenchmarkCorpus.GetHeaderFiles(Files);
+            _sourceFiles = BenchmarkCorpus.GetSourceFiles(Files);
+
+            // Fill the cache with one conversion; entries of a previous build of the converter are replaced
+            var cacheDirectory = BenchmarkCorpus.GetDirectory(Files) + "-cache";
+            var converter = new CppToCsStructuralConverter(new ConsoleLogger(LogVerbosity.Quiet)) { ParseCacheDirectory = cacheDirectory };
+            converter.ConvertDirectory(BenchmarkCorpus.GetDirectory(Files), BenchmarkCorpus.GetDirectory(Files) + "-output");
+            _cache = new ParsedModelCache(cacheDirectory, new ConsoleLogger(LogVerbosity.Quiet));
+        }
+
+        [Benchmark]
+        [BenchmarkCategory(BenchmarkCorpus.HeaderCategory)]
+        public int LoadHeader()
+        {
+            int classes = 0;
+            foreach (var file in _headerFiles)
+            {
+                classes += _cache.LoadHeader(file)!.Count;
+            }
+            return classes;
+        }
+
+        [Benchmark]
+        [BenchmarkCategory(BenchmarkCorpus.SourceCategory)]
+        public int LoadSource()
+        {
+            int methods = 0;
+            foreach (var file in _sourceFiles)
+            {
+                methods += _cache.LoadSource(file)!.Methods.Count;
+            }
+            return methods;
+        }
+    }
+
+    /// <summary>
+    /// Parameter parsing: every parenthesized list in the corpus, split into parameter blocks, and parsed
+    /// into parameters by a new parser whose cache fills as the lists repeat
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class ParameterSplitterBenchmarks
+    {
+        private readonly ParameterBlockSplitter _splitter = new ParameterBlockSplitter();
+        private readonly List<string> _parameterLists = new List<string>();
+
+        [Params(1_000, 10_000)]
+        public int Files { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            BenchmarkCorpus.Ensure(Files);
+            var lexer = new CppLexer();
+            foreach (var file in BenchmarkCorpus.GetHeaderFiles(Files).Concat(BenchmarkCorpus.GetSourceFiles(Files)))
+            {
+                AddParameterLists(lexer.Tokenize(File.ReadAllText(file)));
+            }
+        }
+
+        [Benchmark]
+        public int SplitIntoBlocks()
+        {
+            int blocks = 0;
+            foreach (var parameterList in _parameterLists)
+            {
+                blocks += _splitter.SplitIntoBlocks(parameterList).Count;
+            }
+            return blocks;
+        }
+
+        [Benchmark]
+        public int ParseParameters()
+        {
+            var parser = new CppParameterParser();
+            int parameters = 0;
+            foreach (var parameterList in _parameterLists)
+            {
+                parameters += parser.ParseParameters(parameterList).Count;
+            }
+            return parameters;
+        }
+
+        private void AddParameterLists(CppTokenStream tokens)
+        {
+            for (int i = 1; i < tokens.Count; i++)
+            {
+                if (!tokens.IsPunctuation(i, '(') || tokens[i - 1].Kind != CppTokenKind.Identifier)
+                    continue;
+
+                int depth = 0;
+                for (int j = i; j < tokens.Count; j++)
+                {
+                    if (tokens.IsPunctuation(j, '('))
+                    {
+                        depth++;
+                    }
+                    else if (tokens.IsPunctuation(j, ')') && --depth == 0)
+                    {
+                        _parameterLists.Add(tokens.Text.Substring(tokens[i].End, tokens[j].Start - tokens[i].End));
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
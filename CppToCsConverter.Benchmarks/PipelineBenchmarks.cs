@@ -0,0 +1,102 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading.Tasks;
+using BenchmarkDotNet.Attributes;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Logging;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Benchmarks
+{
+    /// <summary>
+    /// Parse, link and generate stages on the corpus. Linking and generation update the parsed classes,
+    /// so their iterations start from a fresh parse done in the (unmeasured) iteration setup.
+    /// </summary>
+    [Config(typeof(BenchmarkConfig))]
+    public class PipelineBenchmarks
+    {
+        private readonly CppToCsStructuralConverter _converter = new CppToCsStructuralConverter(new ConsoleLogger(LogVerbosity.Quiet));
+        private string[] _headerFiles = Array.Empty<string>();
+        private string[] _sourceFiles = Array.Empty<string>();
+        private string _outputDirectory = string.Empty;
+        private List<CppClass>[] _parsedHeaderFiles = Array.Empty<List<CppClass>>();
+        private CppSourceFile?[] _parsedSourceFiles = Array.Empty<CppSourceFile?>();
+        private ConversionModel? _model;
+
+        [Params(1_000, 10_000)]
+        public int Files { get; set; }
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            BenchmarkCorpus.Ensure(Files);
+            _headerFiles = BenchmarkCorpus.GetHeaderFiles(Files);
+            _sourceFiles = BenchmarkCorpus.GetSourceFiles(Files);
+            _outputDirectory = BenchmarkCorpus.GetDirectory(Files) + "-output";
+        }
+
+        [IterationSetup(Target = nameof(LinkParsedFiles))]
+        public void ParseCorpus()
+        {
+            (_parsedHeaderFiles, _parsedSourceFiles) = _converter.ParseFiles(_headerFiles, _sourceFiles, new FileContentStore(), Environment.ProcessorCount);
+        }
+
+        [IterationSetup(Targets = new[] { nameof(GenerateAndWriteFiles), nameof(GenerateFiles) })]
+        public void ParseAndLinkCorpus()
+        {
+            ParseCorpus();
+            _model = _converter.LinkParsedFiles(_headerFiles, _parsedHeaderFiles, _sourceFiles, _parsedSourceFiles);
+
+            // Start from an empty output directory so every file is written
+            if (Directory.Exists(_outputDirectory))
+                Directory.Delete(_outputDirectory, true);
+            Directory.CreateDirectory(_outputDirectory);
+        }
+
+        /// <summary>
+        /// The parse stage as a conversion runs it. The allocated bytes are the parse garbage plus the parsed model,
+        /// which a conversion keeps in memory through linking and generation.
+        /// </summary>
+        [Benchmark]
+        public int ParseFiles()
+        {
+            (_parsedHeaderFiles, _parsedSourceFiles) = _converter.ParseFiles(_headerFiles, _sourceFiles, new FileContentStore(), Environment.ProcessorCount);
+            return _parsedHeaderFiles.Length + _parsedSourceFiles.Length;
+        }
+
+        [Benchmark]
+        public int LinkParsedFiles()
+        {
+            return _converter.LinkParsedFiles(_headerFiles, _parsedHeaderFiles, _sourceFiles, _parsedSourceFiles).HeaderFileClasses.Count;
+        }
+
+        [Benchmark]
+        public int GenerateAndWriteFiles()
+        {
+            var writtenFiles = _converter.GenerateAndWriteFilesAsync(_model!, _outputDirectory, BenchmarkCorpus.GetDirectory(Files), new OutputFileWriter(), 1)
+                .GetAwaiter().GetResult();
+            return writtenFiles.Count;
+        }
+
+        /// <summary>
+        /// Generation as consumed by an in-memory conversion, for comparison with writing to disk
+        /// </summary>
+        [Benchmark]
+        public int GenerateFiles()
+        {
+            return GenerateFilesAsync().GetAwaiter().GetResult();
+        }
+
+        private async Task<int> GenerateFilesAsync()
+        {
+            int count = 0;
+            await foreach (var (_, files) in _converter.GenerateFilesAsync(_model!, string.Empty, BenchmarkCorpus.GetDirectory(Files), 1))
+            {
+                count += files.Count;
+            }
+            return count;
+        }
+    }
+}
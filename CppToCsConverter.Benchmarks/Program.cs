@@ -0,0 +1,33 @@
+using System;
+using BenchmarkDotNet.Running;
+
+namespace CppToCsConverter.Benchmarks
+{
+    class Program
+    {
+        static void Main(string[] args)
+        {
+            if (args.Length > 0 && args[0] == "--generate-corpus")
+            {
+                GenerateCorpus(args);
+                return;
+            }
+
+            BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+        }
+
+        private static void GenerateCorpus(string[] args)
+        {
+            if (args.Length < 2)
+            {
+                Console.WriteLine("Usage: CppToCsConverter.Benchmarks --generate-corpus <output_directory> [file_count] [line_count]");
+                return;
+            }
+
+            var fileCount = args.Length > 2 ? int.Parse(args[2]) : 10_000;
+            var lineCount = args.Length > 3 ? long.Parse(args[3]) : (long)fileCount * BenchmarkCorpus.LinesPerFile;
+            var corpus = CorpusGenerator.Generate(args[1], fileCount, lineCount);
+            Console.WriteLine($"Generated {corpus.HeaderFiles} header files ({corpus.HeaderLines:N0} lines) and {corpus.SourceFiles} source files ({corpus.SourceLines:N0} lines) in {args[1]}");
+        }
+    }
+}
@@ -0,0 +1,153 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Security.Cryptography;
+using System.Text;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Logging;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Runs many conversion jobs in one process, several at a time. Jobs share the process-wide compiled
+    /// regular expressions and jitted code, so only the first job pays for warming them up.
+    /// Each job gets its own converter, since a converter keeps the state of its current run.
+    /// A failing job is reported in its result and does not stop the others.
+    /// </summary>
+    public class ConversionBatch
+    {
+        private readonly ILogger _logger;
+
+        /// <param name="logger">Receives the output of all jobs, each message prefixed with the job's name; defaults to the console</param>
+        public ConversionBatch(ILogger? logger = null)
+        {
+            _logger = logger ?? new ConsoleLogger();
+        }
+
+        /// <summary>
+        /// Maximum number of jobs converted at the same time. Values below 1 are treated as 1.
+        /// </summary>
+        public int MaxConcurrentJobs { get; set; } = Environment.ProcessorCount;
+
+        /// <summary>
+        /// Maximum number of files parsed or generated concurrently across the jobs running at the same time.
+        /// Each running job gets an equal share of at least 1.
+        /// </summary>
+        public int MaxDegreeOfParallelism { get; set; } = Environment.ProcessorCount;
+
+        public bool Incremental { get; set; }
+
+        /// <summary>
+        /// Root directory for parse caches, or null for none. Every job gets its own subdirectory, so that
+        /// removing the stale entries of one job never touches the entries of another.
+        /// </summary>
+        public string? ParseCacheDirectory { get; set; }
+
+        /// <summary>
+        /// Approximate memory budget in bytes for all jobs running at the same time, or null for none.
+        /// Each job gets an equal share; see <see cref="CppToCsStructuralConverter.MemoryBudgetBytes"/>.
+        /// </summary>
+        public long? MemoryBudgetBytes { get; set; }
+
+        /// <summary>
+        /// Whether jobs with a file list also parse the inputs these files need; see <see cref="CppToCsStructuralConverter.ResolveDependencies"/>
+        /// </summary>
+        public bool ResolveDependencies { get; set; }
+
+        /// <summary>
+        /// Longest time one input file or unit of a job may take, or null for no limit; see <see cref="CppToCsStructuralConverter.FileTimeBudget"/>
+        /// </summary>
+        public TimeSpan? FileTimeBudget { get; set; }
+
+        /// <summary>
+        /// Converts all jobs and returns their results in job order
+        /// </summary>
+        public IReadOnlyList<ConversionJobResult> Run(IReadOnlyList<ConversionJob> jobs)
+        {
+            var results = new ConversionJobResult[jobs.Count];
+            var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = Math.Max(1, MaxConcurrentJobs) };
+
+            // Workers and memory are shared by the jobs that can actually run at the same time
+            var concurrentJobs = Math.Max(1, Math.Min(MaxConcurrentJobs, jobs.Count));
+
+            Parallel.For(0, jobs.Count, parallelOptions, i =>
+            {
+                results[i] = RunJob(jobs[i], concurrentJobs);
+            });
+
+            return results;
+        }
+
+        private ConversionJobResult RunJob(ConversionJob job, int concurrentJobs)
+        {
+            var logger = new PrefixedLogger(_logger, $"[{job}] ");
+            var converter = CreateJobConverter(job, logger, concurrentJobs);
+
+            try
+            {
+                if (!Directory.Exists(job.SourceDirectory))
+                    throw new DirectoryNotFoundException($"Source directory '{job.SourceDirectory}' does not exist.");
+
+                if (job.Files != null && job.Files.Length > 0)
+                {
+                    converter.ConvertSpecificFiles(job.SourceDirectory, job.Files, job.OutputDirectory);
+                }
+                else
+                {
+                    converter.ConvertDirectory(job.SourceDirectory, job.OutputDirectory);
+                }
+                return new ConversionJobResult(job, converter.LastMetrics, null);
+            }
+            catch (Exception ex)
+            {
+                logger.LogError($"Error during conversion: {ex.Message}");
+                return new ConversionJobResult(job, converter.LastMetrics, ex);
+            }
+        }
+
+        /// <summary>
+        /// Converter for one job, with its share of the workers and the memory budget of the jobs running at the same time
+        /// </summary>
+        internal CppToCsStructuralConverter CreateJobConverter(ConversionJob job, ILogger logger, int concurrentJobs)
+        {
+            return new CppToCsStructuralConverter(logger)
+            {
+                MaxDegreeOfParallelism = Math.Max(1, MaxDegreeOfParallelism / concurrentJobs),
+                Incremental = Incremental,
+                ParseCacheDirectory = ParseCacheDirectory != null ? Path.Combine(ParseCacheDirectory, GetJobCacheName(job)) : null,
+                MemoryBudgetBytes = MemoryBudgetBytes / concurrentJobs,
+                ResolveDependencies = ResolveDependencies,
+                FileTimeBudget = FileTimeBudget
+            };
+        }
+
+        /// <summary>
+        /// Cache subdirectory of a job: the source directory's name for readability plus a hash of its full path
+        /// and file list, since component folders in different trees often share a name
+        /// </summary>
+        private static string GetJobCacheName(ConversionJob job)
+        {
+            var key = Path.GetFullPath(job.SourceDirectory) + "|" + string.Join(",", job.Files ?? Array.Empty<string>());
+            var hash = Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(key)), 0, 8);
+            return $"{job}-{hash}";
+        }
+    }
+
+    /// <summary>
+    /// Outcome of one job of a <see cref="ConversionBatch"/>
+    /// </summary>
+    public class ConversionJobResult
+    {
+        public ConversionJobResult(ConversionJob job, ConversionMetrics? metrics, Exception? error)
+        {
+            Job = job;
+            Metrics = metrics;
+            Error = error;
+        }
+
+        public ConversionJob Job { get; }
+        public ConversionMetrics? Metrics { get; } // Null if the job failed before converting
+        public Exception? Error { get; }
+        public bool Succeeded => Error == null;
+    }
+}
@@ -0,0 +1,138 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// One conversion of a batch: a source directory, optionally restricted to some of its files, and an output directory
+    /// </summary>
+    public class ConversionJob
+    {
+        public const string DefaultOutputDirectoryName = "Generated_CS";
+
+        public string SourceDirectory { get; set; } = string.Empty;
+        public string OutputDirectory { get; set; } = string.Empty;
+        public string[]? Files { get; set; } // File names relative to SourceDirectory; null converts the whole directory
+
+        /// <summary>
+        /// Creates a job from command line style arguments:
+        /// <c>&lt;source_directory&gt; [file1,file2,...] [output_directory]</c>.
+        /// With two arguments the second is a file list if it contains a comma or ends in .h or .cpp.
+        /// Without an output directory the output goes to <see cref="DefaultOutputDirectoryName"/> in the source directory.
+        /// </summary>
+        public static ConversionJob Parse(IReadOnlyList<string> args)
+        {
+            if (args.Count == 0)
+                throw new ArgumentException("A conversion job needs a source directory", nameof(args));
+
+            var job = new ConversionJob { SourceDirectory = args[0] };
+            if (args.Count == 2)
+            {
+                // Could be: <source> <output> OR <source> <files>
+                if (args[1].Contains(",") || args[1].EndsWith(".h") || args[1].EndsWith(".cpp"))
+                {
+                    job.Files = SplitFileList(args[1]);
+                    job.OutputDirectory = Path.Combine(job.SourceDirectory, DefaultOutputDirectoryName);
+                }
+                else
+                {
+                    job.OutputDirectory = args[1];
+                }
+            }
+            else if (args.Count == 3)
+            {
+                // <source> <files> <output>
+                job.Files = SplitFileList(args[1]);
+                job.OutputDirectory = args[2];
+            }
+            else
+            {
+                // Default: <source>; further arguments are ignored
+                job.OutputDirectory = Path.Combine(job.SourceDirectory, DefaultOutputDirectoryName);
+            }
+            return job;
+        }
+
+        /// <summary>
+        /// Reads a job file: one job per line in the <see cref="Parse"/> syntax, with arguments separated by
+        /// whitespace and paths containing spaces in double quotes. Empty lines and lines starting with # are skipped.
+        /// </summary>
+        /// <exception cref="FormatException">A line has unbalanced quotes or more than three arguments</exception>
+        public static List<ConversionJob> LoadJobFile(string path)
+        {
+            var jobs = new List<ConversionJob>();
+            var lineNumber = 0;
+            foreach (var line in File.ReadLines(path))
+            {
+                lineNumber++;
+                var trimmed = line.Trim();
+                if (trimmed.Length == 0 || trimmed.StartsWith("#"))
+                    continue;
+
+                var args = SplitJobLine(trimmed, path, lineNumber);
+                if (args.Count > 3)
+                    throw new FormatException($"{path}({lineNumber}): expected <source_directory> [file1,file2,...] [output_directory], found {args.Count} arguments");
+
+                jobs.Add(Parse(args));
+            }
+            return jobs;
+        }
+
+        /// <summary>
+        /// Short name for messages: the source directory's name
+        /// </summary>
+        public override string ToString()
+        {
+            var name = Path.GetFileName(Path.TrimEndingDirectorySeparator(SourceDirectory));
+            return string.IsNullOrEmpty(name) ? SourceDirectory : name;
+        }
+
+        private static string[] SplitFileList(string fileList)
+        {
+            return fileList.Split(',', StringSplitOptions.RemoveEmptyEntries)
+                           .Select(f => f.Trim())
+                           .ToArray();
+        }
+
+        private static List<string> SplitJobLine(string line, string path, int lineNumber)
+        {
+            var args = new List<string>();
+            var current = new StringBuilder();
+            bool inQuotes = false;
+            bool hasArgument = false;
+
+            foreach (var ch in line)
+            {
+                if (ch == '"')
+                {
+                    inQuotes = !inQuotes;
+                    hasArgument = true;
+                }
+                else if (char.IsWhiteSpace(ch) && !inQuotes)
+                {
+                    if (hasArgument)
+                    {
+                        args.Add(current.ToString());
+                        current.Clear();
+                        hasArgument = false;
+                    }
+                }
+                else
+                {
+                    current.Append(ch);
+                    hasArgument = true;
+                }
+            }
+
+            if (inQuotes)
+                throw new FormatException($"{path}({lineNumber}): unterminated quoted argument");
+            if (hasArgument)
+                args.Add(current.ToString());
+
+            return args;
+        }
+    }
+}
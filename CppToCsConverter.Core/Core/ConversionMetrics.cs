@@ -0,0 +1,295 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Diagnostics.Metrics;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using System.Threading;
+using CppToCsConverter.Core.Utils;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Timings, allocations and element counts of one conversion run, per stage, per input file and per generated unit.
+    /// The same measurements are published on the "CppToCsConverter" <see cref="Meter"/>, so they can be
+    /// collected with dotnet-counters or an OpenTelemetry listener as well as from this report.
+    /// Every stage is measured through this object, so it also carries the run's cancellation token and progress
+    /// receiver to the stages.
+    /// </summary>
+    public class ConversionMetrics
+    {
+        public const string MeterName = "CppToCsConverter";
+
+        private static readonly Meter Meter = new Meter(MeterName);
+        private static readonly Histogram<double> StageDuration = Meter.CreateHistogram<double>("cpptocs.stage.duration", "ms", "Duration of a conversion stage");
+        private static readonly Histogram<double> FileParseDuration = Meter.CreateHistogram<double>("cpptocs.file.parse.duration", "ms", "Time to parse one input file");
+        private static readonly Histogram<double> UnitGenerateDuration = Meter.CreateHistogram<double>("cpptocs.unit.generate.duration", "ms", "Time to generate the C# files of one header file unit");
+        private static readonly Counter<long> ParsedElements = Meter.CreateCounter<long>("cpptocs.elements.parsed", "{element}", "Classes, methods, regions and defines found in the input files");
+        private static readonly ObservableCounter<long> NormalizationLookups = Meter.CreateObservableCounter("cpptocs.normalization.lookups", ObserveNormalizationLookups, "{lookup}", "Type and value normalizations answered from the cache (hit) or computed (miss)");
+
+        public DateTime StartedUtc { get; set; } = DateTime.UtcNow;
+        public double TotalMilliseconds { get; set; }
+        public long TotalAllocatedBytes { get; set; }
+        public List<StageMetrics> Stages { get; set; } = new List<StageMetrics>();
+        public List<FileMetrics> Files { get; set; } = new List<FileMetrics>();
+        public List<UnitMetrics> Units { get; set; } = new List<UnitMetrics>();
+        public List<QuarantineEntry> Quarantined { get; set; } = new List<QuarantineEntry>(); // Left out for exceeding the file time budget
+        public List<CacheMetrics> NormalizationCaches { get; set; } = new List<CacheMetrics>();
+
+        // The normalization caches are process wide, so a run reports the lookups made since it started
+        private readonly (string Name, long Hits, long Misses)[] _normalizationAtStart = TypeNormalizer.GetStatistics();
+
+        /// <summary>
+        /// Cancels the run at the next stage, file or unit
+        /// </summary>
+        internal CancellationToken CancellationToken { get; init; }
+
+        /// <summary>
+        /// Receives the stage, file and unit events of the run, or null
+        /// </summary>
+        internal IProgress<ConversionProgress>? Progress { get; init; }
+
+        // Serializes progress reports from parallel parses, so the receiver need not be thread-safe
+        private readonly object _progressLock = new object();
+
+        public int TotalClasses => Files.Sum(f => f.Classes);
+        public int TotalMethods => Files.Sum(f => f.Methods);
+        public int TotalRegions => Files.Sum(f => f.Regions);
+        public int TotalDefines => Files.Sum(f => f.Defines);
+        public int CachedFiles => Files.Count(f => f.FromCache);
+
+        /// <summary>
+        /// Measures a stage until the returned scope is disposed. A stage measured more than once in a run
+        /// (incremental runs parse in two passes) accumulates into one entry.
+        /// Throws if the run is cancelled, so every stage starts with a cancellation check.
+        /// </summary>
+        internal StageScope MeasureStage(string name)
+        {
+            CancellationToken.ThrowIfCancellationRequested();
+            Report(new ConversionProgress(ConversionProgressKind.StageStarted, name, null, 0, 0, 0));
+            return new StageScope(this, name);
+        }
+
+        /// <summary>
+        /// Reports a progress event; safe to call from parallel tasks
+        /// </summary>
+        internal void Report(ConversionProgress progress)
+        {
+            if (Progress == null)
+                return;
+
+            lock (_progressLock)
+            {
+                Progress.Report(progress);
+            }
+        }
+
+        /// <summary>
+        /// Records an input file or unit that exceeded the time budget; safe to call from parallel tasks
+        /// </summary>
+        internal void Quarantine(string name, string stage, TimeSpan budget)
+        {
+            lock (Quarantined)
+            {
+                Quarantined.Add(new QuarantineEntry { Name = name, Stage = stage, BudgetMilliseconds = budget.TotalMilliseconds });
+            }
+            Report(new ConversionProgress(ConversionProgressKind.Quarantined, stage, name, 0, 0, budget.TotalMilliseconds));
+        }
+
+        /// <summary>
+        /// Starts measuring the parse of one file on the current thread; complete it with <see cref="FileMeasurement.Complete"/>
+        /// </summary>
+        internal static FileMeasurement MeasureFile()
+        {
+            return new FileMeasurement(Stopwatch.GetTimestamp(), GC.GetAllocatedBytesForCurrentThread());
+        }
+
+        /// <summary>
+        /// Adds per-file measurements in input order. Called on the converting thread after a parallel parse.
+        /// </summary>
+        internal void AddFiles(IEnumerable<FileMetrics> files)
+        {
+            foreach (var file in files)
+            {
+                Files.Add(file);
+                var kind = new KeyValuePair<string, object?>("file.kind", file.Kind);
+                FileParseDuration.Record(file.ParseMilliseconds, kind);
+                ParsedElements.Add(file.Classes, kind, new KeyValuePair<string, object?>("element", "class"));
+                ParsedElements.Add(file.Methods, kind, new KeyValuePair<string, object?>("element", "method"));
+                ParsedElements.Add(file.Regions, kind, new KeyValuePair<string, object?>("element", "region"));
+                ParsedElements.Add(file.Defines, kind, new KeyValuePair<string, object?>("element", "define"));
+            }
+        }
+
+        internal void AddUnit(string name, int outputFiles, double milliseconds)
+        {
+            Units.Add(new UnitMetrics { Name = name, OutputFiles = outputFiles, GenerateMilliseconds = milliseconds });
+            UnitGenerateDuration.Record(milliseconds);
+        }
+
+        internal void Complete(TimeSpan elapsed, long allocatedBytes)
+        {
+            TotalMilliseconds = elapsed.TotalMilliseconds;
+            TotalAllocatedBytes = allocatedBytes;
+
+            var normalization = TypeNormalizer.GetStatistics();
+            NormalizationCaches.Clear();
+            for (int i = 0; i < normalization.Length; i++)
+            {
+                NormalizationCaches.Add(new CacheMetrics
+                {
+                    Name = normalization[i].Name,
+                    Hits = normalization[i].Hits - _normalizationAtStart[i].Hits,
+                    Misses = normalization[i].Misses - _normalizationAtStart[i].Misses
+                });
+            }
+        }
+
+        private static IEnumerable<Measurement<long>> ObserveNormalizationLookups()
+        {
+            foreach (var (name, hits, misses) in TypeNormalizer.GetStatistics())
+            {
+                var cache = new KeyValuePair<string, object?>("cache", name);
+                yield return new Measurement<long>(hits, cache, new KeyValuePair<string, object?>("result", "hit"));
+                yield return new Measurement<long>(misses, cache, new KeyValuePair<string, object?>("result", "miss"));
+            }
+        }
+
+        public void Save(string path)
+        {
+            using var stream = File.Create(path);
+            JsonSerializer.Serialize(stream, this, ConversionMetricsJsonContext.Default.ConversionMetrics);
+        }
+
+        private void AddStage(string name, double milliseconds, long allocatedBytes)
+        {
+            var stage = Stages.FirstOrDefault(s => s.Name == name);
+            if (stage == null)
+            {
+                stage = new StageMetrics { Name = name };
+                Stages.Add(stage);
+            }
+            stage.Milliseconds += milliseconds;
+            stage.AllocatedBytes += allocatedBytes;
+            StageDuration.Record(milliseconds, new KeyValuePair<string, object?>("stage", name));
+        }
+
+        internal readonly struct StageScope : IDisposable
+        {
+            private readonly ConversionMetrics _metrics;
+            private readonly string _name;
+            private readonly long _startTimestamp;
+            private readonly long _startAllocatedBytes;
+
+            public StageScope(ConversionMetrics metrics, string name)
+            {
+                _metrics = metrics;
+                _name = name;
+                _startTimestamp = Stopwatch.GetTimestamp();
+                // Stages run on several threads, so allocations are taken process wide
+                _startAllocatedBytes = GC.GetTotalAllocatedBytes();
+            }
+
+            public void Dispose()
+            {
+                var milliseconds = Stopwatch.GetElapsedTime(_startTimestamp).TotalMilliseconds;
+                _metrics.AddStage(_name, milliseconds, GC.GetTotalAllocatedBytes() - _startAllocatedBytes);
+                _metrics.Report(new ConversionProgress(ConversionProgressKind.StageCompleted, _name, null, 0, 0, milliseconds));
+            }
+        }
+
+        internal readonly struct FileMeasurement
+        {
+            private readonly long _startTimestamp;
+            private readonly long _startAllocatedBytes;
+
+            public FileMeasurement(long startTimestamp, long startAllocatedBytes)
+            {
+                _startTimestamp = startTimestamp;
+                _startAllocatedBytes = startAllocatedBytes;
+            }
+
+            public FileMetrics Complete(string path, string kind, int classes, int methods, int regions, int defines, bool fromCache)
+            {
+                return new FileMetrics
+                {
+                    Path = path,
+                    Kind = kind,
+                    ParseMilliseconds = Stopwatch.GetElapsedTime(_startTimestamp).TotalMilliseconds,
+                    AllocatedBytes = GC.GetAllocatedBytesForCurrentThread() - _startAllocatedBytes,
+                    Classes = classes,
+                    Methods = methods,
+                    Regions = regions,
+                    Defines = defines,
+                    FromCache = fromCache
+                };
+            }
+        }
+    }
+
+    /// <summary>
+    /// A pipeline stage: Hash (incremental runs only), Parse, Link or Generate (which includes writing)
+    /// </summary>
+    public class StageMetrics
+    {
+        public string Name { get; set; } = string.Empty;
+        public double Milliseconds { get; set; }
+        public long AllocatedBytes { get; set; }
+    }
+
+    /// <summary>
+    /// A parsed header or source file; allocations are those of the thread that parsed it or loaded it from the parse cache
+    /// </summary>
+    public class FileMetrics
+    {
+        public string Path { get; set; } = string.Empty;
+        public string Kind { get; set; } = string.Empty; // "header" or "source"
+        public double ParseMilliseconds { get; set; }
+        public long AllocatedBytes { get; set; }
+        public int Classes { get; set; }
+        public int Methods { get; set; }
+        public int Regions { get; set; } // Region start and end markers
+        public int Defines { get; set; }
+        public bool FromCache { get; set; } // Loaded from the parse cache instead of parsed
+    }
+
+    /// <summary>
+    /// A generated header file unit (main file plus its defines and partial files)
+    /// </summary>
+    public class UnitMetrics
+    {
+        public string Name { get; set; } = string.Empty;
+        public int OutputFiles { get; set; }
+        public double GenerateMilliseconds { get; set; }
+    }
+
+    /// <summary>
+    /// Lookups of one type or value normalization cache during a run; lookups of runs at the same time are included
+    /// </summary>
+    public class CacheMetrics
+    {
+        public string Name { get; set; } = string.Empty;
+        public long Hits { get; set; }
+        public long Misses { get; set; }
+        public double HitRate => Hits + Misses > 0 ? (double)Hits / (Hits + Misses) : 0;
+    }
+
+    /// <summary>
+    /// An input file or header file unit whose parse or generation took longer than the file time budget.
+    /// A quarantined input is converted as if it were empty; a quarantined unit is not written.
+    /// </summary>
+    public class QuarantineEntry
+    {
+        public string Name { get; set; } = string.Empty; // Input file path (Parse) or unit name (Generate)
+        public string Stage { get; set; } = string.Empty;
+        public double BudgetMilliseconds { get; set; }
+    }
+
+    [JsonSourceGenerationOptions(WriteIndented = true)]
+    [JsonSerializable(typeof(ConversionMetrics))]
+    internal partial class ConversionMetricsJsonContext : JsonSerializerContext
+    {
+    }
+}
@@ -0,0 +1,49 @@
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using CppToCsConverter.Core.Models;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// The linked result of parsing a set of header and source files.
+    /// Produced by the link stage of <see cref="CppToCsStructuralConverter"/> and consumed by the generation stage.
+    /// All dictionaries are keyed by file name without extension and keep the insertion order of the input files,
+    /// which the generator relies on for deterministic output.
+    /// </summary>
+    internal class ConversionModel
+    {
+        public Dictionary<string, List<CppClass>> HeaderFileClasses { get; } = new Dictionary<string, List<CppClass>>();
+        public Dictionary<string, List<CppMethod>> ParsedSources { get; } = new Dictionary<string, List<CppMethod>>();
+        public Dictionary<string, List<CppStaticMemberInit>> StaticMemberInits { get; } = new Dictionary<string, List<CppStaticMemberInit>>();
+        public Dictionary<string, List<CppDefine>> SourceDefines { get; } = new Dictionary<string, List<CppDefine>>();
+        public Dictionary<string, List<string>> SourceFileTopComments { get; } = new Dictionary<string, List<string>>();
+        public Dictionary<string, List<CppRegion>> SourceRegions { get; } = new Dictionary<string, List<CppRegion>>();
+
+        /// <summary>
+        /// Names of the XDefines classes generated for public interfaces, referenced with "using static" by every class file
+        /// </summary>
+        public List<string> DefinesClasses { get; } = new List<string>();
+
+        /// <summary>
+        /// Source methods indexed by class and signature. Rebuilt by <see cref="BuildIndexes"/> once linking is done.
+        /// </summary>
+        public ImplementationIndex Implementations { get; private set; }
+
+        /// <summary>
+        /// Types by name with their header unit, implementing sources and factory. Rebuilt by <see cref="BuildIndexes"/>.
+        /// </summary>
+        public SymbolIndex Symbols { get; private set; }
+
+        public ConversionModel()
+        {
+            BuildIndexes();
+        }
+
+        [MemberNotNull(nameof(Implementations), nameof(Symbols))]
+        public void BuildIndexes()
+        {
+            Implementations = new ImplementationIndex(ParsedSources, HeaderFileClasses);
+            Symbols = new SymbolIndex(HeaderFileClasses, Implementations);
+        }
+    }
+}
@@ -0,0 +1,40 @@
+namespace CppToCsConverter.Core.Core
+{
+    public enum ConversionProgressKind
+    {
+        StageStarted,    // A stage (Hash, Scan, Parse, Link, Generate) begins
+        StageCompleted,  // A stage ends; Milliseconds is its duration
+        FileParsed,      // An input file was parsed or loaded from the parse cache
+        UnitGenerated,   // The C# files of a header file unit were generated
+        Quarantined      // An input file or unit exceeded the file time budget and was left out
+    }
+
+    /// <summary>
+    /// One progress event of a conversion run, reported to the <see cref="System.IProgress{T}"/> given to an async
+    /// conversion. Events are reported one at a time, in the order they happen.
+    /// </summary>
+    public class ConversionProgress
+    {
+        public ConversionProgress(ConversionProgressKind kind, string stage, string? name, int completed, int total, double milliseconds)
+        {
+            Kind = kind;
+            Stage = stage;
+            Name = name;
+            Completed = completed;
+            Total = total;
+            Milliseconds = milliseconds;
+        }
+
+        public ConversionProgressKind Kind { get; }
+        public string Stage { get; }
+        public string? Name { get; } // Input file path or unit name; null for stage events
+        public int Completed { get; } // Files or units done so far in this pass of the stage, including this one
+        public int Total { get; } // Files or units in this pass of the stage; 0 for stage events
+        public double Milliseconds { get; } // Duration of the stage, the file's parse or the unit's generation
+
+        public override string ToString()
+        {
+            return Name == null ? $"{Stage} {Kind}" : $"{Stage} {Kind} {Name} ({Completed}/{Total})";
+        }
+    }
+}
@@ -0,0 +1,215 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using CppToCsConverter.Core.Logging;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Keeps a source tree converted while it is being edited. The converter stays resident with its input hashes,
+    /// file list and incremental manifest in memory; each batch of file system changes reruns the incremental
+    /// conversion, which reparses only the touched files (plus the files linked to them) and regenerates the affected units.
+    /// Parsed classes are not reused between runs because linking and generation update them in place.
+    /// </summary>
+    public sealed class ConversionWatcher : IDisposable
+    {
+        private readonly CppToCsStructuralConverter _converter;
+        private readonly ILogger _logger;
+        private readonly string _sourceDirectory;
+        private readonly string _outputDirectory;
+        private readonly FileSystemWatcher _watcher;
+        private readonly FileSystemWatcher _directoryWatcher;
+        private readonly Timer _debounceTimer;
+        private readonly object _pendingLock = new object();
+        private readonly object _conversionLock = new object();
+        private readonly ConcurrentDictionary<string, string> _inputHashes = new ConcurrentDictionary<string, string>(StringComparer.Ordinal);
+        private HashSet<string> _pendingChanges = new HashSet<string>(StringComparer.Ordinal);
+        private bool _fileListStale = true;
+        private string[] _headerFiles = Array.Empty<string>();
+        private string[] _sourceFiles = Array.Empty<string>();
+        private bool _disposed;
+
+        /// <param name="converter">Converter to keep resident; it is switched to incremental mode</param>
+        /// <param name="logger">Receives watcher messages and conversion errors; defaults to the converter's logger</param>
+        public ConversionWatcher(CppToCsStructuralConverter converter, string sourceDirectory, string outputDirectory, ILogger? logger = null)
+        {
+            _converter = converter;
+            _logger = logger ?? converter.Logger;
+            _sourceDirectory = sourceDirectory;
+            _outputDirectory = outputDirectory;
+
+            _converter.Incremental = true;
+            _converter.KnownInputHashes = _inputHashes;
+
+            _watcher = new FileSystemWatcher(sourceDirectory)
+            {
+                IncludeSubdirectories = true,
+                NotifyFilter = NotifyFilters.FileName | NotifyFilters.LastWrite | NotifyFilters.Size
+            };
+            _watcher.Filters.Add("*.h");
+            _watcher.Filters.Add("*.cpp");
+            _watcher.Changed += (sender, e) => OnInputChanged(e.FullPath, fileListChanged: false);
+            _watcher.Created += (sender, e) => OnInputChanged(e.FullPath, fileListChanged: true);
+            _watcher.Deleted += (sender, e) => OnInputChanged(e.FullPath, fileListChanged: true);
+            _watcher.Renamed += (sender, e) =>
+            {
+                OnInputChanged(e.OldFullPath, fileListChanged: true);
+                OnInputChanged(e.FullPath, fileListChanged: true);
+            };
+            _watcher.Error += (sender, e) => OnWatcherError(e.GetException());
+
+            // Folders have no extension, so the filters above never report them; a folder of inputs that is
+            // created, renamed or deleted raises a single event for the folder and none for its files
+            _directoryWatcher = new FileSystemWatcher(sourceDirectory)
+            {
+                IncludeSubdirectories = true,
+                NotifyFilter = NotifyFilters.DirectoryName
+            };
+            _directoryWatcher.Created += (sender, e) => OnDirectoryChanged(e.FullPath);
+            _directoryWatcher.Deleted += (sender, e) => OnDirectoryChanged(e.FullPath);
+            _directoryWatcher.Renamed += (sender, e) =>
+            {
+                OnDirectoryChanged(e.OldFullPath);
+                OnDirectoryChanged(e.FullPath);
+            };
+            _directoryWatcher.Error += (sender, e) => OnWatcherError(e.GetException());
+
+            _debounceTimer = new Timer(_ => ConvertPendingChanges(), null, Timeout.Infinite, Timeout.Infinite);
+        }
+
+        /// <summary>
+        /// How long to wait after the last change before converting, so that a save of several files is one run
+        /// </summary>
+        public TimeSpan Debounce { get; set; } = TimeSpan.FromMilliseconds(50);
+
+        /// <summary>
+        /// Raised after every conversion run, on a thread pool thread, with the metrics of that run
+        /// </summary>
+        public event EventHandler<ConversionMetrics>? Converted;
+
+        /// <summary>
+        /// Starts watching the tree and converts it once (incrementally against the output directory's manifest).
+        /// Changes made during that first run are picked up by the next one.
+        /// </summary>
+        public void Start()
+        {
+            _watcher.EnableRaisingEvents = true;
+            _directoryWatcher.EnableRaisingEvents = true;
+            Convert();
+            _logger.LogInfo($"Watching {_sourceDirectory} for changes");
+        }
+
+        public void Dispose()
+        {
+            lock (_conversionLock)
+            {
+                _disposed = true;
+                _watcher.Dispose();
+                _directoryWatcher.Dispose();
+                _debounceTimer.Dispose();
+                _converter.KnownInputHashes = null;
+            }
+        }
+
+        private void OnInputChanged(string path, bool fileListChanged)
+        {
+            lock (_pendingLock)
+            {
+                _pendingChanges.Add(path);
+                _fileListStale |= fileListChanged;
+                _debounceTimer.Change(Debounce, Timeout.InfiniteTimeSpan);
+            }
+        }
+
+        private void OnDirectoryChanged(string path)
+        {
+            // The files below the folder are not reported one by one, so rescan the tree and forget their hashes
+            var prefix = Path.TrimEndingDirectorySeparator(path) + Path.DirectorySeparatorChar;
+            lock (_pendingLock)
+            {
+                foreach (var known in _inputHashes.Keys)
+                {
+                    if (known.StartsWith(prefix, StringComparison.Ordinal))
+                        _inputHashes.TryRemove(known, out _);
+                }
+                _pendingChanges.Add(path);
+                _fileListStale = true;
+                _debounceTimer.Change(Debounce, Timeout.InfiniteTimeSpan);
+            }
+        }
+
+        private void OnWatcherError(Exception error)
+        {
+            // Events were lost (e.g. the watcher's buffer overflowed); nothing remembered about the inputs can be trusted
+            _logger.LogWarning($"Warning: File watching failed ({error.Message}), rescanning {_sourceDirectory}");
+            lock (_pendingLock)
+            {
+                _inputHashes.Clear();
+                _fileListStale = true;
+                _debounceTimer.Change(Debounce, Timeout.InfiniteTimeSpan);
+            }
+        }
+
+        private void ConvertPendingChanges()
+        {
+            HashSet<string> changes;
+            lock (_pendingLock)
+            {
+                changes = _pendingChanges;
+                _pendingChanges = new HashSet<string>(StringComparer.Ordinal);
+            }
+
+            foreach (var path in changes)
+            {
+                _inputHashes.TryRemove(path, out _);
+            }
+
+            _logger.LogInfo($"{changes.Count} input file(s) changed, converting");
+            Convert();
+        }
+
+        private void Convert()
+        {
+            ConversionMetrics? metrics;
+            lock (_conversionLock)
+            {
+                if (_disposed)
+                    return;
+
+                try
+                {
+                    bool fileListStale;
+                    lock (_pendingLock)
+                    {
+                        fileListStale = _fileListStale;
+                        _fileListStale = false;
+                    }
+                    if (fileListStale)
+                    {
+                        (_headerFiles, _sourceFiles) = CppToCsStructuralConverter.FindSourceTreeFiles(_sourceDirectory);
+                    }
+
+                    _converter.ConvertFiles(_headerFiles, _sourceFiles, _outputDirectory, _sourceDirectory);
+                    metrics = _converter.LastMetrics;
+                }
+                catch (Exception ex)
+                {
+                    // Keep watching; the next change (e.g. fixing the file) triggers another run
+                    _logger.LogError($"Error during conversion: {ex.Message}");
+                    lock (_pendingLock)
+                    {
+                        _fileListStale = true;
+                    }
+                    return;
+                }
+            }
+
+            if (metrics != null)
+            {
+                Converted?.Invoke(this, metrics);
+            }
+        }
+    }
+}
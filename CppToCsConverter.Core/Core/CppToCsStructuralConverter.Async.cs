@@ -0,0 +1,196 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Logging;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Asynchronous conversion to disk, with cancellation, progress events and the per-file time budget
+    /// (<see cref="FileTimeBudget"/>). The stages are those of the synchronous methods and so is the output.
+    /// </summary>
+    public partial class CppToCsStructuralConverter
+    {
+        /// <summary>
+        /// Converts a source tree like <see cref="ConvertDirectory(string, string)"/> on a thread pool thread.
+        /// Cancelling stops the run at the next stage, file or unit and throws <see cref="OperationCanceledException"/>;
+        /// files written before that are left in place.
+        /// </summary>
+        /// <param name="progress">Receives the stage, file and unit events of the run, one at a time, or null</param>
+        public Task ConvertDirectoryAsync(string sourceDirectory, string outputDirectory, IProgress<ConversionProgress>? progress = null, CancellationToken cancellationToken = default)
+        {
+            return RunAsync(metrics => ConvertDirectory(sourceDirectory, outputDirectory, metrics), progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Converts the listed files like <see cref="ConvertSpecificFiles(string, string[], string)"/>, with cancellation
+        /// and progress as for <see cref="ConvertDirectoryAsync"/>
+        /// </summary>
+        public Task ConvertSpecificFilesAsync(string sourceDirectory, string[] fileNames, string outputDirectory, IProgress<ConversionProgress>? progress = null, CancellationToken cancellationToken = default)
+        {
+            return RunAsync(metrics => ConvertSpecificFiles(sourceDirectory, fileNames, outputDirectory, metrics), progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Converts the given files like <see cref="ConvertFiles(string[], string[], string, string)"/>, with cancellation
+        /// and progress as for <see cref="ConvertDirectoryAsync"/>
+        /// </summary>
+        public Task ConvertFilesAsync(string[] headerFiles, string[] sourceFiles, string outputDirectory, string sourceDirectory = "", IProgress<ConversionProgress>? progress = null, CancellationToken cancellationToken = default)
+        {
+            return RunAsync(metrics => ConvertFiles(headerFiles, sourceFiles, outputDirectory, sourceDirectory, unitNames: null, metrics), progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Runs a conversion off the caller's thread, since parsing and linking block on parallel loops
+        /// </summary>
+        private static Task RunAsync(Action<ConversionMetrics> conversion, IProgress<ConversionProgress>? progress, CancellationToken cancellationToken)
+        {
+            var metrics = new ConversionMetrics { Progress = progress, CancellationToken = cancellationToken };
+            return Task.Run(() => conversion(metrics), cancellationToken);
+        }
+
+        /// <summary>
+        /// Parses a file within <see cref="FileTimeBudget"/>. Without a budget the parse runs on the calling thread. With one
+        /// it runs as a thread pool task, since the parsers cannot be interrupted: if the budget runs out first, false is
+        /// returned and the parse is abandoned. An abandoned parse is left to finish unobserved, so it gets the file's
+        /// content in a store of its own, its messages are dropped, and the caller alone uses its result and caches it.
+        /// </summary>
+        /// <param name="parse">Parses the file, taking its content from the given store</param>
+        /// <param name="parseAllocatedBytes">Bytes the parse allocated on the pool thread, or 0 if it ran on the calling thread</param>
+        private bool TryParseWithinBudget<T>(Func<FileContentStore, T> parse, string filePath, FileContentStore contents, CancellationToken cancellationToken, out T result, out long parseAllocatedBytes)
+        {
+            parseAllocatedBytes = 0;
+            if (!FileTimeBudget.HasValue)
+            {
+                result = parse(contents);
+                return true;
+            }
+
+            var fileContents = DetachContent(filePath, contents);
+            var abandoned = new StrongBox<bool>();
+            var started = new ManualResetEventSlim();
+            var task = Task.Run(() =>
+            {
+                ParserLogger.Abandoned.Value = abandoned;
+                started.Set();
+                var startAllocatedBytes = GC.GetAllocatedBytesForCurrentThread();
+                var parsed = parse(fileContents);
+                return (Result: parsed, AllocatedBytes: GC.GetAllocatedBytesForCurrentThread() - startAllocatedBytes);
+            });
+
+            var completed = false;
+            try
+            {
+                // The budget counts from the start of the parse, not from when a pool thread picked it up
+                started.Wait(cancellationToken);
+                var budgetMilliseconds = (int)Math.Min(FileTimeBudget.Value.TotalMilliseconds, int.MaxValue);
+                completed = Task.WaitAny(new Task[] { task }, budgetMilliseconds, cancellationToken) >= 0;
+            }
+            finally
+            {
+                if (!completed)
+                    abandoned.Value = true;
+            }
+
+            if (!completed)
+            {
+                result = default!;
+                return false;
+            }
+
+            (result, parseAllocatedBytes) = task.GetAwaiter().GetResult();
+            return true;
+        }
+
+        /// <summary>
+        /// Moves a file's content from the run's store into a store of its own
+        /// </summary>
+        private static FileContentStore DetachContent(string filePath, FileContentStore contents)
+        {
+            var detached = new FileContentStore();
+            try
+            {
+                detached.Add(contents.Take(filePath));
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                // The parser reads the file itself and reports the error
+            }
+            return detached;
+        }
+
+        /// <summary>
+        /// Waits until the task completes or the budget has passed since the start timestamp; true if it completed
+        /// </summary>
+        private static async Task<bool> CompletesWithinBudgetAsync(Task task, long startTimestamp, TimeSpan budget, CancellationToken cancellationToken)
+        {
+            var remaining = budget - Stopwatch.GetElapsedTime(startTimestamp);
+            if (task.IsCompleted || remaining <= TimeSpan.Zero)
+                return task.IsCompleted;
+
+            using var stopDelay = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            var first = await Task.WhenAny(task, Task.Delay(remaining, stopDelay.Token)).ConfigureAwait(false);
+            stopDelay.Cancel();
+            cancellationToken.ThrowIfCancellationRequested();
+            return first == task;
+        }
+
+        /// <summary>
+        /// Records an input file whose parse exceeded the budget; it is converted as if it were empty
+        /// </summary>
+        private FileMetrics QuarantineFile(string filePath, string kind, ConversionMetrics? metrics)
+        {
+            var budget = FileTimeBudget!.Value;
+            _logger.LogWarning($"Warning: parsing {Path.GetFileName(filePath)} exceeded the file time budget of {budget.TotalSeconds:0.###} s; it is converted as if it were empty");
+            metrics?.Quarantine(filePath, "Parse", budget);
+            return new FileMetrics { Path = filePath, Kind = kind, ParseMilliseconds = budget.TotalMilliseconds };
+        }
+
+        /// <summary>
+        /// Logger of the parsers. Drops the messages of parses abandoned for exceeding <see cref="FileTimeBudget"/>,
+        /// which may finish after the run has returned.
+        /// </summary>
+        private sealed class ParserLogger : ILogger
+        {
+            // Set on the thread of a budgeted parse and flowed to the tasks it starts
+            internal static readonly AsyncLocal<StrongBox<bool>?> Abandoned = new AsyncLocal<StrongBox<bool>?>();
+
+            private readonly ILogger _inner;
+
+            public ParserLogger(ILogger inner)
+            {
+                _inner = inner;
+            }
+
+            private static bool IsAbandoned => Abandoned.Value?.Value == true;
+
+            public void LogError(string message)
+            {
+                if (!IsAbandoned)
+                    _inner.LogError(message);
+            }
+
+            public void LogWarning(string message)
+            {
+                if (!IsAbandoned)
+                    _inner.LogWarning(message);
+            }
+
+            public void LogInfo(string message)
+            {
+                if (!IsAbandoned)
+                    _inner.LogInfo(message);
+            }
+
+            public void LogDebug(string message)
+            {
+                if (!IsAbandoned)
+                    _inner.LogDebug(message);
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// In-memory conversion: inputs are given as content instead of read from disk and the generated files are
+    /// returned instead of written, so a pipeline can hand them to its next stage directly.
+    /// The parse, link and generate stages are the same as for a conversion to disk, and so is the output.
+    /// </summary>
+    public partial class CppToCsStructuralConverter
+    {
+        /// <summary>
+        /// Converts inputs given as (path, content) pairs and returns the generated files, including partial class
+        /// and defines files, as each header unit completes. Files come in the order a conversion to disk writes them;
+        /// when two units produce a file of the same name, the later one is what a conversion to disk leaves behind.
+        /// A file's <see cref="GeneratedFile.FilePath"/> is its name, e.g. "CSample.cs".
+        /// </summary>
+        /// <param name="inputs">.h and .cpp files by path; the parsers only use the file name, other extensions are skipped</param>
+        /// <param name="sourceDirectory">Directory whose name becomes the namespace, as for <see cref="ConvertFiles"/></param>
+        /// <remarks>Nothing is written to disk except parse cache entries. <see cref="Incremental"/> does not apply.</remarks>
+        public IAsyncEnumerable<GeneratedFile> ConvertInMemoryAsync(IEnumerable<KeyValuePair<string, string>> inputs, string sourceDirectory = "", CancellationToken cancellationToken = default)
+        {
+            var contents = inputs.Select(input => SourceFileContent.FromText(input.Key, input.Value)).ToList();
+            return ConvertContentsAsync(contents, sourceDirectory, cancellationToken);
+        }
+
+        /// <summary>
+        /// Converts inputs given as (path, stream) pairs like <see cref="ConvertInMemoryAsync(IEnumerable{KeyValuePair{string, string}}, string, CancellationToken)"/>.
+        /// Every stream is read to its end, decoded like a file on disk, before parsing starts; the streams are not disposed.
+        /// </summary>
+        public async IAsyncEnumerable<GeneratedFile> ConvertInMemoryAsync(IEnumerable<KeyValuePair<string, Stream>> inputs, string sourceDirectory = "", [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            var contents = new List<SourceFileContent>();
+            foreach (var input in inputs)
+            {
+                contents.Add(await SourceFileContent.ReadAsync(input.Key, input.Value, cancellationToken).ConfigureAwait(false));
+            }
+
+            await foreach (var generatedFile in ConvertContentsAsync(contents, sourceDirectory, cancellationToken).ConfigureAwait(false))
+            {
+                yield return generatedFile;
+            }
+        }
+
+        private async IAsyncEnumerable<GeneratedFile> ConvertContentsAsync(List<SourceFileContent> inputs, string sourceDirectory, [EnumeratorCancellation] CancellationToken cancellationToken)
+        {
+            var (headerFiles, sourceFiles, contents) = CreateInMemoryInputs(inputs);
+            _logger.LogInfo($"Found {headerFiles.Length} header files and {sourceFiles.Length} source files in memory");
+
+            var maxParallelism = Math.Max(1, MaxDegreeOfParallelism);
+            var metrics = new ConversionMetrics { CancellationToken = cancellationToken };
+            var startTimestamp = Stopwatch.GetTimestamp();
+            var startAllocatedBytes = GC.GetTotalAllocatedBytes();
+            LastMetrics = metrics;
+            _parseCache?.BeginRun();
+
+            // Parsing and linking block on parallel loops, so they run off the caller's thread
+            var model = await Task.Run(() =>
+            {
+                List<CppClass>[] parsedHeaderFiles;
+                CppSourceFile?[] parsedSourceFiles;
+                using (metrics.MeasureStage("Parse"))
+                {
+                    (parsedHeaderFiles, parsedSourceFiles) = ParseFiles(headerFiles, sourceFiles, contents, maxParallelism, metrics);
+                }
+
+                cancellationToken.ThrowIfCancellationRequested();
+                using (metrics.MeasureStage("Link"))
+                {
+                    return LinkParsedFiles(headerFiles, parsedHeaderFiles, sourceFiles, parsedSourceFiles);
+                }
+            }, cancellationToken).ConfigureAwait(false);
+
+            // The stage includes the time the consumer spends between files
+            int fileCount = 0;
+            using (metrics.MeasureStage("Generate"))
+            {
+                await foreach (var (_, generatedFiles) in GenerateFilesAsync(model, string.Empty, sourceDirectory, maxParallelism, null, metrics, cancellationToken).ConfigureAwait(false))
+                {
+                    foreach (var generatedFile in generatedFiles)
+                    {
+                        _logger.LogDebug($"Generated C# file: {generatedFile.FileName}.cs (Size: {generatedFile.Content.Length} chars)");
+                        fileCount++;
+                        yield return generatedFile;
+                    }
+                }
+            }
+            metrics.Complete(Stopwatch.GetElapsedTime(startTimestamp), GC.GetTotalAllocatedBytes() - startAllocatedBytes);
+
+            _logger.LogInfo($"Conversion completed in {metrics.TotalMilliseconds:F0} ms: {metrics.Files.Count} files parsed, {metrics.TotalClasses} classes, {metrics.TotalMethods} methods, {fileCount} C# files generated");
+        }
+
+        /// <summary>
+        /// Splits in-memory inputs into header and source paths in input order and puts their content in a store
+        /// for the parsers. A path given twice keeps its first position and its last content.
+        /// </summary>
+        private (string[] HeaderFiles, string[] SourceFiles, FileContentStore Contents) CreateInMemoryInputs(List<SourceFileContent> inputs)
+        {
+            var headerFiles = new List<string>();
+            var sourceFiles = new List<string>();
+            var seen = new HashSet<string>(StringComparer.Ordinal);
+            var contents = new FileContentStore();
+
+            foreach (var input in inputs)
+            {
+                var extension = Path.GetExtension(input.FilePath);
+                List<string> files;
+                if (extension.Equals(".h", StringComparison.OrdinalIgnoreCase))
+                {
+                    files = headerFiles;
+                }
+                else if (extension.Equals(".cpp", StringComparison.OrdinalIgnoreCase))
+                {
+                    files = sourceFiles;
+                }
+                else
+                {
+                    _logger.LogWarning($"Warning: Unsupported file type '{extension}' for file '{input.FilePath}'");
+                    continue;
+                }
+
+                contents.Add(input);
+                if (seen.Add(input.FilePath))
+                {
+                    files.Add(input.FilePath);
+                }
+            }
+
+            return (headerFiles.ToArray(), sourceFiles.ToArray(), contents);
+        }
+    }
+}
@@ -0,0 +1,394 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Incremental conversion: uses the manifest from the previous run to parse only changed inputs and the
+    /// files linked to them, and to regenerate only the header file units those inputs contribute to.
+    ///
+    /// A unit X (the output of header file X.h) depends on the headers named X, the source named X
+    /// (file top comments and local structs) and every source implementing a class declared in unit X
+    /// (methods, static member initializations, defines and regions are all matched by class name).
+    /// </summary>
+    public partial class CppToCsStructuralConverter
+    {
+        // The manifest saved by the last run of this converter, reused while the file on disk is unchanged
+        private (string Path, DateTime WriteTimeUtc, IncrementalManifest Manifest)? _lastManifest;
+
+        /// <summary>
+        /// Input hashes kept between runs by a <see cref="ConversionWatcher"/>, which removes the paths it sees change.
+        /// Null (the default) hashes every input on every run.
+        /// </summary>
+        internal ConcurrentDictionary<string, string>? KnownInputHashes { get; set; }
+
+        private void ConvertFilesIncremental(string[] headerFiles, string[] sourceFiles, string outputDirectory, string sourceDirectory, FileContentStore contents, OutputFileWriter writer, int maxParallelism, ConversionMetrics metrics)
+        {
+            var manifestPath = Path.Combine(outputDirectory, IncrementalManifest.ManifestFileName);
+            var previous = LoadManifest(manifestPath);
+            var namespaceName = ResolveNamespace(sourceDirectory);
+
+            var headerKeys = headerFiles.Select(f => GetManifestPath(f, sourceDirectory)).ToArray();
+            var sourceKeys = sourceFiles.Select(f => GetManifestPath(f, sourceDirectory)).ToArray();
+
+            // Hash every input; this is much cheaper than parsing it, and the content is kept for the files parsed below
+            var headerHashes = new string[headerFiles.Length];
+            var sourceHashes = new string[sourceFiles.Length];
+            var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = maxParallelism, CancellationToken = metrics.CancellationToken };
+            using (metrics.MeasureStage("Hash"))
+            {
+                RunParallel(() => Parallel.For(0, headerFiles.Length + sourceFiles.Length, parallelOptions, i =>
+                {
+                    if (i < headerFiles.Length)
+                        headerHashes[i] = GetInputHash(headerFiles[i], contents);
+                    else
+                        sourceHashes[i - headerFiles.Length] = GetInputHash(sourceFiles[i - headerFiles.Length], contents);
+                }));
+            }
+
+            var previousInputs = new Dictionary<string, ManifestInput>();
+            foreach (var input in previous?.Inputs ?? new List<ManifestInput>())
+            {
+                previousInputs[input.Path] = input;
+            }
+
+            bool IsUnchanged(string key, bool isHeader, string hash) =>
+                previousInputs.TryGetValue(key, out var input) && input.IsHeader == isHeader && input.Hash == hash;
+
+            var changedHeaders = Enumerable.Range(0, headerFiles.Length).Where(i => !IsUnchanged(headerKeys[i], true, headerHashes[i])).ToList();
+            var changedSources = Enumerable.Range(0, sourceFiles.Length).Where(i => !IsUnchanged(sourceKeys[i], false, sourceHashes[i])).ToList();
+            var currentKeys = new HashSet<string>(headerKeys.Concat(sourceKeys));
+            var removedInputs = previousInputs.Values.Where(input => !currentKeys.Contains(input.Path)).ToList();
+            var missingOutputUnits = (previous?.Units ?? new List<ManifestUnit>())
+                .Where(unit => unit.Outputs.Any(output => !File.Exists(Path.Combine(outputDirectory, output))))
+                .Select(unit => unit.Name)
+                .ToList();
+
+            var fullRun = previous == null || previous.Namespace != namespaceName;
+            if (!fullRun && changedHeaders.Count == 0 && changedSources.Count == 0 && removedInputs.Count == 0 && missingOutputUnits.Count == 0)
+            {
+                _logger.LogInfo("Incremental: all inputs unchanged, nothing to convert");
+                foreach (var output in previous!.Units.SelectMany(u => u.Outputs))
+                {
+                    writer.RecordUntouched(Path.Combine(outputDirectory, output));
+                }
+                return;
+            }
+
+            // Parse the changed inputs first to learn which classes they declare or implement
+            var parsedHeaderFiles = new List<CppClass>?[headerFiles.Length];
+            var parsedSourceFiles = new CppSourceFile?[sourceFiles.Length];
+            var headerParsed = new bool[headerFiles.Length];
+            var sourceParsed = new bool[sourceFiles.Length];
+            ParseSelectedFiles(headerFiles, sourceFiles, changedHeaders, changedSources, parsedHeaderFiles, parsedSourceFiles, headerParsed, sourceParsed, contents, maxParallelism, metrics);
+
+            var headerClasses = new List<string>[headerFiles.Length];
+            var headerDefinesClasses = new List<string>[headerFiles.Length];
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                if (headerParsed[i])
+                {
+                    headerClasses[i] = parsedHeaderFiles[i]!.Select(c => c.Name).Distinct().ToList();
+                    headerDefinesClasses[i] = GetDefinesClassNames(parsedHeaderFiles[i]!);
+                }
+                else
+                {
+                    headerClasses[i] = previousInputs[headerKeys[i]].Classes;
+                    headerDefinesClasses[i] = previousInputs[headerKeys[i]].DefinesClasses;
+                }
+            }
+            var sourceClasses = new List<string>[sourceFiles.Length];
+            for (int i = 0; i < sourceFiles.Length; i++)
+            {
+                sourceClasses[i] = sourceParsed[i] ? GetImplementedClassNames(parsedSourceFiles[i]) : previousInputs[sourceKeys[i]].Classes;
+            }
+
+            // The defines classes are referenced by every generated class file, so any change to them affects everything
+            var definesClasses = headerDefinesClasses.SelectMany(d => d).Distinct().ToList();
+            if (previous != null && !definesClasses.SequenceEqual(previous.DefinesClasses))
+            {
+                fullRun = true;
+            }
+
+            // A previous run where two units wrote the same file depends on write order across all units
+            if (previous != null && previous.Units.SelectMany(u => u.Outputs).GroupBy(o => o, StringComparer.OrdinalIgnoreCase).Any(g => g.Count() > 1))
+            {
+                fullRun = true;
+            }
+
+            HashSet<string>? affectedUnits = null;
+            if (!fullRun)
+            {
+                affectedUnits = FindAffectedUnits(previous!, headerFiles, sourceFiles, changedHeaders, changedSources, removedInputs, missingOutputUnits, headerClasses, sourceClasses, previousInputs, headerKeys, sourceKeys);
+                _logger.LogInfo($"Incremental: {changedHeaders.Count + changedSources.Count} changed and {removedInputs.Count} removed input(s) affect {affectedUnits.Count} output unit(s)");
+            }
+            else
+            {
+                _logger.LogInfo("Incremental: no usable manifest or global change detected, converting all files");
+            }
+
+            // Select the inputs needed to regenerate the affected units
+            var neededHeaders = new List<int>();
+            var neededSources = new List<int>();
+            var affectedClasses = new HashSet<string>();
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                if (affectedUnits == null || affectedUnits.Contains(Path.GetFileNameWithoutExtension(headerFiles[i])))
+                {
+                    neededHeaders.Add(i);
+                    affectedClasses.UnionWith(headerClasses[i]);
+                }
+            }
+            for (int i = 0; i < sourceFiles.Length; i++)
+            {
+                if (affectedUnits == null ||
+                    affectedUnits.Contains(Path.GetFileNameWithoutExtension(sourceFiles[i])) ||
+                    sourceClasses[i].Any(affectedClasses.Contains))
+                {
+                    neededSources.Add(i);
+                }
+            }
+
+            ParseSelectedFiles(headerFiles, sourceFiles,
+                neededHeaders.Where(i => !headerParsed[i]).ToList(), neededSources.Where(i => !sourceParsed[i]).ToList(),
+                parsedHeaderFiles, parsedSourceFiles, headerParsed, sourceParsed, contents, maxParallelism, metrics);
+
+            // Link and generate the selected inputs, keeping the original input order
+            ConversionModel model;
+            using (metrics.MeasureStage("Link"))
+            {
+                model = LinkParsedFiles(
+                    neededHeaders.Select(i => headerFiles[i]).ToArray(), neededHeaders.Select(i => parsedHeaderFiles[i]!).ToArray(),
+                    neededSources.Select(i => sourceFiles[i]).ToArray(), neededSources.Select(i => parsedSourceFiles[i]).ToArray());
+                model.DefinesClasses.Clear();
+                model.DefinesClasses.AddRange(definesClasses);
+            }
+
+            Dictionary<string, List<string>> writtenFiles;
+            using (metrics.MeasureStage("Generate"))
+            {
+                writtenFiles = GenerateAndWriteFilesAsync(model, outputDirectory, sourceDirectory, writer, maxParallelism, affectedUnits, metrics).GetAwaiter().GetResult();
+            }
+
+            // Build the new manifest: regenerated units replace their previous entries, the rest are kept
+            var manifest = new IncrementalManifest
+            {
+                ConverterVersion = IncrementalManifest.CurrentConverterVersion,
+                Namespace = namespaceName,
+                DefinesClasses = definesClasses
+            };
+            // Quarantined inputs, and the headers of quarantined units, get no hash so the next run takes them as changed
+            var quarantined = new HashSet<string>(metrics.Quarantined.Select(q => q.Name));
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                var hash = quarantined.Contains(headerFiles[i]) || quarantined.Contains(Path.GetFileNameWithoutExtension(headerFiles[i])) ? string.Empty : headerHashes[i];
+                manifest.Inputs.Add(new ManifestInput { Path = headerKeys[i], IsHeader = true, Hash = hash, Classes = headerClasses[i], DefinesClasses = headerDefinesClasses[i] });
+            }
+            for (int i = 0; i < sourceFiles.Length; i++)
+            {
+                var hash = quarantined.Contains(sourceFiles[i]) ? string.Empty : sourceHashes[i];
+                manifest.Inputs.Add(new ManifestInput { Path = sourceKeys[i], IsHeader = false, Hash = hash, Classes = sourceClasses[i] });
+            }
+
+            if (previous != null)
+            {
+                manifest.Units.AddRange(previous.Units.Where(unit => affectedUnits != null && !affectedUnits.Contains(unit.Name)));
+            }
+            foreach (var unitFiles in writtenFiles)
+            {
+                var unitClasses = new HashSet<string>(model.HeaderFileClasses[unitFiles.Key].Select(c => c.Name));
+                var unitInputs = new List<string>();
+                unitInputs.AddRange(headerKeys.Where((key, i) => Path.GetFileNameWithoutExtension(headerFiles[i]) == unitFiles.Key));
+                unitInputs.AddRange(sourceKeys.Where((key, i) =>
+                    Path.GetFileNameWithoutExtension(sourceFiles[i]) == unitFiles.Key || sourceClasses[i].Any(unitClasses.Contains)));
+                manifest.Units.Add(new ManifestUnit { Name = unitFiles.Key, Inputs = unitInputs, Outputs = unitFiles.Value });
+            }
+
+            // Remove outputs that regenerated units no longer produce
+            if (previous != null)
+            {
+                var currentOutputs = new HashSet<string>(manifest.Units.SelectMany(u => u.Outputs), StringComparer.OrdinalIgnoreCase);
+                foreach (var staleOutput in previous.Units.SelectMany(u => u.Outputs).Where(o => !currentOutputs.Contains(o)).Distinct())
+                {
+                    var stalePath = Path.Combine(outputDirectory, staleOutput);
+                    if (File.Exists(stalePath))
+                    {
+                        _logger.LogDebug($"Removing stale C# file: {stalePath}");
+                        writer.RecordRemoved(stalePath);
+                        File.Delete(stalePath);
+                    }
+                }
+            }
+
+            // A regenerated unit that now writes a file owned by another unit makes the result order dependent
+            if (!fullRun && manifest.Units.SelectMany(u => u.Outputs).GroupBy(o => o, StringComparer.OrdinalIgnoreCase).Any(g => g.Count() > 1))
+            {
+                _logger.LogInfo("Incremental: output files are shared between units, converting all files");
+                File.Delete(manifestPath);
+                ConvertFilesIncremental(headerFiles, sourceFiles, outputDirectory, sourceDirectory, contents, writer, maxParallelism, metrics);
+                return;
+            }
+
+            // Outputs of units that were not regenerated are kept as they are
+            foreach (var output in manifest.Units.SelectMany(u => u.Outputs))
+            {
+                writer.RecordUntouched(Path.Combine(outputDirectory, output));
+            }
+
+            manifest.Save(manifestPath);
+            _lastManifest = (manifestPath, File.GetLastWriteTimeUtc(manifestPath), manifest);
+        }
+
+        private IncrementalManifest? LoadManifest(string manifestPath)
+        {
+            if (_lastManifest is { } last && last.Path == manifestPath && File.Exists(manifestPath) && File.GetLastWriteTimeUtc(manifestPath) == last.WriteTimeUtc)
+                return last.Manifest;
+
+            return IncrementalManifest.Load(manifestPath, _logger);
+        }
+
+        private string GetInputHash(string file, FileContentStore contents)
+        {
+            if (KnownInputHashes == null)
+                return contents.Get(file).Hash;
+
+            return KnownInputHashes.GetOrAdd(file, f => contents.Get(f).Hash);
+        }
+
+        /// <summary>
+        /// Determines which header file units must be regenerated for the given input changes.
+        /// Class ownership is taken from both the previous and the current symbols so that moved classes are covered.
+        /// </summary>
+        private static HashSet<string> FindAffectedUnits(IncrementalManifest previous, string[] headerFiles, string[] sourceFiles, List<int> changedHeaders, List<int> changedSources, List<ManifestInput> removedInputs, List<string> missingOutputUnits, List<string>[] headerClasses, List<string>[] sourceClasses, Dictionary<string, ManifestInput> previousInputs, string[] headerKeys, string[] sourceKeys)
+        {
+            var affectedUnits = new HashSet<string>(missingOutputUnits);
+
+            // Map class name -> units declaring it, before and after the change
+            var classUnits = new Dictionary<string, HashSet<string>>();
+            void AddClassUnit(string className, string unitName)
+            {
+                if (!classUnits.TryGetValue(className, out var units))
+                {
+                    units = new HashSet<string>();
+                    classUnits[className] = units;
+                }
+                units.Add(unitName);
+            }
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                foreach (var className in headerClasses[i])
+                    AddClassUnit(className, Path.GetFileNameWithoutExtension(headerFiles[i]));
+            }
+            foreach (var input in previous.Inputs.Where(input => input.IsHeader))
+            {
+                foreach (var className in input.Classes)
+                    AddClassUnit(className, Path.GetFileNameWithoutExtension(input.Path));
+            }
+
+            void AddUnitsImplementedBy(IEnumerable<string> classNames)
+            {
+                foreach (var className in classNames)
+                {
+                    if (classUnits.TryGetValue(className, out var units))
+                        affectedUnits.UnionWith(units);
+                }
+            }
+
+            var changedKeys = new HashSet<string>(removedInputs.Select(input => input.Path));
+            foreach (var i in changedHeaders)
+            {
+                affectedUnits.Add(Path.GetFileNameWithoutExtension(headerFiles[i]));
+                changedKeys.Add(headerKeys[i]);
+            }
+            foreach (var i in changedSources)
+            {
+                affectedUnits.Add(Path.GetFileNameWithoutExtension(sourceFiles[i]));
+                AddUnitsImplementedBy(sourceClasses[i]);
+                if (previousInputs.TryGetValue(sourceKeys[i], out var previousInput))
+                {
+                    changedKeys.Add(previousInput.Path);
+                    AddUnitsImplementedBy(previousInput.Classes);
+                }
+            }
+            foreach (var input in removedInputs)
+            {
+                affectedUnits.Add(Path.GetFileNameWithoutExtension(input.Path));
+                if (!input.IsHeader)
+                    AddUnitsImplementedBy(input.Classes);
+            }
+
+            // Units whose recorded inputs changed (covers headers that changed the classes they declare)
+            foreach (var unit in previous.Units)
+            {
+                if (unit.Inputs.Any(changedKeys.Contains))
+                    affectedUnits.Add(unit.Name);
+            }
+
+            return affectedUnits;
+        }
+
+        private void ParseSelectedFiles(string[] headerFiles, string[] sourceFiles, List<int> headerIndices, List<int> sourceIndices, List<CppClass>?[] parsedHeaderFiles, CppSourceFile?[] parsedSourceFiles, bool[] headerParsed, bool[] sourceParsed, FileContentStore contents, int maxParallelism, ConversionMetrics metrics)
+        {
+            if (headerIndices.Count == 0 && sourceIndices.Count == 0)
+                return;
+
+            List<CppClass>[] headers;
+            CppSourceFile?[] sources;
+            using (metrics.MeasureStage("Parse"))
+            {
+                (headers, sources) = ParseFiles(
+                    headerIndices.Select(i => headerFiles[i]).ToArray(),
+                    sourceIndices.Select(i => sourceFiles[i]).ToArray(),
+                    contents,
+                    maxParallelism,
+                    metrics);
+            }
+
+            for (int i = 0; i < headerIndices.Count; i++)
+            {
+                parsedHeaderFiles[headerIndices[i]] = headers[i];
+                headerParsed[headerIndices[i]] = true;
+            }
+            for (int i = 0; i < sourceIndices.Count; i++)
+            {
+                parsedSourceFiles[sourceIndices[i]] = sources[i];
+                sourceParsed[sourceIndices[i]] = true;
+            }
+        }
+
+        private static List<string> GetDefinesClassNames(List<CppClass> classes)
+        {
+            return classes
+                .Where(c => c.IsInterface && c.IsPublicExport && c.HeaderDefines.Any())
+                .Select(SymbolIndex.GetDefinesClassName)
+                .Distinct()
+                .ToList();
+        }
+
+        /// <summary>
+        /// Classes a source file contributes to; empty for skipped sources (no class methods)
+        /// </summary>
+        private static List<string> GetImplementedClassNames(CppSourceFile? sourceFile)
+        {
+            if (sourceFile == null)
+                return new List<string>();
+
+            return sourceFile.Methods.Select(m => m.ClassName)
+                .Concat(sourceFile.StaticMemberInits.Select(init => init.ClassName))
+                .Where(name => !string.IsNullOrEmpty(name))
+                .Distinct()
+                .ToList();
+        }
+
+        private static string GetManifestPath(string file, string sourceDirectory)
+        {
+            return string.IsNullOrEmpty(sourceDirectory) ? Path.GetFullPath(file) : Path.GetRelativePath(sourceDirectory, file);
+        }
+    }
+}
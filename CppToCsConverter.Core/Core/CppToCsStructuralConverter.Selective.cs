@@ -0,0 +1,114 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Conversion of specific files with <see cref="ResolveDependencies"/>: the listed files select header file units,
+    /// and a scan of the source tree finds the inputs these units need, so that only those are parsed.
+    /// By the same rule as the incremental mode a unit X needs the headers and the source named X and every source
+    /// implementing a class declared in X, which includes the source of a public interface's factory. Every generated
+    /// file also names all defines classes of the tree, so the headers that can declare one are parsed as well.
+    /// </summary>
+    public partial class CppToCsStructuralConverter
+    {
+        private void ConvertFilesSelective(string[] headerFiles, string[] sourceFiles, ISet<string> unitNames, string outputDirectory, string sourceDirectory, FileContentStore contents, OutputFileWriter writer, int maxParallelism, ConversionMetrics metrics)
+        {
+            var parsedHeaderFiles = new List<CppClass>?[headerFiles.Length];
+            var parsedSourceFiles = new CppSourceFile?[sourceFiles.Length];
+            var headerParsed = new bool[headerFiles.Length];
+            var sourceParsed = new bool[sourceFiles.Length];
+
+            // The headers of the selected units declare the classes whose implementing sources are needed
+            var unitHeaders = Enumerable.Range(0, headerFiles.Length)
+                .Where(i => unitNames.Contains(Path.GetFileNameWithoutExtension(headerFiles[i])))
+                .ToList();
+            ParseSelectedFiles(headerFiles, sourceFiles, unitHeaders, new List<int>(), parsedHeaderFiles, parsedSourceFiles, headerParsed, sourceParsed, contents, maxParallelism, metrics);
+            var unitClasses = new HashSet<string>(unitHeaders.SelectMany(i => parsedHeaderFiles[i]!).Select(c => c.Name), StringComparer.Ordinal);
+
+            // Scan: the classes every source may implement, and the other headers that may declare defines classes
+            var neededSources = new List<int>();
+            var neededUnits = new HashSet<string>(unitNames);
+            using (metrics.MeasureStage("Scan"))
+            {
+                var lexer = new CppLexer();
+                var sourceClasses = new List<string>[sourceFiles.Length];
+                var definesCandidates = new bool[headerFiles.Length];
+                var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = maxParallelism, CancellationToken = metrics.CancellationToken };
+                RunParallel(() => Parallel.For(0, headerFiles.Length + sourceFiles.Length, parallelOptions, i =>
+                {
+                    if (i < headerFiles.Length)
+                        definesCandidates[i] = !headerParsed[i] && MayDeclareDefinesClass(headerFiles[i], contents);
+                    else
+                        sourceClasses[i - headerFiles.Length] = ScanQualifyingNames(sourceFiles[i - headerFiles.Length], lexer);
+                }));
+
+                for (int i = 0; i < sourceFiles.Length; i++)
+                {
+                    if (unitNames.Contains(Path.GetFileNameWithoutExtension(sourceFiles[i])) || sourceClasses[i].Any(unitClasses.Contains))
+                    {
+                        neededSources.Add(i);
+                    }
+                }
+                for (int i = 0; i < headerFiles.Length; i++)
+                {
+                    if (definesCandidates[i])
+                    {
+                        neededUnits.Add(Path.GetFileNameWithoutExtension(headerFiles[i]));
+                    }
+                }
+            }
+
+            // Parse the remaining needed inputs, with every header of a needed unit name since a later header replaces
+            // an earlier one, and link them in input order as a conversion of the whole tree would
+            var neededHeaders = Enumerable.Range(0, headerFiles.Length)
+                .Where(i => neededUnits.Contains(Path.GetFileNameWithoutExtension(headerFiles[i])))
+                .ToList();
+            _logger.LogInfo($"Dependencies: {unitNames.Count} selected unit(s) need {neededHeaders.Count} of {headerFiles.Length} header files and {neededSources.Count} of {sourceFiles.Length} source files");
+            ParseSelectedFiles(headerFiles, sourceFiles, neededHeaders.Where(i => !headerParsed[i]).ToList(), neededSources,
+                parsedHeaderFiles, parsedSourceFiles, headerParsed, sourceParsed, contents, maxParallelism, metrics);
+
+            ConversionModel model;
+            using (metrics.MeasureStage("Link"))
+            {
+                model = LinkParsedFiles(
+                    neededHeaders.Select(i => headerFiles[i]).ToArray(), neededHeaders.Select(i => parsedHeaderFiles[i]!).ToArray(),
+                    neededSources.Select(i => sourceFiles[i]).ToArray(), neededSources.Select(i => parsedSourceFiles[i]).ToArray());
+            }
+
+            using (metrics.MeasureStage("Generate"))
+            {
+                GenerateAndWriteFilesAsync(model, outputDirectory, sourceDirectory, writer, maxParallelism, unitNames, metrics).GetAwaiter().GetResult();
+            }
+        }
+
+        /// <summary>
+        /// False if the header cannot declare a defines class: that takes an exported interface and a #define.
+        /// The content of a possible one is kept in the store for its parse. False if the file cannot be read.
+        /// </summary>
+        private static bool MayDeclareDefinesClass(string headerFile, FileContentStore contents)
+        {
+            SourceFileContent content;
+            try
+            {
+                content = contents.Get(headerFile);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                return false;
+            }
+
+            if (content.Text.Contains("__declspec(dllexport)", StringComparison.Ordinal) && content.Text.Contains("#define", StringComparison.Ordinal))
+                return true;
+
+            contents.Release(headerFile);
+            return false;
+        }
+    }
+}
@@ -0,0 +1,376 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text.RegularExpressions;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Streaming conversion for <see cref="MemoryBudgetBytes"/>. A scan of all inputs groups the header file units
+    /// that depend on each other's inputs, by the same rule as the incremental mode: a unit depends on the headers and
+    /// the source named like it and on every source implementing a class it declares. Batches of whole groups are then
+    /// parsed, linked, generated and written one after another, so only one batch's model is held at a time.
+    /// The only state kept across batches is the list of defines classes, which every file refers to, and which unit
+    /// wrote each output file, so that the file a full run writes last is still the one left behind.
+    /// </summary>
+    public partial class CppToCsStructuralConverter
+    {
+        // Peak memory per byte of input while a batch is parsed, linked and generated (measured on a 40 MB tree)
+        internal const int MemoryBytesPerInputByte = 8;
+
+        private void ConvertFilesStreaming(string[] headerFiles, string[] sourceFiles, string outputDirectory, string sourceDirectory, FileContentStore contents, OutputFileWriter writer, int maxParallelism, ConversionMetrics metrics, long memoryBudgetBytes)
+        {
+            // Scan: the classes each header declares, with its defines classes, and the classes each source may implement
+            var headerClasses = new List<string>[headerFiles.Length];
+            var headerDefinesClasses = new List<string>[headerFiles.Length];
+            var sourceClasses = new List<string>[sourceFiles.Length];
+            var inputBytes = new long[headerFiles.Length + sourceFiles.Length];
+            using (metrics.MeasureStage("Scan"))
+            {
+                var lexer = new CppLexer();
+                var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = maxParallelism, CancellationToken = metrics.CancellationToken };
+                RunParallel(() => Parallel.For(0, headerFiles.Length + sourceFiles.Length, parallelOptions, i =>
+                {
+                    if (i < headerFiles.Length)
+                    {
+                        headerClasses[i] = ScanDeclaredClassNames(headerFiles[i], contents, lexer);
+                        headerDefinesClasses[i] = new List<string>();
+                        if (MayDeclareDefinesClass(headerFiles[i], contents))
+                        {
+                            // Defines classes depend on the whole declaration, so these headers are parsed here and again in their batch
+                            // A header over the time budget is quarantined when its batch parses it
+                            if (TryParseHeader(headerFiles[i], contents, metrics.CancellationToken, out var classes, out _, out _))
+                                headerDefinesClasses[i] = GetDefinesClassNames(classes);
+                        }
+                        inputBytes[i] = GetInputLength(headerFiles[i]);
+                    }
+                    else
+                    {
+                        var sourceIndex = i - headerFiles.Length;
+                        sourceClasses[sourceIndex] = ScanQualifyingNames(sourceFiles[sourceIndex], lexer);
+                        inputBytes[i] = GetInputLength(sourceFiles[sourceIndex]);
+                    }
+                }));
+            }
+
+            // Units in the order a full run generates them: header units, then units of structs in sources without a header
+            var unitRanks = new Dictionary<string, int>();
+            int GetUnitRank(string file)
+            {
+                var unitName = Path.GetFileNameWithoutExtension(file);
+                if (!unitRanks.TryGetValue(unitName, out var rank))
+                {
+                    rank = unitRanks.Count;
+                    unitRanks.Add(unitName, rank);
+                }
+                return rank;
+            }
+            var headerUnits = headerFiles.Select(GetUnitRank).ToArray();
+            var sourceUnits = sourceFiles.Select(GetUnitRank).ToArray();
+
+            // A later header replaces an earlier one of the same name, and its defines classes with it
+            var lastHeaderOfUnit = new Dictionary<int, int>();
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                lastHeaderOfUnit[headerUnits[i]] = i;
+            }
+            var definesClasses = lastHeaderOfUnit.Values.SelectMany(i => headerDefinesClasses[i]).Distinct().ToList();
+
+            // Join the units sharing a class name, so type lookups and redeclaration warnings see every declaration,
+            // and every source with the units of the classes it implements
+            var groups = new UnitGroups(unitRanks.Count);
+            var declaringUnits = new Dictionary<string, int>(StringComparer.Ordinal);
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                foreach (var className in headerClasses[i])
+                {
+                    if (declaringUnits.TryGetValue(className, out var unit))
+                        groups.Join(unit, headerUnits[i]);
+                    else
+                        declaringUnits.Add(className, headerUnits[i]);
+                }
+            }
+            for (int i = 0; i < sourceFiles.Length; i++)
+            {
+                foreach (var className in sourceClasses[i])
+                {
+                    if (declaringUnits.TryGetValue(className, out var unit))
+                        groups.Join(unit, sourceUnits[i]);
+                }
+            }
+
+            var batches = CreateBatches(groups, headerUnits, sourceUnits, inputBytes, Math.Max(1, memoryBudgetBytes / MemoryBytesPerInputByte));
+            _logger.LogInfo($"Streaming: {groups.Count} groups of header and source files in {batches.Count} batch(es) for a memory budget of {memoryBudgetBytes / (1024 * 1024):N0} MB");
+
+            var outputWriters = new Dictionary<string, int>(OperatingSystem.IsWindows() ? StringComparer.OrdinalIgnoreCase : StringComparer.Ordinal);
+            foreach (var (headerIndices, sourceIndices) in batches)
+            {
+                var batchHeaderFiles = headerIndices.Select(i => headerFiles[i]).ToArray();
+                var batchSourceFiles = sourceIndices.Select(i => sourceFiles[i]).ToArray();
+
+                List<CppClass>[] parsedHeaderFiles;
+                CppSourceFile?[] parsedSourceFiles;
+                using (metrics.MeasureStage("Parse"))
+                {
+                    (parsedHeaderFiles, parsedSourceFiles) = ParseFiles(batchHeaderFiles, batchSourceFiles, contents, maxParallelism, metrics);
+                }
+
+                ConversionModel model;
+                using (metrics.MeasureStage("Link"))
+                {
+                    model = LinkParsedFiles(batchHeaderFiles, parsedHeaderFiles, batchSourceFiles, parsedSourceFiles);
+                    model.DefinesClasses.Clear();
+                    model.DefinesClasses.AddRange(definesClasses);
+                }
+
+                using (metrics.MeasureStage("Generate"))
+                {
+                    WriteStreamedFilesAsync(model, outputDirectory, sourceDirectory, writer, maxParallelism, unitRanks, outputWriters, metrics).GetAwaiter().GetResult();
+                }
+
+                // The garbage collector sizes its heap by the allocation rate, not by what is still reachable, and would let
+                // the released models of several batches pile up before collecting them
+                if (GC.GetTotalMemory(forceFullCollection: false) > memoryBudgetBytes)
+                {
+                    GC.Collect();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Generates and writes the units of one batch in order. A file already written by a unit that a full run
+        /// generates later (in an earlier batch) is not overwritten, since in a full run that unit's file is the last one.
+        /// </summary>
+        private async Task WriteStreamedFilesAsync(ConversionModel model, string outputDirectory, string sourceDirectory, OutputFileWriter writer, int maxParallelism, Dictionary<string, int> unitRanks, Dictionary<string, int> outputWriters, ConversionMetrics metrics)
+        {
+            await foreach (var (unitName, generatedFiles) in GenerateFilesAsync(model, outputDirectory, sourceDirectory, maxParallelism, null, metrics, metrics.CancellationToken).ConfigureAwait(false))
+            {
+                var rank = unitRanks[unitName];
+                foreach (var generatedFile in generatedFiles)
+                {
+                    if (outputWriters.TryGetValue(generatedFile.FilePath, out var writerRank) && writerRank > rank)
+                    {
+                        _logger.LogDebug($"Keeping C# file {generatedFile.FileName}.cs of a later unit");
+                        continue;
+                    }
+                    outputWriters[generatedFile.FilePath] = rank;
+                    await WriteFileToDirectoryAsync(generatedFile, writer).ConfigureAwait(false);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Packs the groups, in the order of their first unit, into batches of about the given input size; a larger
+        /// group is a batch of its own. Each batch lists its header and source files in input order.
+        /// </summary>
+        private static List<(List<int> Headers, List<int> Sources)> CreateBatches(UnitGroups groups, int[] headerUnits, int[] sourceUnits, long[] inputBytes, long batchInputBytes)
+        {
+            // Group of each unit, numbered in order of first unit
+            var groupNumbers = new Dictionary<int, int>();
+            var unitGroupNumbers = new int[groups.UnitCount];
+            for (int unit = 0; unit < groups.UnitCount; unit++)
+            {
+                var root = groups.Find(unit);
+                if (!groupNumbers.TryGetValue(root, out var number))
+                {
+                    number = groupNumbers.Count;
+                    groupNumbers.Add(root, number);
+                }
+                unitGroupNumbers[unit] = number;
+            }
+
+            var groupBytes = new long[groupNumbers.Count];
+            for (int i = 0; i < headerUnits.Length; i++)
+            {
+                groupBytes[unitGroupNumbers[headerUnits[i]]] += inputBytes[i];
+            }
+            for (int i = 0; i < sourceUnits.Length; i++)
+            {
+                groupBytes[unitGroupNumbers[sourceUnits[i]]] += inputBytes[headerUnits.Length + i];
+            }
+
+            var groupBatches = new int[groupBytes.Length];
+            int batchCount = 0;
+            long bytesInBatch = 0;
+            for (int group = 0; group < groupBytes.Length; group++)
+            {
+                if (group > 0 && bytesInBatch + groupBytes[group] > batchInputBytes)
+                {
+                    batchCount++;
+                    bytesInBatch = 0;
+                }
+                groupBatches[group] = batchCount;
+                bytesInBatch += groupBytes[group];
+            }
+
+            var batches = new List<(List<int> Headers, List<int> Sources)>();
+            for (int batch = 0; batch <= batchCount && groupBytes.Length > 0; batch++)
+            {
+                batches.Add((new List<int>(), new List<int>()));
+            }
+            for (int i = 0; i < headerUnits.Length; i++)
+            {
+                batches[groupBatches[unitGroupNumbers[headerUnits[i]]]].Headers.Add(i);
+            }
+            for (int i = 0; i < sourceUnits.Length; i++)
+            {
+                batches[groupBatches[unitGroupNumbers[sourceUnits[i]]]].Sources.Add(i);
+            }
+            return batches;
+        }
+
+        /// <summary>
+        /// Names directly before "::" in a source file: every class whose methods or static members the source can
+        /// implement, plus some namespaces and enums. Empty if the file cannot be read; its parse reports the error.
+        /// </summary>
+        private static List<string> ScanQualifyingNames(string sourceFile, CppLexer lexer)
+        {
+            CppTokenStream tokens;
+            try
+            {
+                tokens = lexer.Tokenize(SourceFileContent.Read(sourceFile).Text);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                return new List<string>();
+            }
+
+            var names = new HashSet<string>(StringComparer.Ordinal);
+            for (int i = 1; i < tokens.Count; i++)
+            {
+                if (tokens.IsScopeOperator(i) && tokens[i - 1].Kind == CppTokenKind.Identifier)
+                {
+                    names.Add(tokens.GetPooledText(i - 1));
+                }
+            }
+            return names.ToList();
+        }
+
+        /// <summary>
+        /// Names of the classes and structs a header may declare, a superset of those its parse finds: the name after
+        /// every "class" or "struct", also in comments, strings and directives since the header parser reads lines,
+        /// and the name after the closing brace of a typedef. Empty if the file cannot be read; its parse reports the error.
+        /// The content is kept in the store for <see cref="MayDeclareDefinesClass"/>.
+        /// </summary>
+        internal static List<string> ScanDeclaredClassNames(string headerFile, FileContentStore contents, CppLexer lexer)
+        {
+            CppTokenStream tokens;
+            try
+            {
+                tokens = lexer.Tokenize(contents.Get(headerFile).Text);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                return new List<string>();
+            }
+
+            bool IsIdentifierAt(int index) => index < tokens.Count && tokens[index].Kind == CppTokenKind.Identifier;
+            bool IsPunctuationAt(int index, char value) => index < tokens.Count && tokens.IsPunctuation(index, value);
+
+            var names = new HashSet<string>(StringComparer.Ordinal);
+            for (int i = 0; i < tokens.Count; i++)
+            {
+                switch (tokens[i].Kind)
+                {
+                    case CppTokenKind.Identifier:
+                        // The header parser matches "class" and "struct" at the end of any word
+                        var keyword = tokens.GetSpan(i);
+                        if (!keyword.EndsWith("class", StringComparison.Ordinal) && !keyword.EndsWith("struct", StringComparison.Ordinal))
+                            break;
+
+                        var next = i + 1;
+                        if (IsIdentifierAt(next) && tokens.IsIdentifier(next, "__declspec") && IsPunctuationAt(next + 1, '(') && tokens.GetMatchingParenthesis(next + 1) >= 0)
+                        {
+                            next = tokens.GetMatchingParenthesis(next + 1) + 1;
+                        }
+                        if (IsIdentifierAt(next))
+                        {
+                            names.Add(tokens.GetPooledText(next));
+                        }
+                        else if (i > 0 && tokens.IsIdentifier(i - 1, "typedef") && IsPunctuationAt(next, '{'))
+                        {
+                            // An unnamed typedef struct keeps the parser's placeholder name when its closing brace names none
+                            var close = tokens.GetMatchingBrace(next);
+                            if (close < 0 || !IsIdentifierAt(close + 1) || !IsPunctuationAt(close + 2, ';'))
+                                names.Add("UnnamedStruct");
+                        }
+                        break;
+                    case CppTokenKind.Punctuation:
+                        // "} Name;" closing a typedef
+                        if (tokens.IsPunctuation(i, '}') && IsIdentifierAt(i + 1) && IsPunctuationAt(i + 2, ';'))
+                        {
+                            names.Add(tokens.GetPooledText(i + 1));
+                        }
+                        break;
+                    case CppTokenKind.LineComment:
+                    case CppTokenKind.BlockComment:
+                    case CppTokenKind.StringLiteral:
+                    case CppTokenKind.Preprocessor:
+                        var text = tokens.GetSpan(i);
+                        if (text.Contains("class", StringComparison.Ordinal) || text.Contains("struct", StringComparison.Ordinal))
+                        {
+                            foreach (Match match in CppPatterns.ClassDeclaration().Matches(tokens.GetText(i)))
+                            {
+                                names.Add(match.Groups[1].Value);
+                            }
+                        }
+                        break;
+                }
+            }
+            return names.ToList();
+        }
+
+        private static long GetInputLength(string file)
+        {
+            var info = new FileInfo(file);
+            return info.Exists ? info.Length : 0;
+        }
+
+        /// <summary>
+        /// Disjoint sets of unit ranks (union-find with path halving)
+        /// </summary>
+        private sealed class UnitGroups
+        {
+            private readonly int[] _parents;
+
+            public UnitGroups(int unitCount)
+            {
+                _parents = Enumerable.Range(0, unitCount).ToArray();
+                Count = unitCount;
+            }
+
+            public int UnitCount => _parents.Length;
+
+            /// <summary>
+            /// Number of groups
+            /// </summary>
+            public int Count { get; private set; }
+
+            public int Find(int unit)
+            {
+                while (_parents[unit] != unit)
+                {
+                    _parents[unit] = _parents[_parents[unit]];
+                    unit = _parents[unit];
+                }
+                return unit;
+            }
+
+            public void Join(int first, int second)
+            {
+                var firstRoot = Find(first);
+                var secondRoot = Find(second);
+                if (firstRoot != secondRoot)
+                {
+                    _parents[Math.Max(firstRoot, secondRoot)] = Math.Min(firstRoot, secondRoot);
+                    Count--;
+                }
+            }
+        }
+    }
+}
@@ -1,34 +1,113 @@
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.IO;
 using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Runtime.ExceptionServices;
 using System.Text;
 using System.Text.RegularExpressions;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using CppToCsConverter.Core.Logging;
 using CppToCsConverter.Core.Models;
 using CppToCsConverter.Core.Parsers;
 using CppToCsConverter.Core.Generators;
+using CppToCsConverter.Core.Utils;
 
 namespace CppToCsConverter.Core.Core
 {
-    public class CppToCsStructuralConverter
+    public partial class CppToCsStructuralConverter
     {
         private readonly CppHeaderParser _headerParser;
         private readonly CppSourceParser _sourceParser;
         private readonly CsClassGenerator _classGenerator;
         private readonly CsInterfaceGenerator _interfaceGenerator;
+        private readonly ILogger _logger;
+        private ParsedModelCache? _parseCache;
 
-        public CppToCsStructuralConverter()
+        /// <param name="logger">Receives all progress, warning and error output; defaults to the console at normal verbosity</param>
+        public CppToCsStructuralConverter(ILogger? logger = null)
         {
-            _headerParser = new CppHeaderParser();
-            _sourceParser = new CppSourceParser();
-            _classGenerator = new CsClassGenerator();
+            _logger = logger ?? new ConsoleLogger();
+            var parserLogger = new ParserLogger(_logger);
+            _headerParser = new CppHeaderParser(parserLogger);
+            _sourceParser = new CppSourceParser(parserLogger, _headerParser);
+            _classGenerator = new CsClassGenerator(_logger);
             _interfaceGenerator = new CsInterfaceGenerator();
         }
 
+        /// <summary>
+        /// Maximum number of files parsed or generated concurrently, and of chunks of one very large source file
+        /// parsed concurrently. Values below 1 are treated as 1 (sequential).
+        /// The generated output is identical regardless of this setting.
+        /// </summary>
+        public int MaxDegreeOfParallelism { get; set; } = Environment.ProcessorCount;
+
+        /// <summary>
+        /// When true, a manifest of input hashes is kept in the output directory and reruns only parse
+        /// changed inputs (plus the files linked to them) and regenerate the affected output files.
+        /// </summary>
+        public bool Incremental { get; set; }
+
+        /// <summary>
+        /// Stage, file and unit measurements of the last conversion run, or null before the first run
+        /// </summary>
+        public ConversionMetrics? LastMetrics { get; private set; }
+
+        /// <summary>
+        /// Directory of a persistent parse cache, or null (the default) to parse every input. With a cache, inputs
+        /// whose content was parsed before by the same converter build are loaded from it instead of parsed, and the
+        /// parse results of all other inputs are added to it. A full (non-incremental) directory conversion also
+        /// removes the entries of inputs that changed or no longer exist.
+        /// </summary>
+        public string? ParseCacheDirectory
+        {
+            get => _parseCache?.DirectoryPath;
+            set => _parseCache = value != null ? new ParsedModelCache(value, _logger) : null;
+        }
+
+        /// <summary>
+        /// Approximate memory in bytes a conversion to disk may use for its parsed model, or null (the default) to
+        /// convert all files at once. With a budget, the inputs are first scanned to group every header file unit with
+        /// the sources implementing its classes, and the groups are converted in batches that fit the budget, each
+        /// released once its files are written. The output is the same. Does not apply to <see cref="Incremental"/>
+        /// runs or in-memory conversion.
+        /// </summary>
+        public long? MemoryBudgetBytes { get; set; }
+
+        /// <summary>
+        /// When true, <see cref="ConvertSpecificFiles"/> converts the header file units of the listed files (X.h and
+        /// X.cpp select unit X) with their context from the rest of the source directory: the sources implementing
+        /// their classes and the headers that can declare defines classes are found by a scan of the tree, and only
+        /// they are parsed. Only the selected units are written, as a conversion of the whole directory would write
+        /// them. Takes precedence over <see cref="Incremental"/> and
+        /// <see cref="MemoryBudgetBytes"/> for those conversions.
+        /// </summary>
+        public bool ResolveDependencies { get; set; }
+
+        /// <summary>
+        /// Longest time the parse of one input file or the generation of one header file unit may take, or null
+        /// (the default) for no limit. An input over budget is quarantined: it is converted as if it were empty, and its
+        /// parse is left to finish in the background on its own copy of the content, without caching or logging.
+        /// A unit over budget is not written: the other units are generated meanwhile, and the run waits for its
+        /// generation to end before returning, since it works on the run's model. Either way it is listed in
+        /// <see cref="ConversionMetrics.Quarantined"/>.
+        /// </summary>
+        public TimeSpan? FileTimeBudget { get; set; }
+
+        internal ILogger Logger => _logger;
+
         public void ConvertDirectory(string sourceDirectory, string outputDirectory)
         {
-            Console.WriteLine($"Converting C++ files from: {sourceDirectory}");
-            Console.WriteLine($"Output directory: {outputDirectory}");
+            ConvertDirectory(sourceDirectory, outputDirectory, new ConversionMetrics());
+        }
+
+        private void ConvertDirectory(string sourceDirectory, string outputDirectory, ConversionMetrics metrics)
+        {
+            _logger.LogInfo($"Converting C++ files from: {sourceDirectory}");
+            _logger.LogInfo($"Output directory: {outputDirectory}");
 
             // Ensure output directory exists
             if (!Directory.Exists(outputDirectory))
@@ -36,18 +115,55 @@ namespace CppToCsConverter.Core.Core
                 Directory.CreateDirectory(outputDirectory);
             }
 
-            // Find all .h and .cpp files
-            var headerFiles = Directory.GetFiles(sourceDirectory, "*.h", SearchOption.AllDirectories);
-            var sourceFiles = Directory.GetFiles(sourceDirectory, "*.cpp", SearchOption.AllDirectories);
+            // Find all .h and .cpp files in a single walk of the source tree
+            var (headerFiles, sourceFiles) = FindSourceTreeFiles(sourceDirectory);
+
+            ConvertFiles(headerFiles, sourceFiles, outputDirectory, sourceDirectory, unitNames: null, metrics);
+
+            // Every input of the tree was parsed or loaded, so entries not used in this run are stale
+            if (_parseCache != null && !Incremental)
+            {
+                var removed = _parseCache.RemoveUnusedEntries();
+                _logger.LogDebug($"Removed {removed} stale parse cache entries");
+            }
+        }
+
+        /// <summary>
+        /// Enumerates the source tree once and splits the result into header and source files,
+        /// keeping the enumeration order and the platform's file name case sensitivity.
+        /// </summary>
+        internal static (string[] HeaderFiles, string[] SourceFiles) FindSourceTreeFiles(string sourceDirectory)
+        {
+            var comparison = OperatingSystem.IsWindows() ? StringComparison.OrdinalIgnoreCase : StringComparison.Ordinal;
+            var headerFiles = new List<string>();
+            var sourceFiles = new List<string>();
+
+            foreach (var file in Directory.EnumerateFiles(sourceDirectory, "*", SearchOption.AllDirectories))
+            {
+                var extension = Path.GetExtension(file);
+                if (extension.Equals(".h", comparison))
+                {
+                    headerFiles.Add(file);
+                }
+                else if (extension.Equals(".cpp", comparison))
+                {
+                    sourceFiles.Add(file);
+                }
+            }
 
-            ConvertFiles(headerFiles, sourceFiles, outputDirectory, sourceDirectory);
+            return (headerFiles.ToArray(), sourceFiles.ToArray());
         }
 
         public void ConvertSpecificFiles(string sourceDirectory, string[] fileNames, string outputDirectory)
         {
-            Console.WriteLine($"Converting specific C++ files from: {sourceDirectory}");
-            Console.WriteLine($"Files to convert: {string.Join(", ", fileNames)}");
-            Console.WriteLine($"Output directory: {outputDirectory}");
+            ConvertSpecificFiles(sourceDirectory, fileNames, outputDirectory, new ConversionMetrics());
+        }
+
+        private void ConvertSpecificFiles(string sourceDirectory, string[] fileNames, string outputDirectory, ConversionMetrics metrics)
+        {
+            _logger.LogInfo($"Converting specific C++ files from: {sourceDirectory}");
+            _logger.LogInfo($"Files to convert: {string.Join(", ", fileNames)}");
+            _logger.LogInfo($"Output directory: {outputDirectory}");
 
             // Ensure output directory exists
             if (!Directory.Exists(outputDirectory))
@@ -64,7 +180,7 @@ namespace CppToCsConverter.Core.Core
                 var fullPath = Path.Combine(sourceDirectory, fileName);
                 if (!File.Exists(fullPath))
                 {
-                    Console.WriteLine($"Warning: File '{fileName}' not found in '{sourceDirectory}'");
+                    _logger.LogWarning($"Warning: File '{fileName}' not found in '{sourceDirectory}'");
                     continue;
                 }
 
@@ -79,109 +195,322 @@ namespace CppToCsConverter.Core.Core
                 }
                 else
                 {
-                    Console.WriteLine($"Warning: Unsupported file type '{extension}' for file '{fileName}'");
+                    _logger.LogWarning($"Warning: Unsupported file type '{extension}' for file '{fileName}'");
                 }
             }
 
-            ConvertFiles(headerFiles.ToArray(), sourceFiles.ToArray(), outputDirectory, sourceDirectory);
+            if (ResolveDependencies)
+            {
+                // The listed files only select the units; their inputs are found in the whole tree
+                var unitNames = new HashSet<string>(headerFiles.Concat(sourceFiles).Select(f => Path.GetFileNameWithoutExtension(f)));
+                var (treeHeaderFiles, treeSourceFiles) = FindSourceTreeFiles(sourceDirectory);
+                ConvertFiles(treeHeaderFiles, treeSourceFiles, outputDirectory, sourceDirectory, unitNames, metrics);
+                return;
+            }
+
+            ConvertFiles(headerFiles.ToArray(), sourceFiles.ToArray(), outputDirectory, sourceDirectory, unitNames: null, metrics);
         }
 
+        /// <summary>
+        /// Converts the given files as a staged pipeline:
+        /// parse (parallel, per file) -> link (sequential) -> generate (parallel, per header file) -> write (ordered).
+        /// Parse results are stored by input position and generated files are written in header order,
+        /// so the output is byte-identical to a sequential run however the work is scheduled.
+        /// </summary>
         public void ConvertFiles(string[] headerFiles, string[] sourceFiles, string outputDirectory, string sourceDirectory = "")
         {
-            Console.WriteLine($"Found {headerFiles.Length} header files and {sourceFiles.Length} source files");
-            Console.WriteLine($"Output directory path: '{outputDirectory}'");
+            ConvertFiles(headerFiles, sourceFiles, outputDirectory, sourceDirectory, unitNames: null, new ConversionMetrics());
+        }
+
+        /// <param name="unitNames">Header file units to convert with the inputs they need, or null to convert all inputs</param>
+        /// <param name="metrics">Receives the measurements of the run and carries its cancellation token and progress receiver</param>
+        private void ConvertFiles(string[] headerFiles, string[] sourceFiles, string outputDirectory, string sourceDirectory, ISet<string>? unitNames, ConversionMetrics metrics)
+        {
+            _logger.LogInfo($"Found {headerFiles.Length} header files and {sourceFiles.Length} source files");
+            _logger.LogDebug($"Output directory path: '{outputDirectory}'");
             
             // Ensure output directory exists
             try
             {
                 if (!Directory.Exists(outputDirectory))
                 {
-                    Console.WriteLine($"Creating output directory: {outputDirectory}");
+                    _logger.LogDebug($"Creating output directory: {outputDirectory}");
                     Directory.CreateDirectory(outputDirectory);
                 }
                 else
                 {
-                    Console.WriteLine($"Output directory already exists: {outputDirectory}");
+                    _logger.LogDebug($"Output directory already exists: {outputDirectory}");
                 }
             }
             catch (Exception ex)
             {
-                Console.WriteLine($"Error creating output directory: {ex.Message}");
+                _logger.LogError($"Error creating output directory: {ex.Message}");
                 throw;
             }
 
-            // Parse all files
-            var parsedHeaders = new Dictionary<string, CppClass>();
-            var parsedSources = new Dictionary<string, List<CppMethod>>();
-            var staticMemberInits = new Dictionary<string, List<CppStaticMemberInit>>();
+            var maxParallelism = Math.Max(1, MaxDegreeOfParallelism);
+            var startTimestamp = Stopwatch.GetTimestamp();
+            var startAllocatedBytes = GC.GetTotalAllocatedBytes();
+            LastMetrics = metrics;
 
-            // Parse header files
-            var headerFileClasses = new Dictionary<string, List<CppClass>>();
-            
-            foreach (var headerFile in headerFiles)
+            var contents = new FileContentStore();
+            var writer = new OutputFileWriter();
+            _parseCache?.BeginRun();
+            if (unitNames != null)
             {
-                Console.WriteLine($"Parsing header: {Path.GetFileName(headerFile)}");
-                var classes = _headerParser.ParseHeaderFile(headerFile);
+                ConvertFilesSelective(headerFiles, sourceFiles, unitNames, outputDirectory, sourceDirectory, contents, writer, maxParallelism, metrics);
+            }
+            else if (Incremental)
+            {
+                ConvertFilesIncremental(headerFiles, sourceFiles, outputDirectory, sourceDirectory, contents, writer, maxParallelism, metrics);
+            }
+            else if (MemoryBudgetBytes is long memoryBudgetBytes)
+            {
+                ConvertFilesStreaming(headerFiles, sourceFiles, outputDirectory, sourceDirectory, contents, writer, maxParallelism, metrics, memoryBudgetBytes);
+            }
+            else
+            {
+                // Stage 1: parse all files
+                List<CppClass>[] parsedHeaderFiles;
+                CppSourceFile?[] parsedSourceFiles;
+                using (metrics.MeasureStage("Parse"))
+                {
+                    (parsedHeaderFiles, parsedSourceFiles) = ParseFiles(headerFiles, sourceFiles, contents, maxParallelism, metrics);
+                }
+
+                // Stage 2: link parse results into one model
+                ConversionModel model;
+                using (metrics.MeasureStage("Link"))
+                {
+                    model = LinkParsedFiles(headerFiles, parsedHeaderFiles, sourceFiles, parsedSourceFiles);
+                }
+
+                // Stage 3 and 4: generate C# files and write them in deterministic order
+                using (metrics.MeasureStage("Generate"))
+                {
+                    GenerateAndWriteFilesAsync(model, outputDirectory, sourceDirectory, writer, maxParallelism, null, metrics).GetAwaiter().GetResult();
+                }
+            }
+            SaveChangeManifest(writer, outputDirectory);
+            metrics.Complete(Stopwatch.GetElapsedTime(startTimestamp), GC.GetTotalAllocatedBytes() - startAllocatedBytes);
+
+            _logger.LogInfo($"Conversion completed in {metrics.TotalMilliseconds:F0} ms: {metrics.Files.Count} files parsed, {metrics.TotalClasses} classes, {metrics.TotalMethods} methods");
+            if (_parseCache != null)
+            {
+                _logger.LogDebug($"  Parse cache: {metrics.CachedFiles} of {metrics.Files.Count} files loaded from {_parseCache.DirectoryPath}");
+            }
+            foreach (var stage in metrics.Stages)
+            {
+                _logger.LogDebug($"  {stage.Name}: {stage.Milliseconds:F0} ms, {stage.AllocatedBytes / 1024:N0} KB allocated");
+            }
+            _logger.LogDebug($"  Normalization caches: {string.Join(", ", metrics.NormalizationCaches.Select(c => $"{c.Name} {c.HitRate:P0} of {c.Hits + c.Misses:N0}"))}");
+        }
+
+        /// <summary>
+        /// Parses headers and sources in parallel. Results are returned in slots matching the input arrays;
+        /// a null source slot means the file was parsed but has no class methods and is skipped.
+        /// Each file's content is taken from the store, so a file hashed earlier in the run is not read again.
+        /// With a parse cache, files whose content is in the cache are loaded from it and all others are added to it.
+        /// A file whose parse exceeds <see cref="FileTimeBudget"/> is quarantined and its slot is left as if it were empty.
+        /// </summary>
+        /// <param name="metrics">Receives a measurement per file in input order, or null to skip measuring</param>
+        internal (List<CppClass>[] Headers, CppSourceFile?[] Sources) ParseFiles(string[] headerFiles, string[] sourceFiles, FileContentStore contents, int maxParallelism, ConversionMetrics? metrics = null)
+        {
+            var parsedHeaderFiles = new List<CppClass>[headerFiles.Length];
+            var parsedSourceFiles = new CppSourceFile?[sourceFiles.Length];
+            var fileMetrics = metrics != null ? new FileMetrics[headerFiles.Length + sourceFiles.Length] : null;
+            var cancellationToken = metrics?.CancellationToken ?? CancellationToken.None;
+            var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = maxParallelism, CancellationToken = cancellationToken };
+            var total = headerFiles.Length + sourceFiles.Length;
+            var completed = 0;
+            _sourceParser.MaxDegreeOfParallelism = maxParallelism;
+
+            RunParallel(() => Parallel.For(0, total, parallelOptions, i =>
+            {
+                var filePath = i < headerFiles.Length ? headerFiles[i] : sourceFiles[i - headerFiles.Length];
+                FileMetrics measured;
+                if (i < headerFiles.Length)
+                {
+                    (parsedHeaderFiles[i], measured) = ParseHeaderMeasured(filePath, contents, cancellationToken, metrics);
+                }
+                else
+                {
+                    (parsedSourceFiles[i - headerFiles.Length], measured) = ParseSourceMeasured(filePath, contents, cancellationToken, metrics);
+                }
+
+                if (fileMetrics != null)
+                {
+                    fileMetrics[i] = measured;
+                    metrics!.Report(new ConversionProgress(ConversionProgressKind.FileParsed, "Parse", filePath, Interlocked.Increment(ref completed), total, measured.ParseMilliseconds));
+                }
+            }));
+
+            metrics?.AddFiles(fileMetrics!);
+            return (parsedHeaderFiles, parsedSourceFiles);
+        }
+
+        /// <summary>
+        /// Parses a header like <see cref="TryParseHeader"/>; a header whose parse exceeds <see cref="FileTimeBudget"/> is
+        /// quarantined and has no classes
+        /// </summary>
+        private (List<CppClass> Classes, FileMetrics Metrics) ParseHeaderMeasured(string headerFile, FileContentStore contents, CancellationToken cancellationToken, ConversionMetrics? metrics)
+        {
+            var measurement = ConversionMetrics.MeasureFile();
+            if (!TryParseHeader(headerFile, contents, cancellationToken, out var classes, out var fromCache, out var parseAllocatedBytes))
+                return (new List<CppClass>(), QuarantineFile(headerFile, "header", metrics));
+
+            var measured = measurement.Complete(headerFile, "header", classes.Count, classes.Sum(c => c.Methods.Count),
+                classes.Sum(c => c.Methods.Count(m => !string.IsNullOrEmpty(m.HeaderRegionStart)) + c.Methods.Count(m => !string.IsNullOrEmpty(m.HeaderRegionEnd))), classes.Sum(c => c.HeaderDefines.Count), fromCache);
+            measured.AllocatedBytes += parseAllocatedBytes;
+            return (classes, measured);
+        }
+
+        /// <summary>
+        /// Parses a source, or loads it from the parse cache; the result is null if the source has no class methods,
+        /// or if its parse exceeds <see cref="FileTimeBudget"/> and it is quarantined
+        /// </summary>
+        private (CppSourceFile? SourceFile, FileMetrics Metrics) ParseSourceMeasured(string sourceFile, FileContentStore contents, CancellationToken cancellationToken, ConversionMetrics? metrics)
+        {
+            var measurement = ConversionMetrics.MeasureFile();
+            var hash = GetCacheKeyHash(sourceFile, contents);
+            var sourceFileData = hash != null ? _parseCache!.TryLoadSource(sourceFile, hash) : null;
+            var fromCache = sourceFileData != null;
+            long parseAllocatedBytes = 0;
+            if (fromCache)
+            {
+                _logger.LogDebug($"Loading source from parse cache: {Path.GetFileName(sourceFile)}");
+                contents.Release(sourceFile);
+            }
+            else
+            {
+                _logger.LogDebug($"Parsing source: {Path.GetFileName(sourceFile)}");
+                if (!TryParseWithinBudget(fileContents => _sourceParser.ParseSourceFileComplete(sourceFile, fileContents), sourceFile, contents, cancellationToken, out var parsedSource, out parseAllocatedBytes))
+                    return (null, QuarantineFile(sourceFile, "source", metrics));
+
+                sourceFileData = parsedSource;
+                if (hash != null)
+                {
+                    _parseCache!.SaveSource(sourceFile, hash, sourceFileData);
+                }
+            }
+
+            // Skip source files that have no class methods (methods with ::)
+            // These are files with only local functions, structs, or MAIN macros
+            var parsed = sourceFileData!.Methods.Any(m => !m.IsLocalMethod) ? sourceFileData : null;
+            if (parsed != null && !fromCache)
+            {
+                CppSourceParser.CompactMethodBodies(sourceFileData);
+            }
+
+            var measured = measurement.Complete(sourceFile, "source", sourceFileData.Structs.Count, sourceFileData.Methods.Count,
+                sourceFileData.Regions.Count, sourceFileData.Defines.Count, fromCache);
+            measured.AllocatedBytes += parseAllocatedBytes;
+            return (parsed, measured);
+        }
+
+        /// <summary>
+        /// Parses a header within <see cref="FileTimeBudget"/>, or loads its classes from the parse cache if its content is there;
+        /// false if the parse exceeded the budget. Only a parse that completed in time is added to the parse cache.
+        /// </summary>
+        private bool TryParseHeader(string headerFile, FileContentStore contents, CancellationToken cancellationToken, out List<CppClass> classes, out bool fromCache, out long parseAllocatedBytes)
+        {
+            parseAllocatedBytes = 0;
+            var hash = GetCacheKeyHash(headerFile, contents);
+            var cached = hash != null ? _parseCache!.TryLoadHeader(headerFile, hash) : null;
+            fromCache = cached != null;
+            if (cached != null)
+            {
+                _logger.LogDebug($"Loading header from parse cache: {Path.GetFileName(headerFile)}");
+                contents.Release(headerFile);
+                classes = cached;
+                return true;
+            }
+
+            _logger.LogDebug($"Parsing header: {Path.GetFileName(headerFile)}");
+            if (!TryParseWithinBudget(fileContents => _headerParser.ParseHeaderFile(headerFile, fileContents), headerFile, contents, cancellationToken, out classes, out parseAllocatedBytes))
+                return false;
+
+            if (hash != null)
+            {
+                _parseCache!.SaveHeader(headerFile, hash, classes);
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Content hash that keys a file's parse cache entry, or null without a cache or if the file cannot be read
+        /// (the parser then reports the error and the result is not cached)
+        /// </summary>
+        private string? GetCacheKeyHash(string filePath, FileContentStore contents)
+        {
+            if (_parseCache == null)
+                return null;
+
+            try
+            {
+                return contents.Get(filePath).Hash;
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Combines per-file parse results into a <see cref="ConversionModel"/>, visiting files in input order
+        /// so later headers overwrite earlier ones exactly as in a sequential run.
+        /// </summary>
+        internal ConversionModel LinkParsedFiles(string[] headerFiles, List<CppClass>[] parsedHeaderFiles, string[] sourceFiles, CppSourceFile?[] parsedSourceFiles)
+        {
+            var model = new ConversionModel();
+            var headerFileClasses = model.HeaderFileClasses;
+
+            for (int i = 0; i < headerFiles.Length; i++)
+            {
+                var headerFile = headerFiles[i];
+                var classes = parsedHeaderFiles[i];
                 var fileName = Path.GetFileNameWithoutExtension(headerFile);
                 
+                if (headerFileClasses.ContainsKey(fileName))
+                {
+                    _logger.LogWarning($"Warning: {headerFile} replaces an earlier header named {fileName}.h; only the later one is converted");
+                }
                 headerFileClasses[fileName] = classes;
                 
                 // Log what we found (classes and structs are now unified)
                 foreach (var cppClass in classes)
                 {
-                    parsedHeaders[cppClass.Name] = cppClass;
                     var type = cppClass.IsInterface ? "interface" : (cppClass.IsStruct ? "struct" : "class");
-                    Console.WriteLine($"Found {type}: {cppClass.Name} in {Path.GetFileName(headerFile)}");
+                    _logger.LogDebug($"Found {type}: {cppClass.Name} in {Path.GetFileName(headerFile)}");
                 }
             }
 
-            // Parse source files with complete file data including top comments
-            var sourceDefines = new Dictionary<string, List<CppDefine>>();
-            var sourceFileTopComments = new Dictionary<string, List<string>>();
+            // Source files with complete file data including top comments
             var sourceStructs = new Dictionary<string, List<CppStruct>>();
-            var sourceRegions = new Dictionary<string, List<CppRegion>>();
-            foreach (var sourceFile in sourceFiles)
+            for (int i = 0; i < sourceFiles.Length; i++)
             {
-                Console.WriteLine($"Parsing source: {Path.GetFileName(sourceFile)}");
-                var sourceFileData = _sourceParser.ParseSourceFileComplete(sourceFile);
+                var sourceFile = sourceFiles[i];
+                var sourceFileData = parsedSourceFiles[i];
                 
-                // Skip source files that have no class methods (methods with ::)
-                // These are files with only local functions, structs, or MAIN macros
-                var hasClassMethods = sourceFileData.Methods.Any(m => !m.IsLocalMethod);
-                if (!hasClassMethods)
+                if (sourceFileData == null)
                 {
-                    Console.WriteLine($"Skipping {Path.GetFileName(sourceFile)} - no class methods found (only local functions/structs)");
+                    _logger.LogDebug($"Skipping {Path.GetFileName(sourceFile)} - no class methods found (only local functions/structs)");
                     continue;
                 }
                 
                 var fileName = Path.GetFileNameWithoutExtension(sourceFile);
-                parsedSources[fileName] = sourceFileData.Methods;
-                staticMemberInits[fileName] = sourceFileData.StaticMemberInits;
-                sourceDefines[fileName] = sourceFileData.Defines;
-                sourceFileTopComments[fileName] = sourceFileData.FileTopComments;
+                model.ParsedSources[fileName] = sourceFileData.Methods;
+                model.StaticMemberInits[fileName] = sourceFileData.StaticMemberInits;
+                model.SourceDefines[fileName] = sourceFileData.Defines;
+                model.SourceFileTopComments[fileName] = sourceFileData.FileTopComments;
                 sourceStructs[fileName] = sourceFileData.Structs;
-                sourceRegions[fileName] = sourceFileData.Regions;
+                model.SourceRegions[fileName] = sourceFileData.Regions;
                 
                 // Log found structs
                 foreach (var structDef in sourceFileData.Structs)
                 {
-                    Console.WriteLine($"Found struct: {structDef.Name} in {Path.GetFileName(sourceFile)} (Count: {sourceFileData.Structs.Count})");
+                    _logger.LogDebug($"Found struct: {structDef.Name} in {Path.GetFileName(sourceFile)} (Count: {sourceFileData.Structs.Count})");
                 }
-                
-                // Parse source file methods
-                foreach (var method in sourceFileData.Methods)
-                {
-                    if (method.Name == "GetRate")
-                    {
-                        Console.WriteLine($"  Found GetRate in {fileName} with {method.Parameters.Count} parameters");
-                        foreach (var param in method.Parameters)
-                        {
-                            Console.WriteLine($"    Param: {param.Name}, PositionedComments: {param.PositionedComments?.Count ?? 0}");
-                        }
-                    }
-                }
-                
-
             }
 
             // Add structs from source files to the header file classes (so they get generated)
@@ -224,57 +553,216 @@ namespace CppToCsConverter.Core.Core
                 }
             }
 
-            // Generate C# files - one per header file containing all its classes (including structs as classes)
-            var generatedDefinesClasses = new List<string>(); // Track generated defines classes
-            
-            // First pass: identify all defines classes that will be generated
-            foreach (var headerFileKvp in headerFileClasses)
+            // Index source methods by class and signature, and types by name, for the generation stage
+            model.BuildIndexes();
+            foreach (var (className, firstHeader, secondHeader) in model.Symbols.Redeclarations)
             {
-                var fileName = headerFileKvp.Key;
-                var classes = headerFileKvp.Value;
-                
-                if (classes.Count == 0)
-                    continue;
-                    
-                // Check if this file contains a public interface with defines
-                var publicInterfacesWithDefines = classes
-                    .Where(c => c.IsInterface && c.IsPublicExport && c.HeaderDefines.Any())
-                    .ToList();
-                
-                foreach (var interfaceClass in publicInterfacesWithDefines)
+                _logger.LogWarning($"Warning: {className} is declared in both {firstHeader}.h and {secondHeader}.h; {secondHeader}.h is used to resolve it");
+            }
+
+            // Every file references the defines classes that will be generated
+            model.DefinesClasses.AddRange(model.Symbols.DefinesClasses);
+
+            return model;
+        }
+
+        /// <summary>
+        /// Generates one C# file per header file (plus defines and partial files) in parallel and writes them in header order.
+        /// The writer is one consumer of <see cref="GenerateFilesAsync"/>.
+        /// </summary>
+        /// <param name="unitNames">Header file units to generate, or null for all of them</param>
+        /// <param name="metrics">Receives the generation time of each unit in write order, or null to skip measuring</param>
+        /// <returns>The names of the files written for each generated unit</returns>
+        internal async Task<Dictionary<string, List<string>>> GenerateAndWriteFilesAsync(ConversionModel model, string outputDirectory, string sourceDirectory, OutputFileWriter writer, int maxParallelism, ISet<string>? unitNames = null, ConversionMetrics? metrics = null)
+        {
+            var writtenFiles = new Dictionary<string, List<string>>();
+
+            // Units arrive in order, so files are written exactly as a sequential run would (last writer wins)
+            await foreach (var (unitName, generatedFiles) in GenerateFilesAsync(model, outputDirectory, sourceDirectory, maxParallelism, unitNames, metrics, metrics?.CancellationToken ?? CancellationToken.None).ConfigureAwait(false))
+            {
+                foreach (var generatedFile in generatedFiles)
+                {
+                    await WriteFileToDirectoryAsync(generatedFile, writer).ConfigureAwait(false);
+                }
+                writtenFiles[unitName] = generatedFiles.Select(f => Path.GetFileName(f.FilePath)).ToList();
+            }
+
+            return writtenFiles;
+        }
+
+        /// <summary>
+        /// Generates the header file units in parallel and returns them in header order as each one completes.
+        /// Generation of a header unit only mutates that unit's classes, so units are independent.
+        /// A bounded channel keeps at most a few generated units in memory ahead of the consumer.
+        /// Generation stops when the consumer stops enumerating or the token is cancelled.
+        /// A unit still generating <see cref="FileTimeBudget"/> after it started is quarantined and not returned;
+        /// the enumeration ends only after its generation does.
+        /// </summary>
+        /// <param name="outputDirectory">Directory combined with each file name into <see cref="GeneratedFile.FilePath"/></param>
+        /// <param name="unitNames">Header file units to generate, or null for all of them</param>
+        /// <param name="metrics">Receives the generation time of each unit in order, or null to skip measuring</param>
+        internal async IAsyncEnumerable<(string UnitName, List<GeneratedFile> Files)> GenerateFilesAsync(ConversionModel model, string outputDirectory, string sourceDirectory, int maxParallelism, ISet<string>? unitNames = null, ConversionMetrics? metrics = null, [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            var units = model.HeaderFileClasses
+                .Where(kvp => kvp.Value.Count > 0 && (unitNames == null || unitNames.Contains(kvp.Key)))
+                .ToList();
+            var pending = Channel.CreateBounded<PendingUnit>(new BoundedChannelOptions(maxParallelism * 2)
+            {
+                SingleReader = true,
+                SingleWriter = true
+            });
+            var generationSlots = new SemaphoreSlim(maxParallelism);
+            var budget = FileTimeBudget;
+            using var stop = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+
+            // Slots are taken in header order, so a unit has started before any later unit and its budget runs from then
+            var producer = Task.Run(async () =>
+            {
+                try
                 {
-                    string definesClassName = interfaceClass.Name.TrimStart('I') + "Defines";
-                    if (!generatedDefinesClasses.Contains(definesClassName))
+                    foreach (var unit in units)
                     {
-                        generatedDefinesClasses.Add(definesClassName);
+                        await generationSlots.WaitAsync(stop.Token).ConfigureAwait(false);
+                        var pendingUnit = new PendingUnit(unit.Key, generationSlots);
+                        pendingUnit.Generation = Task.Run(() =>
+                        {
+                            try
+                            {
+                                var files = GenerateHeaderFileUnit(unit.Key, unit.Value, model, outputDirectory, sourceDirectory);
+                                return (Files: files, Elapsed: Stopwatch.GetElapsedTime(pendingUnit.StartTimestamp));
+                            }
+                            finally
+                            {
+                                pendingUnit.ReleaseSlot();
+                            }
+                        });
+                        try
+                        {
+                            await pending.Writer.WriteAsync(pendingUnit, stop.Token).ConfigureAwait(false);
+                        }
+                        catch (OperationCanceledException)
+                        {
+                            await WhenSettled(pendingUnit.Generation).ConfigureAwait(false);
+                            throw;
+                        }
                     }
                 }
+                finally
+                {
+                    pending.Writer.Complete();
+                }
+            });
+
+            var completed = 0;
+            var quarantined = new List<Task>();
+            try
+            {
+                await foreach (var pendingUnit in pending.Reader.ReadAllAsync(cancellationToken).ConfigureAwait(false))
+                {
+                    completed++;
+                    if (budget.HasValue && !await CompletesWithinBudgetAsync(pendingUnit.Generation, pendingUnit.StartTimestamp, budget.Value, cancellationToken).ConfigureAwait(false))
+                    {
+                        // Its slot goes to the next unit now; the generation keeps running and is waited for at the end
+                        pendingUnit.ReleaseSlot();
+                        quarantined.Add(pendingUnit.Generation);
+                        _logger.LogWarning($"Warning: generating {pendingUnit.UnitName}.cs exceeded the file time budget of {budget.Value.TotalSeconds:0.###} s; it is not written");
+                        metrics?.Quarantine(pendingUnit.UnitName, "Generate", budget.Value);
+                        continue;
+                    }
+
+                    var (generatedFiles, elapsed) = await pendingUnit.Generation.ConfigureAwait(false);
+                    metrics?.AddUnit(pendingUnit.UnitName, generatedFiles.Count, elapsed.TotalMilliseconds);
+                    metrics?.Report(new ConversionProgress(ConversionProgressKind.UnitGenerated, "Generate", pendingUnit.UnitName, completed, units.Count, elapsed.TotalMilliseconds));
+                    yield return (pendingUnit.UnitName, generatedFiles);
+                }
             }
-            
-            // Second pass: generate all files with knowledge of all defines classes
-            foreach (var headerFileKvp in headerFileClasses)
+            finally
             {
-                var fileName = headerFileKvp.Key;
-                var classes = headerFileKvp.Value;
-                
-                if (classes.Count == 0)
-                    continue;
-                    
-                Console.WriteLine($"Generating C# file: {fileName}.cs with {classes.Count} type(s)");
-                
-                // Generate defines files for public interfaces
-                GenerateDefinesFilesForPublicInterfaces(fileName, outputDirectory, classes, sourceDirectory);
-                
-                // Generate main C# file
-                GenerateAndWriteFile(fileName, outputDirectory, classes, parsedSources, staticMemberInits, sourceDirectory, sourceDefines, sourceRegions, sourceFileTopComments, isPartialFile: false, partialMethods: null, definesClasses: generatedDefinesClasses);
-                
-                // Generate additional partial class files for classes that need them
-                GenerateAdditionalPartialFiles(fileName, classes, parsedSources, staticMemberInits, sourceFileTopComments, outputDirectory, sourceDirectory, generatedDefinesClasses);
+                // Also reached when the consumer stops early or a unit fails. Generations change the model, so every one
+                // started, including those not read yet and those quarantined, has ended before the enumeration does
+                stop.Cancel();
+                await WhenSettled(producer).ConfigureAwait(false);
+                while (pending.Reader.TryRead(out var abandoned))
+                {
+                    await WhenSettled(abandoned.Generation).ConfigureAwait(false);
+                }
+                foreach (var generation in quarantined)
+                {
+                    await WhenSettled(generation).ConfigureAwait(false);
+                }
+            }
+        }
+
+        /// <summary>
+        /// A header file unit whose generation has started, with the generation slot it holds
+        /// </summary>
+        private sealed class PendingUnit
+        {
+            private readonly SemaphoreSlim _generationSlots;
+            private int _released;
+
+            public PendingUnit(string unitName, SemaphoreSlim generationSlots)
+            {
+                UnitName = unitName;
+                _generationSlots = generationSlots;
+                StartTimestamp = Stopwatch.GetTimestamp();
+            }
+
+            public string UnitName { get; }
+            public long StartTimestamp { get; }
+            public Task<(List<GeneratedFile> Files, TimeSpan Elapsed)> Generation { get; set; } = null!;
+
+            /// <summary>
+            /// Releases the slot once, whether the generation ends or the unit is quarantined first
+            /// </summary>
+            public void ReleaseSlot()
+            {
+                if (Interlocked.Exchange(ref _released, 1) == 0)
+                {
+                    _generationSlots.Release();
+                }
             }
+        }
+
+        /// <summary>
+        /// Waits for a task that is no longer needed, ignoring its outcome
+        /// </summary>
+        private static Task WhenSettled(Task task)
+        {
+            return task.ContinueWith(_ => { }, CancellationToken.None, TaskContinuationOptions.ExecuteSynchronously, TaskScheduler.Default);
+        }
+
+        private List<GeneratedFile> GenerateHeaderFileUnit(string fileName, List<CppClass> classes, ConversionModel model, string outputDirectory, string sourceDirectory)
+        {
+            var output = new List<GeneratedFile>();
+
+            _logger.LogDebug($"Generating C# file: {fileName}.cs with {classes.Count} type(s)");
+            
+            // Generate defines files for public interfaces
+            GenerateDefinesFilesForPublicInterfaces(fileName, outputDirectory, classes, sourceDirectory, output);
             
-            // Old individual class generation logic has been replaced with file-based generation above
+            // Generate main C# file
+            GenerateAndWriteFile(fileName, outputDirectory, classes, model.Implementations, model.Symbols, model.StaticMemberInits, sourceDirectory, output, model.SourceDefines, model.SourceRegions, model.SourceFileTopComments, isPartialFile: false, partialMethods: null, definesClasses: model.DefinesClasses);
+            
+            // Generate additional partial class files for classes that need them
+            GenerateAdditionalPartialFiles(fileName, classes, model.Implementations, model.Symbols, model.StaticMemberInits, model.SourceFileTopComments, outputDirectory, sourceDirectory, output, model.DefinesClasses);
+
+            return output;
+        }
 
-            Console.WriteLine("Conversion completed!");
+        /// <summary>
+        /// Runs a parallel loop and rethrows the first failure directly instead of wrapped in an AggregateException.
+        /// </summary>
+        private static void RunParallel(Action loop)
+        {
+            try
+            {
+                loop();
+            }
+            catch (AggregateException ex) when (ex.InnerExceptions.Count > 0)
+            {
+                ExceptionDispatchInfo.Capture(ex.InnerExceptions[0]).Throw();
+            }
         }
 
 
@@ -402,7 +890,7 @@ namespace CppToCsConverter.Core.Core
             }
         }
 
-        private string? GenerateDefinesFilesForPublicInterfaces(string fileName, string outputDirectory, List<CppClass> classes, string sourceDirectory)
+        private string? GenerateDefinesFilesForPublicInterfaces(string fileName, string outputDirectory, List<CppClass> classes, string sourceDirectory, List<GeneratedFile> output)
         {
             // Find public interfaces with defines
             var publicInterfacesWithDefines = classes
@@ -414,7 +902,7 @@ namespace CppToCsConverter.Core.Core
             foreach (var interfaceClass in publicInterfacesWithDefines)
             {
                 // Generate defines class name: ISample -> SampleDefines
-                string definesClassName = interfaceClass.Name.TrimStart('I') + "Defines";
+                string definesClassName = SymbolIndex.GetDefinesClassName(interfaceClass);
                 generatedDefinesClassName = definesClassName;
                 
                 var sb = new StringBuilder();
@@ -460,15 +948,15 @@ namespace CppToCsConverter.Core.Core
                 
                 sb.AppendLine("}");
                 
-                // Write the file
+                // Queue the file for writing
                 var definesFileName = Path.Combine(outputDirectory, $"{definesClassName}.cs");
-                WriteFileToDirectory(definesFileName, sb.ToString(), definesClassName);
+                output.Add(new GeneratedFile { FilePath = definesFileName, FileName = definesClassName, Content = sb.ToString() });
             }
             
             return generatedDefinesClassName;
         }
 
-        private void GenerateFileContent(StringBuilder sb, List<CppClass> classes, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, Dictionary<string, List<CppDefine>>? sourceDefines, Dictionary<string, List<CppRegion>>? sourceRegions, string fileName, bool isPartialFile, List<CppMethod>? partialMethods = null)
+        private void GenerateFileContent(StringBuilder sb, List<CppClass> classes, ImplementationIndex implementations, SymbolIndex symbols, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, Dictionary<string, List<CppDefine>>? sourceDefines, Dictionary<string, List<CppRegion>>? sourceRegions, string fileName, bool isPartialFile, List<CppMethod>? partialMethods = null)
         {
             if (isPartialFile)
             {
@@ -526,7 +1014,7 @@ namespace CppToCsConverter.Core.Core
                             else if (type == "method")
                             {
                                 var method = (CppMethod)element;
-                                GenerateMethodForPartialClass(sb, method, cppClass.Name, parsedSources, "    "); // 4 spaces for partial files
+                                GenerateMethodForPartialClass(sb, method, cppClass.Name, implementations, "    "); // 4 spaces for partial files
                                 
                                 // Only add blank line between elements, not after the last one
                                 // Check if next element is a method (regions handle their own spacing)
@@ -548,7 +1036,7 @@ namespace CppToCsConverter.Core.Core
             else
             {
                 // Associate source defines with classes before generation
-                AssociateSourceDefinesWithClasses(classes, parsedSources, sourceDefines, sourceRegions);
+                AssociateSourceDefinesWithClasses(classes, implementations.ParsedSources, sourceDefines, sourceRegions);
 
                 // Generate each class in the file (structs are now classes with IsStruct=true)
                 for (int i = 0; i < classes.Count; i++)
@@ -561,12 +1049,12 @@ namespace CppToCsConverter.Core.Core
                     if (cppClass.IsInterface)
                     {
                         // Generate interface with Create attribute if applicable
-                        GenerateInterfaceInline(sb, cppClass, parsedSources);
+                        GenerateInterfaceInline(sb, cppClass, symbols);
                     }
                     else
                     {
                         // Generate class inline with preserved C++ method bodies (structs go through same path)
-                        GenerateClassWithCppBodies(sb, cppClass, parsedSources, staticMemberInits, fileName);
+                        GenerateClassWithCppBodies(sb, cppClass, implementations, staticMemberInits, fileName);
                     }
                 }
             }
@@ -653,7 +1141,7 @@ namespace CppToCsConverter.Core.Core
             return classMethodCounts.First().Class;
         }
 
-        private void GenerateAndWriteFile(string fileName, string outputDirectory, List<CppClass> classes, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string sourceDirectory, Dictionary<string, List<CppDefine>>? sourceDefines = null, Dictionary<string, List<CppRegion>>? sourceRegions = null, Dictionary<string, List<string>>? sourceFileTopComments = null, bool isPartialFile = false, List<CppMethod>? partialMethods = null, List<string>? definesClasses = null)
+        private void GenerateAndWriteFile(string fileName, string outputDirectory, List<CppClass> classes, ImplementationIndex implementations, SymbolIndex symbols, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string sourceDirectory, List<GeneratedFile> output, Dictionary<string, List<CppDefine>>? sourceDefines = null, Dictionary<string, List<CppRegion>>? sourceRegions = null, Dictionary<string, List<string>>? sourceFileTopComments = null, bool isPartialFile = false, List<CppMethod>? partialMethods = null, List<string>? definesClasses = null)
         {
             var sb = new StringBuilder();
             
@@ -663,11 +1151,11 @@ namespace CppToCsConverter.Core.Core
             AddFileTopComments(sb, fileName, sourceFileTopComments);
             AddUsingStatements(sb, containsOnlyInterfaces, definesClasses, sourceDirectory);
             AddNamespace(sb, fileName, sourceDirectory);
-            GenerateFileContent(sb, classes, parsedSources, staticMemberInits, sourceDefines, sourceRegions, fileName, isPartialFile, partialMethods);
+            GenerateFileContent(sb, classes, implementations, symbols, staticMemberInits, sourceDefines, sourceRegions, fileName, isPartialFile, partialMethods);
             
-            // Write the file
+            // Queue the file for writing
             var csFileName = Path.Combine(outputDirectory, $"{fileName}.cs");
-            WriteFileToDirectory(csFileName, sb.ToString(), fileName);
+            output.Add(new GeneratedFile { FilePath = csFileName, FileName = fileName, Content = sb.ToString() });
         }
 
         private void WriteDefineStatementsInline(StringBuilder sb, CppClass cppClass)
@@ -711,47 +1199,53 @@ namespace CppToCsConverter.Core.Core
             sb.AppendLine($"    {define.ToCSharpConst()}");
         }
 
-        private void WriteFileToDirectory(string filePath, string content, string fileName)
+        private async Task WriteFileToDirectoryAsync(GeneratedFile generatedFile, OutputFileWriter writer)
         {
+            var filePath = generatedFile.FilePath;
+            var content = generatedFile.Content;
+            var fileName = generatedFile.FileName;
             try
             {
-                Console.WriteLine($"Writing C# file: {filePath}");
-                var normalizedContent = content.Replace("\r\n", "\n").Replace("\n", Environment.NewLine);
-                File.WriteAllText(filePath, normalizedContent);
-                Console.WriteLine($"Generated C# file: {fileName}.cs (Size: {content.Length} chars)");
-                
-                // Verify file was written
-                if (File.Exists(filePath))
+                if (await writer.WriteIfChangedAsync(filePath, content).ConfigureAwait(false))
                 {
-                    var fileInfo = new FileInfo(filePath);
-                    Console.WriteLine($"File verified: {filePath} (Size: {fileInfo.Length} bytes)");
+                    _logger.LogDebug($"Generated C# file: {fileName}.cs (Size: {content.Length} chars)");
                 }
                 else
                 {
-                    Console.WriteLine($"ERROR: File was not created: {filePath}");
+                    _logger.LogDebug($"Unchanged C# file: {fileName}.cs");
                 }
             }
             catch (Exception ex)
             {
-                Console.WriteLine($"ERROR writing C# file {filePath}: {ex.Message}");
+                _logger.LogError($"ERROR writing C# file {filePath}: {ex.Message}");
                 throw;
             }
         }
 
-        private void GenerateClassWithCppBodies(StringBuilder sb, CppClass cppClass, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
+        /// <summary>
+        /// Writes the list of added, changed, unchanged and removed outputs of this run to the output directory
+        /// </summary>
+        private void SaveChangeManifest(OutputFileWriter writer, string outputDirectory)
+        {
+            var changes = writer.CreateChangeManifest(outputDirectory);
+            changes.Save(outputDirectory);
+            _logger.LogInfo($"Output files: {changes.Added.Count} added, {changes.Changed.Count} changed, {changes.Unchanged.Count} unchanged, {changes.Removed.Count} removed");
+        }
+
+        private void GenerateClassWithCppBodies(StringBuilder sb, CppClass cppClass, ImplementationIndex implementations, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
         {
             // First, enrich header methods with TargetFileName from source implementations
-            EnrichMethodsWithTargetFileNames(cppClass, parsedSources);
+            EnrichMethodsWithTargetFileNames(cppClass, implementations);
             
             // Check if this class needs partial generation based on TargetFileName distribution
             if (cppClass.IsPartialClass())
             {
-                GeneratePartialClass(sb, cppClass, parsedSources, staticMemberInits, fileName);
+                GeneratePartialClass(sb, cppClass, implementations, staticMemberInits, fileName);
                 return;
             }
             
             // Check if this is header-only generation and show warning
-            var implementationMethods = parsedSources.ContainsKey(cppClass.Name) ? parsedSources[cppClass.Name] : new List<CppMethod>();
+            var implementationMethods = implementations.ParsedSources.ContainsKey(cppClass.Name) ? implementations.ParsedSources[cppClass.Name] : new List<CppMethod>();
             
             // Check if this is truly header-only generation (no implementations AND no inline methods)
             var methodsNeedingImplementation = cppClass.Methods.Where(m => 
@@ -767,12 +1261,8 @@ namespace CppToCsConverter.Core.Core
 
             if (isHeaderOnlyGeneration)
             {
-                // Write warning to console with yellow color
-                var currentColor = Console.ForegroundColor;
-                Console.ForegroundColor = ConsoleColor.Yellow;
-                Console.WriteLine($"⚠️  WARNING: Generating '{fileName}' from header-only content. Methods will contain TODO implementations.");
-                Console.WriteLine($"    Class: {cppClass.Name} | Header methods: {cppClass.Methods.Count} | Implementation methods: {availableImplementations}");
-                Console.ForegroundColor = currentColor;
+                _logger.LogWarning($"⚠️  WARNING: Generating '{fileName}' from header-only content. Methods will contain TODO implementations.{Environment.NewLine}" +
+                                   $"    Class: {cppClass.Name} | Header methods: {cppClass.Methods.Count} | Implementation methods: {availableImplementations}");
             }
 
             // Add comments before class declaration
@@ -787,7 +1277,7 @@ namespace CppToCsConverter.Core.Core
             // Structs are always internal classes in C#
             var accessibility = cppClass.IsStruct ? "internal" : 
                                (cppClass.IsPublicExport ? "public" : "internal");
-            var classStaticModifier = ShouldBeStaticClass(cppClass, parsedSources) ? "static " : "";
+            var classStaticModifier = ShouldBeStaticClass(cppClass, implementations) ? "static " : "";
             sb.AppendLine($"{accessibility} {classStaticModifier}class {cppClass.Name}");
             sb.AppendLine("{");
 
@@ -808,7 +1298,7 @@ namespace CppToCsConverter.Core.Core
                 }
 
                 // Add comments before member
-                if (member.PrecedingComments.Any())
+                if (member.PrecedingCommentsOrEmpty.Count > 0)
                 {
                     foreach (var comment in member.PrecedingComments)
                     {
@@ -876,16 +1366,13 @@ namespace CppToCsConverter.Core.Core
             }
 
             // Only add blank line after members if there are methods following
-            var relatedMethods = parsedSources.Values
-                .SelectMany(methods => methods)
-                .Where(m => m.ClassName == cppClass.Name)
-                .ToList();
+            var relatedMethods = implementations.GetMethodsForClass(cppClass.Name);
             
             if (cppClass.Members.Any() && relatedMethods.Any())
                 sb.AppendLine();
 
             // Create signature-based matching for overloaded methods
-            var implementedMethodSignatures = relatedMethods.Select(m => GetMethodSignature(m)).ToHashSet();
+            var implementedMethodSignatures = relatedMethods.Select(m => implementations.GetMethodSignature(m)).ToHashSet();
             
 
 
@@ -896,7 +1383,7 @@ namespace CppToCsConverter.Core.Core
                 var method = cppClass.Methods[headerMethodIndex];
 
                 // Skip if this exact method signature has an implementation in source files (avoid duplicates)
-                if (!method.HasInlineImplementation && implementedMethodSignatures.Contains(GetMethodSignature(method)))
+                if (!method.HasInlineImplementation && implementedMethodSignatures.Contains(implementations.GetMethodSignature(method)))
                     continue;
 
                 // Add source region start (from .cpp file - preserved as region)
@@ -916,7 +1403,7 @@ namespace CppToCsConverter.Core.Core
                 }
 
                 // Add comments from .h file
-                if (method.HeaderComments.Any())
+                if (method.HeaderCommentsOrEmpty.Count > 0)
                 {
                     foreach (var comment in method.HeaderComments)
                     {
@@ -925,7 +1412,7 @@ namespace CppToCsConverter.Core.Core
                 }
 
                 // Add comments from .cpp file
-                if (method.SourceComments.Any())
+                if (method.SourceCommentsOrEmpty.Count > 0)
                 {
                     foreach (var comment in method.SourceComments)
                     {
@@ -946,7 +1433,7 @@ namespace CppToCsConverter.Core.Core
                     sb.AppendLine("    {");
                     
                     // For constructors, add member initializer assignments first
-                    if (method.IsConstructor && method.MemberInitializerList.Count > 0)
+                    if (method.IsConstructor && method.MemberInitializerListOrEmpty.Count > 0)
                     {
                         foreach (var initializer in method.MemberInitializerList)
                         {
@@ -956,12 +1443,14 @@ namespace CppToCsConverter.Core.Core
                     }
                     
                     // Use IndentationManager for proper context-aware indentation
-                    var originalIndentation = CppToCsConverter.Core.Utils.IndentationManager.DetectOriginalIndentation(method.InlineImplementation);
-                    var indentedInlineBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
-                        method.InlineImplementation, 
-                        originalIndentation
+                    var inlineImplementation = method.InlineImplementation;
+                    var originalIndentation = CppToCsConverter.Core.Utils.IndentationManager.DetectOriginalIndentation(inlineImplementation);
+                    CppToCsConverter.Core.Utils.IndentationManager.AppendReindentedMethodBody(
+                        sb,
+                        inlineImplementation,
+                        originalIndentation,
+                        "        "
                     );
-                    sb.Append(indentedInlineBody);
                     sb.AppendLine(); // Ensure line break before closing brace
                     sb.AppendLine("    }");
                 }
@@ -1036,7 +1525,7 @@ namespace CppToCsConverter.Core.Core
                     }
 
                     // Find corresponding header declaration to get access modifier and default values
-                    var headerMethod = FindMatchingHeaderMethod(cppClass.Methods, method);
+                    var headerMethod = FindMatchingHeaderMethod(cppClass.Methods, method, implementations);
                     
                     // Add header region start (from .h file - converted to comment)
                     if (headerMethod != null && !string.IsNullOrEmpty(headerMethod.HeaderRegionStart))
@@ -1047,7 +1536,7 @@ namespace CppToCsConverter.Core.Core
                     }
 
                     // Add comments from .h file
-                    if (headerMethod != null && headerMethod.HeaderComments.Any())
+                    if (headerMethod != null && headerMethod.HeaderCommentsOrEmpty.Count > 0)
                     {
                         foreach (var comment in headerMethod.HeaderComments)
                         {
@@ -1056,7 +1545,7 @@ namespace CppToCsConverter.Core.Core
                     }
 
                     // Add comments from .cpp file
-                    if (method.SourceComments.Any())
+                    if (method.SourceCommentsOrEmpty.Count > 0)
                     {
                         foreach (var comment in method.SourceComments)
                         {
@@ -1082,16 +1571,17 @@ namespace CppToCsConverter.Core.Core
 
                     }
                     
-                    if (!string.IsNullOrEmpty(method.ImplementationBody))
+                    if (!method.ImplementationBodyText.IsEmpty)
                     {
                         // Include the original C++ implementation body with proper indentation
                         // Use 8 spaces since .cpp method bodies already have indentation
                         // Use IndentationManager for proper context-aware indentation
-                        var indentedBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
-                            method.ImplementationBody, 
-                            method.ImplementationIndentation
+                        CppToCsConverter.Core.Utils.IndentationManager.AppendReindentedMethodBody(
+                            sb,
+                            method.ImplementationBody,
+                            method.ImplementationIndentation,
+                            "        "
                         );
-                        sb.Append(indentedBody);
                         sb.AppendLine(); // Ensure line break before closing brace
                     }
                     
@@ -1137,8 +1627,8 @@ namespace CppToCsConverter.Core.Core
         {
             // Check if any parameter has comments - if not, use simple single-line format
             bool hasParameterComments = parameters.Any(p => 
-                (p.PositionedComments?.Any() ?? false) || 
-                p.InlineComments.Any() ||
+                p.PositionedCommentsOrEmpty.Count > 0 || 
+                p.InlineCommentsOrEmpty.Count > 0 ||
                 (!string.IsNullOrEmpty(p.OriginalText) && (p.OriginalText.Contains("/*") || p.OriginalText.Contains("//"))));
             
             // Debug TrickyToMatch signature generation
@@ -1180,7 +1670,7 @@ namespace CppToCsConverter.Core.Core
             string virtualModifier, string returnType, string methodName, List<CppParameter> parameters, string baseIndent = "    ")
         {
             // Check if any parameter has comments - if not, use simple single-line format
-            bool hasParameterComments = parameters.Any(p => (p.PositionedComments?.Any() ?? false) || p.InlineComments.Any());
+            bool hasParameterComments = parameters.Any(p => p.PositionedCommentsOrEmpty.Count > 0 || p.InlineCommentsOrEmpty.Count > 0);
             
             if (!hasParameterComments || parameters.Count == 0)
             {
@@ -1220,7 +1710,7 @@ namespace CppToCsConverter.Core.Core
             var baseParam = FormatCppParameterClean(param);
             
             // If no positioned comments, return base parameter
-            if (param.PositionedComments == null || !param.PositionedComments.Any())
+            if (param.PositionedCommentsOrEmpty.Count == 0)
             {
                 return baseParam;
             }
@@ -1321,7 +1811,7 @@ namespace CppToCsConverter.Core.Core
                 result += " = " + param.DefaultValue;
             
             // Add positioned comments if present
-            if (param.PositionedComments != null && param.PositionedComments.Any())
+            if (param.PositionedCommentsOrEmpty.Count > 0)
             {
                 var prefixComments = param.PositionedComments.Where(pc => pc.Position == CommentPosition.Prefix).ToList();
                 var suffixComments = param.PositionedComments.Where(pc => pc.Position == CommentPosition.Suffix).ToList();
@@ -1353,7 +1843,7 @@ namespace CppToCsConverter.Core.Core
                 return finalResult;
             }
             // Fallback to legacy inline comments if positioned comments not available
-            else if (param.InlineComments != null && param.InlineComments.Any())
+            else if (param.InlineCommentsOrEmpty.Count > 0)
             {
                 foreach (var comment in param.InlineComments)
                 {
@@ -1388,10 +1878,9 @@ namespace CppToCsConverter.Core.Core
                     IsReference = implParam.IsReference,
                     IsPointer = implParam.IsPointer,
                     DefaultValue = "", // Will be set below
-                    InlineComments = implParam.InlineComments, // Use source comments for implemented methods (legacy)
-                    PositionedComments = implParam.PositionedComments, // Use source positioned comments for implemented methods
                     OriginalText = implParam.OriginalText
                 };
+                mergedParam.ShareCommentsOf(implParam); // Use source comments for implemented methods
 
                 // If there's a corresponding header parameter at the same position, use its default value
                 if (i < headerParameters.Count && !string.IsNullOrEmpty(headerParameters[i].DefaultValue))
@@ -1438,50 +1927,7 @@ namespace CppToCsConverter.Core.Core
             return result.ToString();
         }
 
-        private string? ResolveImplementingClassFromFactory(CppClass cppInterface, Dictionary<string, List<CppMethod>> parsedSources)
-        {
-            // Look for static factory method (e.g., GetInstance, CreateInstance, etc.)
-            var staticFactoryMethod = cppInterface.Methods
-                .FirstOrDefault(m => m.IsStatic && m.AccessSpecifier == AccessSpecifier.Public);
-
-            if (staticFactoryMethod == null)
-                return null;
-
-            // Find implementation in source files
-            var allSourceMethods = parsedSources.Values.SelectMany(methods => methods).ToList();
-            var implementation = allSourceMethods.FirstOrDefault(impl =>
-                impl.ClassName == cppInterface.Name &&
-                impl.Name == staticFactoryMethod.Name &&
-                !string.IsNullOrEmpty(impl.ImplementationBody));
-
-            if (implementation == null || string.IsNullOrEmpty(implementation.ImplementationBody))
-                return null;
-
-            // Parse the implementation body to find the implementing class
-            // Look for patterns like: CSample* pSample = new CSample();
-            // or: return new CSample();
-            var body = implementation.ImplementationBody;
-            
-            // Pattern 1: new ClassName()
-            var newPattern = new System.Text.RegularExpressions.Regex(@"new\s+([A-Z][A-Za-z0-9_]*)\s*\(");
-            var match = newPattern.Match(body);
-            if (match.Success)
-            {
-                return match.Groups[1].Value;
-            }
-
-            // Pattern 2: ClassName* variable = new ClassName()
-            var declarationPattern = new System.Text.RegularExpressions.Regex(@"([A-Z][A-Za-z0-9_]*)\s*\*\s*\w+\s*=\s*new\s+([A-Z][A-Za-z0-9_]*)\s*\(");
-            match = declarationPattern.Match(body);
-            if (match.Success)
-            {
-                return match.Groups[2].Value;
-            }
-
-            return null;
-        }
-
-        private void GenerateInterfaceInline(StringBuilder sb, CppClass cppInterface, Dictionary<string, List<CppMethod>> parsedSources)
+        private void GenerateInterfaceInline(StringBuilder sb, CppClass cppInterface, SymbolIndex symbols)
         {
             // Generate just the interface part (without extension methods)
             var accessibility = cppInterface.IsPublicExport ? "public" : "internal";
@@ -1489,7 +1935,7 @@ namespace CppToCsConverter.Core.Core
             // Add Create attribute for public interfaces with resolved implementing class
             if (cppInterface.IsPublicExport)
             {
-                var implementingClass = ResolveImplementingClassFromFactory(cppInterface, parsedSources);
+                var implementingClass = symbols.GetFactoryCreatedClass(cppInterface);
                 if (!string.IsNullOrEmpty(implementingClass))
                 {
                     sb.AppendLine($"[Create(typeof({implementingClass}))]");
@@ -1573,45 +2019,10 @@ namespace CppToCsConverter.Core.Core
 
         private string ConvertCppToCsValue(string cppValue)
         {
-            if (string.IsNullOrWhiteSpace(cppValue))
-                return "default";
-
-            // Basic conversions for common initialization values
-            var trimmed = cppValue.Trim();
-            
-            // Handle numeric literals
-            if (int.TryParse(trimmed, out _) || 
-                double.TryParse(trimmed, out _) || 
-                trimmed.Equals("true", StringComparison.OrdinalIgnoreCase) ||
-                trimmed.Equals("false", StringComparison.OrdinalIgnoreCase))
-            {
-                return trimmed;
-            }
-
-            // Handle string literals
-            if (trimmed.StartsWith("\"") && trimmed.EndsWith("\""))
-            {
-                return trimmed;
-            }
-
-            // Handle character literals
-            if (trimmed.StartsWith("'") && trimmed.EndsWith("'"))
-            {
-                return trimmed;
-            }
-
-            // Handle nullptr/NULL
-            if (trimmed.Equals("nullptr", StringComparison.OrdinalIgnoreCase) ||
-                trimmed.Equals("NULL", StringComparison.OrdinalIgnoreCase))
-            {
-                return "null";
-            }
-
-            // For other values, return as-is (might be constants, enums, etc.)
-            return trimmed;
+            return TypeNormalizer.ConvertCppToCsValue(cppValue);
         }
 
-        private bool ShouldBeStaticClass(CppClass cppClass, Dictionary<string, List<CppMethod>> parsedSources)
+        private bool ShouldBeStaticClass(CppClass cppClass, ImplementationIndex implementations)
         {
             // A class should be static if:
             // 1. All members are static 
@@ -1631,9 +2042,8 @@ namespace CppToCsConverter.Core.Core
                 return false;
                 
             // Check if any methods from source files are non-static
-            var relatedSourceMethods = parsedSources.Values
-                .SelectMany(methods => methods)
-                .Where(m => m.ClassName == cppClass.Name && !m.IsConstructor && !m.IsDestructor);
+            var relatedSourceMethods = implementations.GetMethodsForClass(cppClass.Name)
+                .Where(m => !m.IsConstructor && !m.IsDestructor);
             var hasNonStaticSourceMethods = relatedSourceMethods.Any(m => !m.IsStatic);
             if (hasNonStaticSourceMethods)
                 return false;
@@ -1652,15 +2062,10 @@ namespace CppToCsConverter.Core.Core
         internal string NormalizeParameterType(string type)
         {
             // Normalize parameter type to handle variations in const, reference, pointer syntax
-            return type.Trim()
-                .Replace(" ", "")           // Remove spaces
-                .Replace("const", "")       // Remove const keyword
-                .Replace("&", "")           // Remove reference
-                .Replace("*", "")           // Remove pointer
-                .ToLowerInvariant();        // Case insensitive comparison
+            return ImplementationIndex.NormalizeParameterType(type);
         }
 
-        private CppMethod? FindMatchingHeaderMethod(List<CppMethod> headerMethods, CppMethod sourceMethod)
+        private CppMethod? FindMatchingHeaderMethod(List<CppMethod> headerMethods, CppMethod sourceMethod, ImplementationIndex implementations)
         {
             // Debug output for TrickyToMatch
             if (sourceMethod.Name == "TrickyToMatch")
@@ -1683,20 +2088,7 @@ namespace CppToCsConverter.Core.Core
                 // Multiple candidates, try to match by parameter types
                 foreach (var candidate in candidates)
                 {
-                    bool typesMatch = true;
-                    for (int i = 0; i < candidate.Parameters.Count; i++)
-                    {
-                        var headerType = NormalizeParameterType(candidate.Parameters[i].Type);
-                        var sourceType = NormalizeParameterType(sourceMethod.Parameters[i].Type);
-                        
-                        if (headerType != sourceType)
-                        {
-                            typesMatch = false;
-                            break;
-                        }
-                    }
-                    
-                    if (typesMatch)
+                    if (implementations.ParametersMatch(candidate, sourceMethod))
                     {
                         return candidate;
                     }
@@ -1707,14 +2099,14 @@ namespace CppToCsConverter.Core.Core
             return headerMethods.FirstOrDefault(h => h.Name == sourceMethod.Name);
         }
 
-        private void GeneratePartialClass(StringBuilder sb, CppClass cppClass, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
+        private void GeneratePartialClass(StringBuilder sb, CppClass cppClass, ImplementationIndex implementations, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
         {
 
             // Generate the main partial class file content (header-based content)
-            GenerateMainPartialClass(sb, cppClass, parsedSources, staticMemberInits, fileName);
+            GenerateMainPartialClass(sb, cppClass, implementations, staticMemberInits, fileName);
         }
 
-        private void GenerateMainPartialClass(StringBuilder sb, CppClass cppClass, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
+        private void GenerateMainPartialClass(StringBuilder sb, CppClass cppClass, ImplementationIndex implementations, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, string fileName)
         {
             // Add comments before class declaration
             if (cppClass.PrecedingComments.Any())
@@ -1762,7 +2154,7 @@ namespace CppToCsConverter.Core.Core
                 
                 for (int i = 0; i < inlineMethods.Count; i++)
                 {
-                    GenerateMethodForPartialClass(sb, inlineMethods[i], cppClass.Name, parsedSources, "    "); // 4 spaces for file-scoped namespaces
+                    GenerateMethodForPartialClass(sb, inlineMethods[i], cppClass.Name, implementations, "    "); // 4 spaces for file-scoped namespaces
                     
                     // Add blank line between inline methods, not after the last one
                     if (i < inlineMethods.Count - 1)
@@ -1826,7 +2218,7 @@ namespace CppToCsConverter.Core.Core
                         else if (type == "method")
                         {
                             var method = (CppMethod)element;
-                            GenerateMethodForPartialClass(sb, method, cppClass.Name, parsedSources, "    "); // 4 spaces for file-scoped namespaces
+                            GenerateMethodForPartialClass(sb, method, cppClass.Name, implementations, "    "); // 4 spaces for file-scoped namespaces
                             
                             // Only add blank line between elements, not after the last one
                             // Check if next element is a method (regions handle their own spacing)
@@ -1881,7 +2273,7 @@ namespace CppToCsConverter.Core.Core
             sb.AppendLine($"    public static {memberType} {staticMember.Name}{initialization};");
         }
 
-        private void GenerateMethodForPartialClass(StringBuilder sb, CppMethod method, string className, Dictionary<string, List<CppMethod>> parsedSources, string baseIndent = "    ")
+        private void GenerateMethodForPartialClass(StringBuilder sb, CppMethod method, string className, ImplementationIndex implementations, string baseIndent = "    ")
         {
             // Use existing method generation logic
             string accessModifier = ConvertAccessSpecifier(method.AccessSpecifier);
@@ -1892,7 +2284,7 @@ namespace CppToCsConverter.Core.Core
             
 
             // Merge header method with implementation method to preserve positioned comments
-            var mergedMethod = MergeHeaderMethodWithImplementation(method, parsedSources, className);
+            var mergedMethod = MergeHeaderMethodWithImplementation(method, implementations, className);
             
 
             // Use comment-aware method signature generation (same as non-partial)
@@ -1901,30 +2293,26 @@ namespace CppToCsConverter.Core.Core
             sb.AppendLine($"{baseIndent}{{");
             
             // Use implementation body if available
-            if (!string.IsNullOrEmpty(mergedMethod.ImplementationBody))
-            {
-                // Reindent to standard 8 spaces first
-                var standardIndentedBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
-                    mergedMethod.ImplementationBody, 
-                    mergedMethod.ImplementationIndentation
+            if (!mergedMethod.ImplementationBodyText.IsEmpty)
+            {
+                // Reindent straight to the target indent level (baseIndent + 4)
+                CppToCsConverter.Core.Utils.IndentationManager.AppendReindentedMethodBody(
+                    sb,
+                    mergedMethod.ImplementationBody,
+                    mergedMethod.ImplementationIndentation,
+                    baseIndent + "    "
                 );
-                // Adjust to target indent level (baseIndent + 4)
-                var targetIndent = baseIndent + "    ";
-                var adjustedBody = AdjustIndentation(standardIndentedBody, "        ", targetIndent);
-                sb.Append(adjustedBody);
                 sb.AppendLine();
             }
-            else if (!string.IsNullOrEmpty(mergedMethod.InlineImplementation))
+            else if (!mergedMethod.InlineImplementationText.IsEmpty)
             {
-                // Reindent to standard 8 spaces first
-                var standardIndentedBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
-                    mergedMethod.InlineImplementation, 
-                    0
+                // Reindent straight to the target indent level (baseIndent + 4)
+                CppToCsConverter.Core.Utils.IndentationManager.AppendReindentedMethodBody(
+                    sb,
+                    mergedMethod.InlineImplementation,
+                    0,
+                    baseIndent + "    "
                 );
-                // Adjust to target indent level (baseIndent + 4)
-                var targetIndent = baseIndent + "    ";
-                var adjustedBody = AdjustIndentation(standardIndentedBody, "        ", targetIndent);
-                sb.Append(adjustedBody);
                 sb.AppendLine();
             }
             else if (mergedMethod.HasResolvedImplementation)
@@ -1935,67 +2323,20 @@ namespace CppToCsConverter.Core.Core
             {
                 // Log unresolved method for investigation
                 var signatureInfo = $"{mergedMethod.ReturnType} {mergedMethod.ClassName}::{mergedMethod.Name}({string.Join(", ", mergedMethod.Parameters.Select(p => p.Type))})";
-                Console.WriteLine($"??  WARNING: Method implementation not found: {signatureInfo}");
-                Console.WriteLine($"    Class: {mergedMethod.ClassName}, Target file: {mergedMethod.TargetFileName}.cs");
+                _logger.LogWarning($"??  WARNING: Method implementation not found: {signatureInfo}{Environment.NewLine}" +
+                                   $"    Class: {mergedMethod.ClassName}, Target file: {mergedMethod.TargetFileName}.cs");
                 sb.AppendLine($"{baseIndent}    // TODO: Implement method body");
             }
             
             sb.AppendLine($"{baseIndent}}}");
         }
 
-        /// <summary>
-        /// Adjusts indentation of a text block from one level to another
-        /// </summary>
-        private string AdjustIndentation(string text, string fromIndent, string toIndent)
-        {
-            if (string.IsNullOrEmpty(text))
-                return string.Empty;
-                
-            var lines = text.Split(new[] { '\r', '\n' }, StringSplitOptions.None);
-            var result = new System.Text.StringBuilder();
-            
-            for (int i = 0; i < lines.Length; i++)
-            {
-                var line = lines[i];
-                
-                if (i > 0)
-                    result.Append("\n");
-                
-                if (string.IsNullOrWhiteSpace(line))
-                {
-                    // Empty line - preserve as empty
-                    continue;
-                }
-                else if (line.StartsWith(fromIndent))
-                {
-                    // Replace the from indent with to indent
-                    result.Append(toIndent + line.Substring(fromIndent.Length));
-                }
-                else
-                {
-                    // Line doesn't start with expected indent - preserve as is
-                    result.Append(line);
-                }
-            }
-            
-            return result.ToString();
-        }
-
-        private CppMethod MergeHeaderMethodWithImplementation(CppMethod headerMethod, Dictionary<string, List<CppMethod>> parsedSources, string className)
+        private CppMethod MergeHeaderMethodWithImplementation(CppMethod headerMethod, ImplementationIndex implementations, string className)
         {
-            // Find implementation methods for this class
-            List<CppMethod> implementationMethods = new List<CppMethod>();
-
-            foreach (var methodsList in parsedSources.Values)
-            {
-                implementationMethods.AddRange(methodsList.Where(m => m.ClassName == className));
-            }
-
-            // Find implementation method by name AND signature (parameter types)
-            var implMethod = implementationMethods.FirstOrDefault(m => 
-                m.Name == headerMethod.Name && 
-                m.ClassName == headerMethod.ClassName &&
-                ParametersMatch(headerMethod.Parameters, m.Parameters));
+            // Find implementation method of this class by name AND signature (parameter types)
+            var implMethod = headerMethod.ClassName == className
+                ? implementations.FindImplementation(className, headerMethod)
+                : null;
 
             if (implMethod == null)
                 return headerMethod;
@@ -2015,7 +2356,7 @@ namespace CppToCsConverter.Core.Core
                 Parameters = new List<CppParameter>(),
                 
                 // Copy implementation body and resolved flag from implementation
-                ImplementationBody = implMethod.ImplementationBody,
+                ImplementationBodyText = implMethod.ImplementationBodyText,
                 HasResolvedImplementation = implMethod.HasResolvedImplementation,
                 ImplementationIndentation = implMethod.ImplementationIndentation
             };
@@ -2041,8 +2382,7 @@ namespace CppToCsConverter.Core.Core
                     // For parameter comments: use implementation comments since this method has an implementation
                     // (per readme.md: "For methods with implementation we need ignore any comments from the header 
                     // and persist the source (.cpp) method argument list comments")
-                    mergedParam.InlineComments = implParam.InlineComments;
-                    mergedParam.PositionedComments = implParam.PositionedComments;
+                    mergedParam.ShareCommentsOf(implParam);
                     mergedParam.OriginalText = implParam.OriginalText;
                 }
                 else if (headerParam != null)
@@ -2060,11 +2400,8 @@ namespace CppToCsConverter.Core.Core
             return merged;
         }
 
-        private void EnrichMethodsWithTargetFileNames(CppClass cppClass, Dictionary<string, List<CppMethod>> parsedSources)
+        private void EnrichMethodsWithTargetFileNames(CppClass cppClass, ImplementationIndex implementations)
         {
-            // Get all source methods from all parsed source files
-            var allSourceMethods = parsedSources.Values.SelectMany(methods => methods).ToList();
-            
             foreach (var headerMethod in cppClass.Methods)
             {
                 // Skip methods that already have a TargetFileName (e.g., inline methods)
@@ -2072,29 +2409,26 @@ namespace CppToCsConverter.Core.Core
                     continue;
                 
                 // Find matching source method
-                var sourceMethod = allSourceMethods.FirstOrDefault(sm => 
-                    sm.ClassName == cppClass.Name && 
-                    sm.Name == headerMethod.Name &&
-                    ParametersMatch(headerMethod.Parameters, sm.Parameters));
+                var sourceMethod = implementations.FindImplementation(cppClass.Name, headerMethod);
                 
                 if (sourceMethod != null)
                 {
                     // Copy TargetFileName, ImplementationBody, and OrderIndex from source method
                     headerMethod.TargetFileName = sourceMethod.TargetFileName;
                     headerMethod.OrderIndex = sourceMethod.OrderIndex; // Copy order index for proper method ordering
-                    if (string.IsNullOrEmpty(headerMethod.ImplementationBody))
+                    if (headerMethod.ImplementationBodyText.IsEmpty)
                     {
-                        headerMethod.ImplementationBody = sourceMethod.ImplementationBody;
+                        headerMethod.ImplementationBodyText = sourceMethod.ImplementationBodyText;
                         headerMethod.ImplementationIndentation = sourceMethod.ImplementationIndentation;
                     }
                 }
             }
             
             // Add local methods from source files that don't exist in the header
-            var localMethods = allSourceMethods.Where(sm => 
-                sm.ClassName == cppClass.Name && 
+            var headerMethodNames = new HashSet<string>(cppClass.Methods.Select(hm => hm.Name));
+            var localMethods = implementations.GetMethodsForClass(cppClass.Name).Where(sm => 
                 sm.IsLocalMethod &&
-                !cppClass.Methods.Any(hm => hm.Name == sm.Name)).ToList();
+                !headerMethodNames.Contains(sm.Name)).ToList();
                 
             foreach (var localMethod in localMethods)
             {
@@ -2102,26 +2436,7 @@ namespace CppToCsConverter.Core.Core
             }
         }
 
-        private bool ParametersMatch(List<CppParameter> headerParams, List<CppParameter> sourceParams)
-        {
-            // Parameter counts must match
-            if (headerParams.Count != sourceParams.Count)
-                return false;
-            
-            // Compare each parameter type
-            for (int i = 0; i < headerParams.Count; i++)
-            {
-                var headerType = NormalizeParameterType(headerParams[i].Type);
-                var sourceType = NormalizeParameterType(sourceParams[i].Type);
-                
-                if (headerType != sourceType)
-                    return false;
-            }
-            
-            return true;
-        }
-
-        private void GenerateAdditionalPartialFiles(string fileName, List<CppClass> classes, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, Dictionary<string, List<string>>? sourceFileTopComments, string outputDirectory, string sourceDirectory, List<string>? definesClasses = null)
+        private void GenerateAdditionalPartialFiles(string fileName, List<CppClass> classes, ImplementationIndex implementations, SymbolIndex symbols, Dictionary<string, List<CppStaticMemberInit>> staticMemberInits, Dictionary<string, List<string>>? sourceFileTopComments, string outputDirectory, string sourceDirectory, List<GeneratedFile> output, List<string>? definesClasses = null)
         {
             foreach (var cppClass in classes)
             {
@@ -2130,7 +2445,7 @@ namespace CppToCsConverter.Core.Core
                     continue;
                     
                 // First, enrich header methods with TargetFileName from source implementations
-                EnrichMethodsWithTargetFileNames(cppClass, parsedSources);
+                EnrichMethodsWithTargetFileNames(cppClass, implementations);
                 
                 // Check if this class needs partial generation
                 if (cppClass.IsPartialClass())
@@ -2149,20 +2464,20 @@ namespace CppToCsConverter.Core.Core
                         var methodsForTarget = methodsByTargetFile[targetFile];
                         if (methodsForTarget.Any())
                         {
-                            GeneratePartialClassFile(cppClass, targetFile, methodsForTarget, parsedSources, sourceFileTopComments, outputDirectory, sourceDirectory, definesClasses);
+                            GeneratePartialClassFile(cppClass, targetFile, methodsForTarget, implementations, symbols, sourceFileTopComments, outputDirectory, sourceDirectory, output, definesClasses);
                         }
                     }
                 }
             }
         }
 
-        private void GeneratePartialClassFile(CppClass cppClass, string targetFileName, List<CppMethod> methods, Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<string>>? sourceFileTopComments, string outputDirectory, string sourceDirectory, List<string>? definesClasses = null)
+        private void GeneratePartialClassFile(CppClass cppClass, string targetFileName, List<CppMethod> methods, ImplementationIndex implementations, SymbolIndex symbols, Dictionary<string, List<string>>? sourceFileTopComments, string outputDirectory, string sourceDirectory, List<GeneratedFile> output, List<string>? definesClasses = null)
         {
             // Use the refactored method to generate and write the partial file
             var classes = new List<CppClass> { cppClass };
             var staticMemberInits = new Dictionary<string, List<CppStaticMemberInit>>();
             
-            GenerateAndWriteFile(targetFileName, outputDirectory, classes, parsedSources, staticMemberInits, sourceDirectory, sourceDefines: null, sourceFileTopComments: sourceFileTopComments, isPartialFile: true, partialMethods: methods, definesClasses: definesClasses);
+            GenerateAndWriteFile(targetFileName, outputDirectory, classes, implementations, symbols, staticMemberInits, sourceDirectory, output, sourceDefines: null, sourceFileTopComments: sourceFileTopComments, isPartialFile: true, partialMethods: methods, definesClasses: definesClasses);
         }
 
         /// <summary>
@@ -2172,11 +2487,7 @@ namespace CppToCsConverter.Core.Core
         /// </summary>
         private string NormalizePointerSpacingForOutput(string type)
         {
-            if (string.IsNullOrEmpty(type))
-                return type;
-
-            // Replace " *" with "*" and " &" with "&" 
-            return type.Replace(" *", "*").Replace(" &", "&");
+            return TypeNormalizer.NormalizePointerSpacingForOutput(type);
         }
     }
 }
\ No newline at end of file
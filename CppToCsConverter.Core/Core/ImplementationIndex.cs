@@ -0,0 +1,138 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Utils;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Lookup of the methods parsed from source files, built once by the link stage.
+    /// Groups implementations by class name and by normalized signature, and caches the normalized
+    /// parameter types of every source and header method, so matching header declarations to their
+    /// implementations does not rescan all source methods or renormalize types per comparison.
+    /// Read-only after construction, so generation of different header file units can share it.
+    /// </summary>
+    internal class ImplementationIndex
+    {
+        private static readonly IReadOnlyList<CppMethod> NoMethods = Array.Empty<CppMethod>();
+
+        private readonly Dictionary<string, List<CppMethod>> _methodsByClass = new Dictionary<string, List<CppMethod>>();
+        private readonly Dictionary<(string ClassName, string Signature), List<CppMethod>> _methodsBySignature = new Dictionary<(string, string), List<CppMethod>>();
+        private readonly Dictionary<CppMethod, string[]> _normalizedParameterTypes = new Dictionary<CppMethod, string[]>(ReferenceEqualityComparer.Instance);
+
+        /// <param name="parsedSources">Methods per source file, in input order</param>
+        /// <param name="headerFileClasses">Classes per header file; their method parameter types are normalized up front</param>
+        public ImplementationIndex(Dictionary<string, List<CppMethod>> parsedSources, Dictionary<string, List<CppClass>> headerFileClasses)
+        {
+            ParsedSources = parsedSources;
+
+            foreach (var method in parsedSources.Values.SelectMany(methods => methods))
+            {
+                var normalizedTypes = AddNormalizedParameterTypes(method);
+
+                if (!_methodsByClass.TryGetValue(method.ClassName, out var classMethods))
+                {
+                    classMethods = new List<CppMethod>();
+                    _methodsByClass.Add(method.ClassName, classMethods);
+                }
+                classMethods.Add(method);
+
+                var key = (method.ClassName, CreateSignature(method.Name, normalizedTypes));
+                if (!_methodsBySignature.TryGetValue(key, out var overloads))
+                {
+                    overloads = new List<CppMethod>();
+                    _methodsBySignature.Add(key, overloads);
+                }
+                overloads.Add(method);
+            }
+
+            foreach (var method in headerFileClasses.Values.SelectMany(classes => classes).SelectMany(c => c.Methods))
+            {
+                AddNormalizedParameterTypes(method);
+            }
+        }
+
+        /// <summary>
+        /// Methods per source file, keyed by source file name without extension
+        /// </summary>
+        public Dictionary<string, List<CppMethod>> ParsedSources { get; }
+
+        /// <summary>
+        /// All source methods of a class, in source file order
+        /// </summary>
+        public IReadOnlyList<CppMethod> GetMethodsForClass(string className)
+        {
+            return _methodsByClass.TryGetValue(className, out var methods) ? methods : NoMethods;
+        }
+
+        /// <summary>
+        /// Finds the first source implementation of a class method with the same name and normalized parameter types
+        /// </summary>
+        public CppMethod? FindImplementation(string className, CppMethod declaration)
+        {
+            var declarationTypes = GetNormalizedParameterTypes(declaration);
+            if (!_methodsBySignature.TryGetValue((className, CreateSignature(declaration.Name, declarationTypes)), out var overloads))
+                return null;
+
+            // The signature joins types with ',', so compare the type lists to tell apart e.g. "map<a,b>" from "a", "b"
+            foreach (var implementation in overloads)
+            {
+                if (ParameterTypesEqual(declarationTypes, GetNormalizedParameterTypes(implementation)))
+                    return implementation;
+            }
+            return null;
+        }
+
+        /// <summary>
+        /// Returns true if both methods have the same number of parameters with equal normalized types
+        /// </summary>
+        public bool ParametersMatch(CppMethod first, CppMethod second)
+        {
+            return ParameterTypesEqual(GetNormalizedParameterTypes(first), GetNormalizedParameterTypes(second));
+        }
+
+        public string GetMethodSignature(CppMethod method)
+        {
+            return CreateSignature(method.Name, GetNormalizedParameterTypes(method));
+        }
+
+        /// <summary>
+        /// Normalizes a parameter type for comparison (removes const, &amp;, * and spaces, ignores case)
+        /// </summary>
+        public static string NormalizeParameterType(string type)
+        {
+            return TypeNormalizer.NormalizeParameterType(type);
+        }
+
+        private string[] GetNormalizedParameterTypes(CppMethod method)
+        {
+            return _normalizedParameterTypes.TryGetValue(method, out var types) ? types : NormalizeParameterTypes(method);
+        }
+
+        private string[] AddNormalizedParameterTypes(CppMethod method)
+        {
+            if (!_normalizedParameterTypes.TryGetValue(method, out var types))
+            {
+                types = NormalizeParameterTypes(method);
+                _normalizedParameterTypes.Add(method, types);
+            }
+            return types;
+        }
+
+        private static string[] NormalizeParameterTypes(CppMethod method)
+        {
+            return method.Parameters.Select(p => NormalizeParameterType(p.Type)).ToArray();
+        }
+
+        private static string CreateSignature(string methodName, string[] normalizedTypes)
+        {
+            return $"{methodName}({string.Join(",", normalizedTypes)})";
+        }
+
+        private static bool ParameterTypesEqual(string[] first, string[] second)
+        {
+            return first.AsSpan().SequenceEqual(second);
+        }
+    }
+}
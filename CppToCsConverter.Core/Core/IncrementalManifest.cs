@@ -0,0 +1,118 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Reflection;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using CppToCsConverter.Core.Logging;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Manifest stored in the output directory by incremental conversion.
+    /// Records the hash and symbols of every input and which output files each header file unit produced,
+    /// so a rerun can tell which inputs changed and which outputs they affect.
+    /// </summary>
+    internal class IncrementalManifest
+    {
+        public const string ManifestFileName = ".cpptocs-manifest.json";
+        public const int CurrentFormatVersion = 1;
+
+        public int FormatVersion { get; set; } = CurrentFormatVersion;
+        public string ConverterVersion { get; set; } = string.Empty;
+        public string Namespace { get; set; } = string.Empty; // Resolved namespace; a different namespace changes every file
+        public List<string> DefinesClasses { get; set; } = new List<string>();
+        public List<ManifestInput> Inputs { get; set; } = new List<ManifestInput>();
+        public List<ManifestUnit> Units { get; set; } = new List<ManifestUnit>();
+
+        /// <summary>
+        /// Identifies the converter build. Includes the module version id so any rebuild of the converter
+        /// with different code invalidates previous manifests and parse cache entries.
+        /// </summary>
+        public static string CurrentConverterVersion { get; } = CreateConverterVersion();
+
+        private static string CreateConverterVersion()
+        {
+            var assembly = typeof(IncrementalManifest).Assembly;
+            var version = assembly.GetCustomAttribute<AssemblyInformationalVersionAttribute>()?.InformationalVersion
+                          ?? assembly.GetName().Version?.ToString()
+                          ?? "0";
+            return $"{version}+{GetBuildId()}";
+        }
+
+        private static string GetBuildId()
+        {
+            try
+            {
+                return typeof(IncrementalManifest).Module.ModuleVersionId.ToString("N");
+            }
+            catch (Exception ex) when (ex is NotSupportedException || ex is InvalidOperationException)
+            {
+                // Native AOT executables may not keep module metadata; the executable itself identifies the build
+                var executable = new FileInfo(Environment.ProcessPath ?? string.Empty);
+                return executable.Exists ? $"{executable.Length:X}{executable.LastWriteTimeUtc.Ticks:X}" : "0";
+            }
+        }
+
+        /// <summary>
+        /// Loads a manifest, returning null if it is missing, unreadable or written by a different converter build.
+        /// </summary>
+        public static IncrementalManifest? Load(string path, ILogger logger)
+        {
+            if (!File.Exists(path))
+                return null;
+
+            try
+            {
+                using var stream = File.OpenRead(path);
+                var manifest = JsonSerializer.Deserialize(stream, IncrementalManifestJsonContext.Default.IncrementalManifest);
+                if (manifest == null ||
+                    manifest.FormatVersion != CurrentFormatVersion ||
+                    manifest.ConverterVersion != CurrentConverterVersion)
+                {
+                    return null;
+                }
+                return manifest;
+            }
+            catch (Exception ex) when (ex is JsonException || ex is IOException)
+            {
+                logger.LogWarning($"Warning: Ignoring unreadable manifest {path}: {ex.Message}");
+                return null;
+            }
+        }
+
+        public void Save(string path)
+        {
+            using var stream = File.Create(path);
+            JsonSerializer.Serialize(stream, this, IncrementalManifestJsonContext.Default.IncrementalManifest);
+        }
+    }
+
+    /// <summary>
+    /// A header or source file recorded in the manifest
+    /// </summary>
+    internal class ManifestInput
+    {
+        public string Path { get; set; } = string.Empty; // Relative to the source directory when known
+        public bool IsHeader { get; set; }
+        public string Hash { get; set; } = string.Empty;
+        public List<string> Classes { get; set; } = new List<string>(); // Headers: classes declared; sources: classes implemented
+        public List<string> DefinesClasses { get; set; } = new List<string>(); // Headers only: XDefines classes generated from it
+    }
+
+    /// <summary>
+    /// A header file unit (one main .cs file plus its defines and partial files) recorded in the manifest
+    /// </summary>
+    internal class ManifestUnit
+    {
+        public string Name { get; set; } = string.Empty; // Header/source file name without extension
+        public List<string> Inputs { get; set; } = new List<string>(); // Manifest input paths the unit was generated from
+        public List<string> Outputs { get; set; } = new List<string>(); // File names written to the output directory
+    }
+
+    [JsonSourceGenerationOptions(WriteIndented = true)]
+    [JsonSerializable(typeof(IncrementalManifest))]
+    internal partial class IncrementalManifestJsonContext : JsonSerializerContext
+    {
+    }
+}
@@ -0,0 +1,47 @@
+using System.Collections.Generic;
+using System.IO;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Written to the output directory after every conversion run for the next pipeline stage.
+    /// Lists the output files the run added, changed, left unchanged and removed, relative to the output directory.
+    /// Unchanged files were not rewritten, so their timestamps are preserved.
+    /// </summary>
+    public class OutputChangeManifest
+    {
+        public const string ManifestFileName = ".cpptocs-changes.json";
+
+        public List<string> Added { get; set; } = new List<string>();
+        public List<string> Changed { get; set; } = new List<string>();
+        public List<string> Unchanged { get; set; } = new List<string>();
+        public List<string> Removed { get; set; } = new List<string>();
+
+        /// <summary>
+        /// Loads the change manifest of the last run from an output directory, or returns null if there is none
+        /// </summary>
+        public static OutputChangeManifest? Load(string outputDirectory)
+        {
+            var path = Path.Combine(outputDirectory, ManifestFileName);
+            if (!File.Exists(path))
+                return null;
+
+            using var stream = File.OpenRead(path);
+            return JsonSerializer.Deserialize(stream, OutputChangeManifestJsonContext.Default.OutputChangeManifest);
+        }
+
+        internal void Save(string outputDirectory)
+        {
+            using var stream = File.Create(Path.Combine(outputDirectory, ManifestFileName));
+            JsonSerializer.Serialize(stream, this, OutputChangeManifestJsonContext.Default.OutputChangeManifest);
+        }
+    }
+
+    [JsonSourceGenerationOptions(WriteIndented = true)]
+    [JsonSerializable(typeof(OutputChangeManifest))]
+    internal partial class OutputChangeManifestJsonContext : JsonSerializerContext
+    {
+    }
+}
@@ -0,0 +1,165 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using System.Security.Cryptography;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Writes generated files for one conversion run.
+    /// Content is encoded to UTF-8 (without BOM) into a pooled buffer, converting "\r\n" and "\n" to
+    /// <see cref="Environment.NewLine"/> while encoding, and a file is only written when its content hash differs
+    /// from the file already on disk. Tracks what happened to every output for the <see cref="OutputChangeManifest"/>.
+    /// Not thread-safe; the converter writes files from a single writer.
+    /// </summary>
+    internal class OutputFileWriter
+    {
+        private static readonly UTF8Encoding Utf8NoBom = new UTF8Encoding(encoderShouldEmitUTF8Identifier: false);
+
+        // Hash of each output before the run (null if it did not exist) and after its last write or removal
+        private readonly Dictionary<string, (string? Before, string? After)> _outputs = new Dictionary<string, (string? Before, string? After)>(StringComparer.Ordinal);
+
+        /// <summary>
+        /// Writes the content unless the file already holds exactly the same bytes
+        /// </summary>
+        /// <returns>True if the file was written</returns>
+        public async Task<bool> WriteIfChangedAsync(string filePath, string content)
+        {
+            var buffer = EncodeWithNormalizedNewLines(content, out var length);
+            try
+            {
+                var hash = Convert.ToHexString(SHA256.HashData(buffer.AsSpan(0, length)));
+                var existingHash = ComputeExistingHash(filePath);
+                Track(filePath, existingHash, hash);
+
+                if (existingHash == hash)
+                    return false;
+
+                using (var stream = new FileStream(filePath, FileMode.Create, FileAccess.Write, FileShare.None, bufferSize: 4096, useAsync: true))
+                {
+                    await stream.WriteAsync(buffer.AsMemory(0, length)).ConfigureAwait(false);
+                }
+                return true;
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Records that an output is about to be deleted. Call before deleting the file.
+        /// </summary>
+        public void RecordRemoved(string filePath)
+        {
+            Track(filePath, ComputeExistingHash(filePath), null);
+        }
+
+        /// <summary>
+        /// Records an existing output that the run kept without regenerating it
+        /// </summary>
+        public void RecordUntouched(string filePath)
+        {
+            if (File.Exists(filePath) && !_outputs.ContainsKey(filePath))
+            {
+                _outputs.Add(filePath, (string.Empty, string.Empty));
+            }
+        }
+
+        /// <summary>
+        /// Compares the state of every tracked output before and after the run
+        /// </summary>
+        public OutputChangeManifest CreateChangeManifest(string outputDirectory)
+        {
+            var manifest = new OutputChangeManifest();
+            foreach (var output in _outputs)
+            {
+                var name = Path.GetRelativePath(outputDirectory, output.Key);
+                var (before, after) = output.Value;
+                if (after == null)
+                {
+                    if (before != null)
+                        manifest.Removed.Add(name);
+                }
+                else if (before == null)
+                {
+                    manifest.Added.Add(name);
+                }
+                else if (before == after)
+                {
+                    manifest.Unchanged.Add(name);
+                }
+                else
+                {
+                    manifest.Changed.Add(name);
+                }
+            }
+
+            manifest.Added.Sort(StringComparer.Ordinal);
+            manifest.Changed.Sort(StringComparer.Ordinal);
+            manifest.Unchanged.Sort(StringComparer.Ordinal);
+            manifest.Removed.Sort(StringComparer.Ordinal);
+            return manifest;
+        }
+
+        private void Track(string filePath, string? existingHash, string? newHash)
+        {
+            // The first time a path is seen its current state is the state before the run
+            var before = _outputs.TryGetValue(filePath, out var state) ? state.Before : existingHash;
+            _outputs[filePath] = (before, newHash);
+        }
+
+        private static string? ComputeExistingHash(string filePath)
+        {
+            if (!File.Exists(filePath))
+                return null;
+
+            using var stream = File.OpenRead(filePath);
+            return Convert.ToHexString(SHA256.HashData(stream));
+        }
+
+        /// <summary>
+        /// Encodes the content into a buffer rented from <see cref="ArrayPool{T}.Shared"/>; the caller returns it.
+        /// Line breaks are written as <see cref="Environment.NewLine"/>; a lone "\r" is kept as is.
+        /// </summary>
+        internal static byte[] EncodeWithNormalizedNewLines(string content, out int length)
+        {
+            var newLine = Utf8NoBom.GetBytes(Environment.NewLine);
+            var text = content.AsSpan();
+            var buffer = ArrayPool<byte>.Shared.Rent(text.Length + (text.Length >> 3) + 64);
+            length = 0;
+
+            while (true)
+            {
+                var lineEnd = text.IndexOf('\n');
+                var line = lineEnd < 0 ? text : text.Slice(0, lineEnd);
+                if (lineEnd >= 0 && line.Length > 0 && line[line.Length - 1] == '\r')
+                {
+                    line = line.Slice(0, line.Length - 1);
+                }
+
+                var required = length + Utf8NoBom.GetMaxByteCount(line.Length) + newLine.Length;
+                if (required > buffer.Length)
+                {
+                    var larger = ArrayPool<byte>.Shared.Rent(Math.Max(required, buffer.Length * 2));
+                    buffer.AsSpan(0, length).CopyTo(larger);
+                    ArrayPool<byte>.Shared.Return(buffer);
+                    buffer = larger;
+                }
+
+                length += Utf8NoBom.GetBytes(line, buffer.AsSpan(length));
+                if (lineEnd < 0)
+                    break;
+
+                newLine.CopyTo(buffer, length);
+                length += newLine.Length;
+                text = text.Slice(lineEnd + 1);
+            }
+
+            return buffer;
+        }
+    }
+}
@@ -0,0 +1,191 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Security.Cryptography;
+using CppToCsConverter.Core.Logging;
+using CppToCsConverter.Core.Models;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Persistent cache of parse results with one binary entry per parsed input file, so that unchanged inputs
+    /// are loaded instead of parsed again. An entry is keyed by the input's file name and the SHA-256 of its content,
+    /// which is all the parsers see of a file, and records the converter build that wrote it; entries written by
+    /// another build are ignored. Every load returns new objects, so callers may modify what they load.
+    /// </summary>
+    public sealed class ParsedModelCache
+    {
+        private const string EntryExtension = ".bin";
+
+        private readonly ILogger _logger;
+        private readonly ConcurrentDictionary<string, byte> _usedEntries = new ConcurrentDictionary<string, byte>(StringComparer.Ordinal);
+
+        /// <param name="directoryPath">Directory holding the entries; created when the first entry is saved</param>
+        /// <param name="logger">Receives warnings about unreadable or unwritable entries; defaults to the console</param>
+        public ParsedModelCache(string directoryPath, ILogger? logger = null)
+        {
+            DirectoryPath = directoryPath;
+            _logger = logger ?? new ConsoleLogger();
+        }
+
+        public string DirectoryPath { get; }
+
+        /// <summary>
+        /// Loads the classes declared in a header file as parsed by the converter, or returns null if the cache
+        /// has no entry for the file's current content
+        /// </summary>
+        public List<CppClass>? LoadHeader(string headerPath)
+        {
+            return TryLoadHeader(headerPath, ComputeHash(headerPath));
+        }
+
+        /// <summary>
+        /// Loads a parsed source file, or returns null if the cache has no entry for the file's current content
+        /// </summary>
+        public CppSourceFile? LoadSource(string sourcePath)
+        {
+            return TryLoadSource(sourcePath, ComputeHash(sourcePath));
+        }
+
+        /// <param name="hash">SHA-256 of the file content as an uppercase hex string</param>
+        internal List<CppClass>? TryLoadHeader(string filePath, string hash)
+        {
+            return TryLoad(filePath, hash, ParsedModelSerializer.ReadHeader);
+        }
+
+        /// <param name="hash">SHA-256 of the file content as an uppercase hex string</param>
+        internal CppSourceFile? TryLoadSource(string filePath, string hash)
+        {
+            return TryLoad(filePath, hash, ParsedModelSerializer.ReadSource);
+        }
+
+        /// <summary>
+        /// Stores the parse result of a header file. Must be called before linking, which updates the classes.
+        /// </summary>
+        internal void SaveHeader(string filePath, string hash, List<CppClass> classes)
+        {
+            Save(filePath, hash, stream => ParsedModelSerializer.WriteHeader(stream, classes));
+        }
+
+        /// <summary>
+        /// Stores the parse result of a source file. Must be called before linking, which updates its methods.
+        /// </summary>
+        internal void SaveSource(string filePath, string hash, CppSourceFile sourceFile)
+        {
+            Save(filePath, hash, stream => ParsedModelSerializer.WriteSource(stream, sourceFile));
+        }
+
+        /// <summary>
+        /// Starts tracking which entries a conversion run loads or saves, for <see cref="RemoveUnusedEntries"/>
+        /// </summary>
+        internal void BeginRun()
+        {
+            _usedEntries.Clear();
+        }
+
+        /// <summary>
+        /// Deletes the entries not loaded or saved since <see cref="BeginRun"/> (old content of changed inputs and
+        /// removed inputs) and leftover temporary files. Only valid after a run that parsed every input of the tree.
+        /// </summary>
+        internal int RemoveUnusedEntries()
+        {
+            if (!Directory.Exists(DirectoryPath))
+                return 0;
+
+            int removed = 0;
+            var entryPaths = Directory.GetFiles(DirectoryPath, "*" + EntryExtension);
+            var leftoverPaths = Directory.GetFiles(DirectoryPath, "*" + EntryExtension + ".*.tmp");
+            foreach (var entryPath in entryPaths.Concat(leftoverPaths))
+            {
+                if (_usedEntries.ContainsKey(Path.GetFileName(entryPath)))
+                    continue;
+
+                try
+                {
+                    File.Delete(entryPath);
+                    removed++;
+                }
+                catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+                {
+                    _logger.LogWarning($"Warning: Could not remove parse cache entry {entryPath}: {ex.Message}");
+                }
+            }
+            return removed;
+        }
+
+        private T? TryLoad<T>(string filePath, string hash, Func<Stream, T?> read) where T : class
+        {
+            var entryName = GetEntryName(filePath, hash);
+            var entryPath = Path.Combine(DirectoryPath, entryName);
+            try
+            {
+                // Entries are a few kilobytes; one read into an exact-size array beats a buffered stream per entry
+                var result = read(new MemoryStream(File.ReadAllBytes(entryPath), writable: false));
+                if (result != null)
+                {
+                    _usedEntries.TryAdd(entryName, 0);
+                }
+                return result;
+            }
+            catch (Exception ex) when (ex is FileNotFoundException || ex is DirectoryNotFoundException)
+            {
+                return null;
+            }
+            catch (Exception ex) when (ex is InvalidDataException || ex is IOException || ex is UnauthorizedAccessException)
+            {
+                // The entry is replaced when the file is parsed
+                _logger.LogWarning($"Warning: Ignoring unreadable parse cache entry {entryPath}: {ex.Message}");
+                return null;
+            }
+        }
+
+        private void Save(string filePath, string hash, Action<Stream> write)
+        {
+            var entryName = GetEntryName(filePath, hash);
+            var entryPath = Path.Combine(DirectoryPath, entryName);
+            var tempPath = entryPath + "." + Path.GetRandomFileName() + ".tmp";
+            try
+            {
+                Directory.CreateDirectory(DirectoryPath);
+
+                // Written to a temporary file and moved into place, so a reader never sees a partial entry
+                using (var stream = new FileStream(tempPath, FileMode.CreateNew, FileAccess.Write, FileShare.None, bufferSize: 16 * 1024))
+                {
+                    write(stream);
+                }
+                File.Move(tempPath, entryPath, overwrite: true);
+                _usedEntries.TryAdd(entryName, 0);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                _logger.LogWarning($"Warning: Could not write parse cache entry {entryPath}: {ex.Message}");
+                TryDelete(tempPath);
+            }
+        }
+
+        private static void TryDelete(string path)
+        {
+            try
+            {
+                File.Delete(path);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                // Left behind; the next full run removes it
+            }
+        }
+
+        private static string GetEntryName(string filePath, string hash)
+        {
+            return $"{Path.GetFileName(filePath)}.{hash}{EntryExtension}";
+        }
+
+        private static string ComputeHash(string filePath)
+        {
+            using var stream = File.OpenRead(filePath);
+            return Convert.ToHexString(SHA256.HashData(stream));
+        }
+    }
+}
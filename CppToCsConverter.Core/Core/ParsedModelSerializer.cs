@@ -0,0 +1,578 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Utils;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Binary format of a parse cache entry: a header (magic, format version, converter version, entry kind),
+    /// a table of the distinct strings of the entry, then the parsed model with every string written as an index
+    /// into that table. Types, access modifiers, region markers and empty strings repeat throughout a file,
+    /// so the table keeps entries small and a loaded model shares those strings instead of duplicating them.
+    /// </summary>
+    internal static class ParsedModelSerializer
+    {
+        public const int CurrentFormatVersion = 1;
+
+        private const int Magic = 0x4D504343; // "CCPM"
+        private const byte HeaderEntry = 1;
+        private const byte SourceEntry = 2;
+
+        public static void WriteHeader(Stream stream, List<CppClass> classes)
+        {
+            var writer = new ModelWriter();
+            writer.WriteList(classes, writer.WriteClass);
+            writer.CopyTo(stream, HeaderEntry);
+        }
+
+        public static void WriteSource(Stream stream, CppSourceFile sourceFile)
+        {
+            var writer = new ModelWriter();
+            writer.WriteSourceFile(sourceFile);
+            writer.CopyTo(stream, SourceEntry);
+        }
+
+        /// <summary>
+        /// Reads the classes of a header entry, or returns null if the entry was written by another format or converter version
+        /// </summary>
+        /// <exception cref="InvalidDataException">The stream is not a header entry or is truncated</exception>
+        public static List<CppClass>? ReadHeader(Stream stream)
+        {
+            return Read(stream, HeaderEntry, reader => reader.ReadList(reader.ReadClass));
+        }
+
+        /// <summary>
+        /// Reads a source entry, or returns null if the entry was written by another format or converter version
+        /// </summary>
+        /// <exception cref="InvalidDataException">The stream is not a source entry or is truncated</exception>
+        public static CppSourceFile? ReadSource(Stream stream)
+        {
+            return Read(stream, SourceEntry, reader => reader.ReadSourceFile());
+        }
+
+        private static T? Read<T>(Stream stream, byte kind, Func<ModelReader, T> read) where T : class
+        {
+            try
+            {
+                var reader = ModelReader.Open(stream, kind);
+                return reader != null ? read(reader) : null;
+            }
+            catch (Exception ex) when (ex is EndOfStreamException || ex is FormatException || ex is ArgumentOutOfRangeException)
+            {
+                // Truncated entry, or a count or string length that was not written by this format
+                throw new InvalidDataException("Parse cache entry is truncated or corrupt", ex);
+            }
+        }
+
+        private sealed class ModelWriter
+        {
+            private readonly MemoryStream _body = new MemoryStream();
+            private readonly BinaryWriter _writer;
+            private readonly Dictionary<string, int> _stringIndices = new Dictionary<string, int>(StringComparer.Ordinal);
+            private readonly List<string> _strings = new List<string>();
+
+            public ModelWriter()
+            {
+                _writer = new BinaryWriter(_body, Encoding.UTF8, leaveOpen: true);
+            }
+
+            /// <summary>
+            /// Writes the entry header and string table, then the model written so far
+            /// </summary>
+            public void CopyTo(Stream stream, byte kind)
+            {
+                using var writer = new BinaryWriter(stream, Encoding.UTF8, leaveOpen: true);
+                writer.Write(Magic);
+                writer.Write(CurrentFormatVersion);
+                writer.Write(IncrementalManifest.CurrentConverterVersion);
+                writer.Write(kind);
+                writer.Write7BitEncodedInt(_strings.Count);
+                foreach (var value in _strings)
+                {
+                    writer.Write(value);
+                }
+                writer.Flush();
+
+                _writer.Flush();
+                _body.Position = 0;
+                _body.CopyTo(stream);
+            }
+
+            public void WriteList<T>(IReadOnlyList<T> items, Action<T> writeItem)
+            {
+                _writer.Write7BitEncodedInt(items.Count);
+                foreach (var item in items)
+                {
+                    writeItem(item);
+                }
+            }
+
+            public void WriteSourceFile(CppSourceFile sourceFile)
+            {
+                WriteString(sourceFile.FileName);
+                WriteStrings(sourceFile.FileTopComments);
+                WriteList(sourceFile.Methods, WriteMethod);
+                WriteList(sourceFile.StaticMemberInits, WriteStaticMemberInit);
+                WriteList(sourceFile.Defines, WriteDefine);
+                WriteList(sourceFile.Structs, WriteStruct);
+                WriteList(sourceFile.Regions, WriteRegion);
+            }
+
+            public void WriteClass(CppClass cppClass)
+            {
+                WriteString(cppClass.Name);
+                _writer.Write(cppClass.IsInterface);
+                _writer.Write(cppClass.IsStruct);
+                _writer.Write(cppClass.IsPublicExport);
+                WriteStrings(cppClass.BaseClasses);
+                WriteList(cppClass.Members, WriteMember);
+                WriteList(cppClass.Methods, WriteMethod);
+                WriteList(cppClass.StaticMembers, WriteStaticMember);
+                WriteStrings(cppClass.PrecedingComments);
+                WriteList(cppClass.HeaderDefines, WriteDefine);
+                WriteList(cppClass.SourceDefines, WriteDefine);
+                WriteList(cppClass.Regions, WriteRegion);
+            }
+
+            // 0 is null; other strings are written as their table position plus one
+            private void WriteString(string? value)
+            {
+                if (value == null)
+                {
+                    _writer.Write7BitEncodedInt(0);
+                    return;
+                }
+
+                if (!_stringIndices.TryGetValue(value, out var index))
+                {
+                    _strings.Add(value);
+                    index = _strings.Count;
+                    _stringIndices.Add(value, index);
+                }
+                _writer.Write7BitEncodedInt(index);
+            }
+
+            private void WriteStrings(IReadOnlyList<string> values)
+            {
+                _writer.Write7BitEncodedInt(values.Count);
+                foreach (var value in values)
+                {
+                    WriteString(value);
+                }
+            }
+
+            private void WriteMethod(CppMethod method)
+            {
+                WriteString(method.Name);
+                WriteString(method.ReturnType);
+                WriteList(method.Parameters, WriteParameter);
+                _writer.Write((byte)method.AccessSpecifier);
+                _writer.Write(method.IsStatic);
+                _writer.Write(method.IsVirtual);
+                _writer.Write(method.IsPureVirtual);
+                _writer.Write(method.IsConstructor);
+                _writer.Write(method.IsDestructor);
+                _writer.Write(method.IsConst);
+                _writer.Write(method.IsLocalMethod);
+                _writer.Write(method.HasInlineImplementation);
+                WriteString(method.InlineImplementation);
+                WriteString(method.ImplementationBody);
+                _writer.Write(method.HasResolvedImplementation);
+                WriteString(method.ClassName);
+                _writer.Write7BitEncodedInt(method.OrderIndex);
+                WriteString(method.TargetFileName);
+                WriteList(method.MemberInitializerListOrEmpty, WriteMemberInitializer);
+                WriteStrings(method.HeaderCommentsOrEmpty);
+                WriteStrings(method.SourceCommentsOrEmpty);
+                WriteString(method.HeaderRegionStart);
+                WriteString(method.HeaderRegionEnd);
+                WriteString(method.SourceRegionStart);
+                WriteString(method.SourceRegionEnd);
+                _writer.Write7BitEncodedInt(method.HeaderCommentIndentation);
+                _writer.Write7BitEncodedInt(method.SourceCommentIndentation);
+                _writer.Write7BitEncodedInt(method.ImplementationIndentation);
+            }
+
+            private void WriteParameter(CppParameter parameter)
+            {
+                WriteString(parameter.Type);
+                WriteString(parameter.Name);
+                WriteString(parameter.DefaultValue);
+                _writer.Write(parameter.IsReference);
+                _writer.Write(parameter.IsPointer);
+                _writer.Write(parameter.IsConst);
+                WriteStrings(parameter.InlineCommentsOrEmpty);
+                WriteList(parameter.PositionedCommentsOrEmpty, comment =>
+                {
+                    WriteString(comment.CommentText);
+                    _writer.Write((byte)comment.Position);
+                });
+                WriteString(parameter.OriginalText);
+                _writer.Write(parameter.HasLineBreak);
+                _writer.Write7BitEncodedInt(parameter.OriginalIndent);
+                WriteString(parameter.CanonicalSignature);
+            }
+
+            private void WriteMember(CppMember member)
+            {
+                WriteString(member.Type);
+                WriteString(member.Name);
+                _writer.Write((byte)member.AccessSpecifier);
+                _writer.Write(member.IsStatic);
+                _writer.Write(member.IsConst);
+                WriteString(member.InitializationValue);
+                _writer.Write(member.IsArray);
+                WriteString(member.ArraySize);
+                WriteStrings(member.PrecedingCommentsOrEmpty);
+                WriteString(member.PostfixComment);
+                WriteString(member.RegionStart);
+                WriteString(member.RegionEnd);
+                _writer.Write7BitEncodedInt(member.OrderIndex);
+            }
+
+            private void WriteStaticMember(CppStaticMember member)
+            {
+                WriteString(member.Type);
+                WriteString(member.Name);
+                WriteString(member.InitializationValue);
+                _writer.Write(member.IsArray);
+                WriteString(member.ArraySize);
+            }
+
+            private void WriteStaticMemberInit(CppStaticMemberInit init)
+            {
+                WriteString(init.ClassName);
+                WriteString(init.MemberName);
+                WriteString(init.InitializationValue);
+                _writer.Write(init.IsArray);
+                WriteString(init.ArraySize);
+                WriteString(init.Type);
+                _writer.Write(init.IsConst);
+            }
+
+            private void WriteMemberInitializer(CppMemberInitializer initializer)
+            {
+                WriteString(initializer.MemberName);
+                WriteString(initializer.InitializationValue);
+            }
+
+            private void WriteDefine(CppDefine define)
+            {
+                WriteString(define.Name);
+                WriteString(define.Value);
+                WriteString(define.FullDefinition);
+                WriteStrings(define.PrecedingComments);
+                WriteString(define.PostfixComment);
+                WriteString(define.SourceFileName);
+                _writer.Write(define.IsFromHeader);
+                _writer.Write7BitEncodedInt(define.OrderIndex);
+            }
+
+            private void WriteRegion(CppRegion region)
+            {
+                WriteString(region.Text);
+                _writer.Write(region.IsStart);
+                _writer.Write7BitEncodedInt(region.OrderIndex);
+                WriteString(region.SourceFileName);
+                _writer.Write(region.IsFromHeader);
+            }
+
+            private void WriteStruct(CppStruct cppStruct)
+            {
+                WriteString(cppStruct.Name);
+                WriteString(cppStruct.OriginalDefinition);
+                _writer.Write((byte)cppStruct.Type);
+                WriteStrings(cppStruct.PrecedingComments);
+                WriteList(cppStruct.Members, WriteMember);
+                WriteList(cppStruct.Methods, WriteMethod);
+            }
+        }
+
+        private sealed class ModelReader
+        {
+            private readonly BinaryReader _reader;
+            private readonly string[] _strings;
+
+            private ModelReader(BinaryReader reader, string[] strings)
+            {
+                _reader = reader;
+                _strings = strings;
+            }
+
+            /// <summary>
+            /// Reads the entry header and string table; returns null if the entry is from another format or converter version
+            /// </summary>
+            public static ModelReader? Open(Stream stream, byte expectedKind)
+            {
+                var reader = new BinaryReader(stream, Encoding.UTF8, leaveOpen: true);
+                if (reader.ReadInt32() != Magic)
+                    throw new InvalidDataException("Not a parse cache entry");
+                if (reader.ReadInt32() != CurrentFormatVersion || reader.ReadString() != IncrementalManifest.CurrentConverterVersion)
+                    return null;
+                if (reader.ReadByte() != expectedKind)
+                    throw new InvalidDataException("Parse cache entry is of the wrong kind");
+
+                var strings = new string[reader.Read7BitEncodedInt()];
+                for (int i = 0; i < strings.Length; i++)
+                {
+                    strings[i] = StringPool.Intern(reader.ReadString()); // Shared with the other entries of the run
+                }
+                return new ModelReader(reader, strings);
+            }
+
+            // String lists are by far the most common, so they are read without a delegate per list
+            public List<string> ReadStrings()
+            {
+                return ReadStrings(_reader.Read7BitEncodedInt());
+            }
+
+            private List<string> ReadStrings(int count)
+            {
+                var items = new List<string>(count);
+                for (int i = 0; i < count; i++)
+                {
+                    items.Add(ReadString());
+                }
+                return items;
+            }
+
+            public List<T> ReadList<T>(Func<T> readItem)
+            {
+                return ReadList(_reader.Read7BitEncodedInt(), readItem);
+            }
+
+            private List<T> ReadList<T>(int count, Func<T> readItem)
+            {
+                var items = new List<T>(count);
+                for (int i = 0; i < count; i++)
+                {
+                    items.Add(readItem());
+                }
+                return items;
+            }
+
+            /// <summary>
+            /// Reads a string list into a model list that is allocated on first use; an empty list is read as null
+            /// </summary>
+            private List<string>? ReadOptionalStrings()
+            {
+                var count = _reader.Read7BitEncodedInt();
+                return count > 0 ? ReadStrings(count) : null;
+            }
+
+            /// <summary>
+            /// Reads a list into a model list that is allocated on first use; an empty list is read as null
+            /// </summary>
+            private List<T>? ReadOptionalList<T>(Func<T> readItem)
+            {
+                var count = _reader.Read7BitEncodedInt();
+                return count > 0 ? ReadList(count, readItem) : null;
+            }
+
+            public CppSourceFile ReadSourceFile()
+            {
+                return new CppSourceFile
+                {
+                    FileName = ReadString(),
+                    FileTopComments = ReadStrings(),
+                    Methods = ReadList(ReadMethod),
+                    StaticMemberInits = ReadList(ReadStaticMemberInit),
+                    Defines = ReadList(ReadDefine),
+                    Structs = ReadList(ReadStruct),
+                    Regions = ReadList(ReadRegion)
+                };
+            }
+
+            public CppClass ReadClass()
+            {
+                return new CppClass
+                {
+                    Name = ReadString(),
+                    IsInterface = _reader.ReadBoolean(),
+                    IsStruct = _reader.ReadBoolean(),
+                    IsPublicExport = _reader.ReadBoolean(),
+                    BaseClasses = ReadStrings(),
+                    Members = ReadList(ReadMember),
+                    Methods = ReadList(ReadMethod),
+                    StaticMembers = ReadList(ReadStaticMember),
+                    PrecedingComments = ReadStrings(),
+                    HeaderDefines = ReadList(ReadDefine),
+                    SourceDefines = ReadList(ReadDefine),
+                    Regions = ReadList(ReadRegion)
+                };
+            }
+
+            private string ReadString()
+            {
+                var index = _reader.Read7BitEncodedInt();
+                if (index == 0)
+                    return null!; // Written for a null string, which the model allows even though it does not declare it
+                if ((uint)index > (uint)_strings.Length)
+                    throw new InvalidDataException("Parse cache entry refers to a missing string");
+                return _strings[index - 1];
+            }
+
+            private CppMethod ReadMethod()
+            {
+                // Object initializers run in order, which is the order the fields were written
+                return new CppMethod
+                {
+                    Name = ReadString(),
+                    ReturnType = ReadString(),
+                    Parameters = ReadList(ReadParameter),
+                    AccessSpecifier = (AccessSpecifier)_reader.ReadByte(),
+                    IsStatic = _reader.ReadBoolean(),
+                    IsVirtual = _reader.ReadBoolean(),
+                    IsPureVirtual = _reader.ReadBoolean(),
+                    IsConstructor = _reader.ReadBoolean(),
+                    IsDestructor = _reader.ReadBoolean(),
+                    IsConst = _reader.ReadBoolean(),
+                    IsLocalMethod = _reader.ReadBoolean(),
+                    HasInlineImplementation = _reader.ReadBoolean(),
+                    InlineImplementation = ReadString(),
+                    ImplementationBody = ReadString(),
+                    HasResolvedImplementation = _reader.ReadBoolean(),
+                    ClassName = ReadString(),
+                    OrderIndex = _reader.Read7BitEncodedInt(),
+                    TargetFileName = ReadString(),
+                    MemberInitializerList = ReadOptionalList(ReadMemberInitializer),
+                    HeaderComments = ReadOptionalStrings(),
+                    SourceComments = ReadOptionalStrings(),
+                    HeaderRegionStart = ReadString(),
+                    HeaderRegionEnd = ReadString(),
+                    SourceRegionStart = ReadString(),
+                    SourceRegionEnd = ReadString(),
+                    HeaderCommentIndentation = _reader.Read7BitEncodedInt(),
+                    SourceCommentIndentation = _reader.Read7BitEncodedInt(),
+                    ImplementationIndentation = _reader.Read7BitEncodedInt()
+                };
+            }
+
+            private CppParameter ReadParameter()
+            {
+                return new CppParameter
+                {
+                    Type = ReadString(),
+                    Name = ReadString(),
+                    DefaultValue = ReadString(),
+                    IsReference = _reader.ReadBoolean(),
+                    IsPointer = _reader.ReadBoolean(),
+                    IsConst = _reader.ReadBoolean(),
+                    InlineComments = ReadOptionalStrings(),
+                    PositionedComments = ReadOptionalList(ReadParameterComment),
+                    OriginalText = ReadString(),
+                    HasLineBreak = _reader.ReadBoolean(),
+                    OriginalIndent = _reader.Read7BitEncodedInt(),
+                    CanonicalSignature = ReadString()
+                };
+            }
+
+            private ParameterComment ReadParameterComment()
+            {
+                return new ParameterComment
+                {
+                    CommentText = ReadString(),
+                    Position = (CommentPosition)_reader.ReadByte()
+                };
+            }
+
+            private CppMember ReadMember()
+            {
+                return new CppMember
+                {
+                    Type = ReadString(),
+                    Name = ReadString(),
+                    AccessSpecifier = (AccessSpecifier)_reader.ReadByte(),
+                    IsStatic = _reader.ReadBoolean(),
+                    IsConst = _reader.ReadBoolean(),
+                    InitializationValue = ReadString(),
+                    IsArray = _reader.ReadBoolean(),
+                    ArraySize = ReadString(),
+                    PrecedingComments = ReadOptionalStrings(),
+                    PostfixComment = ReadString(),
+                    RegionStart = ReadString(),
+                    RegionEnd = ReadString(),
+                    OrderIndex = _reader.Read7BitEncodedInt()
+                };
+            }
+
+            private CppStaticMember ReadStaticMember()
+            {
+                return new CppStaticMember
+                {
+                    Type = ReadString(),
+                    Name = ReadString(),
+                    InitializationValue = ReadString(),
+                    IsArray = _reader.ReadBoolean(),
+                    ArraySize = ReadString()
+                };
+            }
+
+            private CppStaticMemberInit ReadStaticMemberInit()
+            {
+                return new CppStaticMemberInit
+                {
+                    ClassName = ReadString(),
+                    MemberName = ReadString(),
+                    InitializationValue = ReadString(),
+                    IsArray = _reader.ReadBoolean(),
+                    ArraySize = ReadString(),
+                    Type = ReadString(),
+                    IsConst = _reader.ReadBoolean()
+                };
+            }
+
+            private CppMemberInitializer ReadMemberInitializer()
+            {
+                return new CppMemberInitializer
+                {
+                    MemberName = ReadString(),
+                    InitializationValue = ReadString()
+                };
+            }
+
+            private CppDefine ReadDefine()
+            {
+                return new CppDefine
+                {
+                    Name = ReadString(),
+                    Value = ReadString(),
+                    FullDefinition = ReadString(),
+                    PrecedingComments = ReadStrings(),
+                    PostfixComment = ReadString(),
+                    SourceFileName = ReadString(),
+                    IsFromHeader = _reader.ReadBoolean(),
+                    OrderIndex = _reader.Read7BitEncodedInt()
+                };
+            }
+
+            private CppRegion ReadRegion()
+            {
+                return new CppRegion
+                {
+                    Text = ReadString(),
+                    IsStart = _reader.ReadBoolean(),
+                    OrderIndex = _reader.Read7BitEncodedInt(),
+                    SourceFileName = ReadString(),
+                    IsFromHeader = _reader.ReadBoolean()
+                };
+            }
+
+            private CppStruct ReadStruct()
+            {
+                return new CppStruct
+                {
+                    Name = ReadString(),
+                    OriginalDefinition = ReadString(),
+                    Type = (StructType)_reader.ReadByte(),
+                    PrecedingComments = ReadStrings(),
+                    Members = ReadList(ReadMember),
+                    Methods = ReadList(ReadMethod)
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Core.Core
+{
+    /// <summary>
+    /// Global lookup of the classes and interfaces of a conversion, built once by the link stage from the linked
+    /// header units and the <see cref="ImplementationIndex"/>. Resolves the class each public interface factory
+    /// constructs, lists the defines classes and the types declared by more than one header unit, so generation
+    /// answers these with dictionary lookups instead of scanning the model.
+    /// Read-only after construction, so generation of different header file units can share it.
+    /// </summary>
+    internal class SymbolIndex
+    {
+        private readonly Dictionary<string, (CppClass Declaration, string HeaderFileName)> _classes = new Dictionary<string, (CppClass, string)>(StringComparer.Ordinal);
+        private readonly Dictionary<CppClass, string?> _factoryCreatedClasses = new Dictionary<CppClass, string?>(ReferenceEqualityComparer.Instance);
+        private readonly List<string> _definesClasses = new List<string>();
+        private readonly HashSet<string> _definesClassNames = new HashSet<string>(StringComparer.Ordinal);
+        private readonly List<(string ClassName, string FirstHeader, string SecondHeader)> _redeclarations = new List<(string, string, string)>();
+
+        /// <param name="headerFileClasses">Classes per header file unit, in input order</param>
+        /// <param name="implementations">Source methods of the same conversion</param>
+        public SymbolIndex(Dictionary<string, List<CppClass>> headerFileClasses, ImplementationIndex implementations)
+        {
+            foreach (var unit in headerFileClasses)
+            {
+                foreach (var cppClass in unit.Value)
+                {
+                    if (_classes.TryGetValue(cppClass.Name, out var existing) && !existing.Declaration.IsStruct && !cppClass.IsStruct)
+                    {
+                        _redeclarations.Add((cppClass.Name, existing.HeaderFileName, unit.Key));
+                    }
+                    _classes[cppClass.Name] = (cppClass, unit.Key);
+
+                    if (cppClass.IsInterface && cppClass.IsPublicExport)
+                    {
+                        _factoryCreatedClasses[cppClass] = ResolveFactoryCreatedClass(cppClass, implementations.GetMethodsForClass(cppClass.Name));
+
+                        if (cppClass.HeaderDefines.Count > 0)
+                        {
+                            var definesClassName = GetDefinesClassName(cppClass);
+                            if (_definesClassNames.Add(definesClassName))
+                            {
+                                _definesClasses.Add(definesClassName);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Names of the XDefines classes generated for public interfaces, in header order without duplicates
+        /// </summary>
+        public IReadOnlyList<string> DefinesClasses => _definesClasses;
+
+        /// <summary>
+        /// Non-struct types declared in more than one header unit, with the unit of the earlier and of the later declaration.
+        /// Lookups by name return the later one.
+        /// </summary>
+        public IReadOnlyList<(string ClassName, string FirstHeader, string SecondHeader)> Redeclarations => _redeclarations;
+
+        /// <summary>
+        /// The class constructed by a public interface's static factory, e.g. CSample for
+        /// <c>ISample* ISample::Create() { return new CSample(); }</c>, or null if it has none or it cannot be determined
+        /// </summary>
+        public string? GetFactoryCreatedClass(CppClass publicInterface)
+        {
+            return _factoryCreatedClasses.TryGetValue(publicInterface, out var createdClass) ? createdClass : null;
+        }
+
+        public static string GetDefinesClassName(CppClass publicInterface)
+        {
+            return publicInterface.Name.TrimStart('I') + "Defines";
+        }
+
+        /// <summary>
+        /// The factory is the interface's first public static method. The constructed class is taken from the first
+        /// <c>new X(</c> in the body of its first source implementation, or else from <c>X* p = new Y(</c>.
+        /// </summary>
+        /// <param name="interfaceImplementations">Source methods of the interface, in source file order</param>
+        internal static string? ResolveFactoryCreatedClass(CppClass cppInterface, IEnumerable<CppMethod> interfaceImplementations)
+        {
+            var staticFactoryMethod = cppInterface.Methods
+                .FirstOrDefault(m => m.IsStatic && m.AccessSpecifier == AccessSpecifier.Public);
+
+            if (staticFactoryMethod == null)
+                return null;
+
+            var implementation = interfaceImplementations.FirstOrDefault(impl =>
+                impl.Name == staticFactoryMethod.Name &&
+                !impl.ImplementationBodyText.IsEmpty);
+
+            if (implementation == null)
+                return null;
+
+            var body = implementation.ImplementationBody;
+            var match = CppPatterns.NewExpression().Match(body);
+            if (match.Success)
+            {
+                return match.Groups[1].Value;
+            }
+
+            match = CppPatterns.PointerInitializedWithNew().Match(body);
+            return match.Success ? match.Groups[2].Value : null;
+        }
+    }
+}
@@ -2,7 +2,11 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
 using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Logging;
+using CppToCsConverter.Core.Models;
 
 namespace CppToCsConverter.Core
 {
@@ -22,6 +26,84 @@ namespace CppToCsConverter.Core
             _converter = new CppToCsStructuralConverter();
         }
 
+        /// <summary>
+        /// Initializes a new instance of the CppToCsConverterApi that reports all output through the given logger.
+        /// </summary>
+        /// <param name="logger">Receives progress, warning and error messages, e.g. a <see cref="ConsoleLogger"/> with a chosen verbosity</param>
+        public CppToCsConverterApi(ILogger logger)
+        {
+            _converter = new CppToCsStructuralConverter(logger);
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of files parsed or generated concurrently.
+        /// Defaults to the processor count; 1 converts sequentially. Output does not depend on this value.
+        /// </summary>
+        public int MaxDegreeOfParallelism
+        {
+            get => _converter.MaxDegreeOfParallelism;
+            set => _converter.MaxDegreeOfParallelism = value;
+        }
+
+        /// <summary>
+        /// Gets or sets whether conversion is incremental. An incremental run keeps a manifest of input hashes
+        /// in the output directory and only regenerates the output files affected by changed inputs.
+        /// </summary>
+        public bool Incremental
+        {
+            get => _converter.Incremental;
+            set => _converter.Incremental = value;
+        }
+
+        /// <summary>
+        /// Gets or sets the directory of a persistent parse cache, or null (the default) to parse every input.
+        /// Inputs whose content is in the cache are loaded instead of parsed; see <see cref="ParsedModelCache"/>.
+        /// </summary>
+        public string? ParseCacheDirectory
+        {
+            get => _converter.ParseCacheDirectory;
+            set => _converter.ParseCacheDirectory = value;
+        }
+
+        /// <summary>
+        /// Gets or sets the approximate memory budget in bytes, or null (the default) to convert all files at once.
+        /// With a budget, groups of headers and the sources implementing their classes are converted in batches that fit it,
+        /// with the same output; see <see cref="CppToCsStructuralConverter.MemoryBudgetBytes"/>.
+        /// </summary>
+        public long? MemoryBudgetBytes
+        {
+            get => _converter.MemoryBudgetBytes;
+            set => _converter.MemoryBudgetBytes = value;
+        }
+
+        /// <summary>
+        /// Gets or sets whether <see cref="ConvertSpecificFiles"/> also parses the inputs the listed files need from the rest
+        /// of the source directory: the sources implementing their classes and the headers declaring defines classes.
+        /// Only the listed files' output is written; see <see cref="CppToCsStructuralConverter.ResolveDependencies"/>.
+        /// </summary>
+        public bool ResolveDependencies
+        {
+            get => _converter.ResolveDependencies;
+            set => _converter.ResolveDependencies = value;
+        }
+
+        /// <summary>
+        /// Gets or sets the longest time the parse of one input file or the generation of one header file's output may take,
+        /// or null (the default) for no limit. Files over budget are left out and listed in <see cref="ConversionMetrics.Quarantined"/>;
+        /// see <see cref="CppToCsStructuralConverter.FileTimeBudget"/>.
+        /// </summary>
+        public TimeSpan? FileTimeBudget
+        {
+            get => _converter.FileTimeBudget;
+            set => _converter.FileTimeBudget = value;
+        }
+
+        /// <summary>
+        /// Gets the per-stage, per-file and per-unit timings, allocations and element counts of the last conversion,
+        /// or null if nothing has been converted yet.
+        /// </summary>
+        public ConversionMetrics? LastMetrics => _converter.LastMetrics;
+
         /// <summary>
         /// Converts C++ files from a source directory to C# equivalents.
         /// </summary>
@@ -32,6 +114,57 @@ namespace CppToCsConverter.Core
             _converter.ConvertDirectory(sourceDirectory, outputDirectory);
         }
 
+        /// <summary>
+        /// Converts C++ files from a source directory to C# equivalents without blocking the caller.
+        /// </summary>
+        /// <param name="sourceDirectory">The directory containing C++ files to convert</param>
+        /// <param name="outputDirectory">The directory where C# files will be generated</param>
+        /// <param name="progress">Receives an event as each stage starts and completes and as each file is parsed and generated</param>
+        /// <param name="cancellationToken">Stops the conversion; the task then throws <see cref="OperationCanceledException"/></param>
+        public Task ConvertDirectoryAsync(string sourceDirectory, string outputDirectory, IProgress<ConversionProgress>? progress = null, CancellationToken cancellationToken = default)
+        {
+            return _converter.ConvertDirectoryAsync(sourceDirectory, outputDirectory, progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Converts a directory and keeps converting it incrementally whenever a .h or .cpp file in it changes,
+        /// until the returned watcher is disposed. This converter must not be used for other conversions meanwhile.
+        /// </summary>
+        /// <param name="sourceDirectory">The directory containing C++ files to convert</param>
+        /// <param name="outputDirectory">The directory where C# files will be generated</param>
+        /// <returns>The started watcher; subscribe to <see cref="ConversionWatcher.Converted"/> to observe each run</returns>
+        public ConversionWatcher WatchDirectory(string sourceDirectory, string outputDirectory)
+        {
+            var watcher = new ConversionWatcher(_converter, sourceDirectory, outputDirectory);
+            watcher.Start();
+            return watcher;
+        }
+
+        /// <summary>
+        /// Converts several source directories in this process, some of them at the same time, with this converter's
+        /// logger and settings. With a parse cache directory every job gets its own subdirectory of it.
+        /// </summary>
+        /// <param name="jobs">The conversions to run, e.g. from <see cref="ConversionJob.LoadJobFile"/></param>
+        /// <param name="maxConcurrentJobs">Maximum number of jobs converted at the same time; defaults to the processor count</param>
+        /// <returns>One result per job, in job order; failed jobs carry the error instead of stopping the batch</returns>
+        public IReadOnlyList<ConversionJobResult> ConvertBatch(IReadOnlyList<ConversionJob> jobs, int? maxConcurrentJobs = null)
+        {
+            var batch = new ConversionBatch(_converter.Logger)
+            {
+                MaxDegreeOfParallelism = _converter.MaxDegreeOfParallelism,
+                Incremental = _converter.Incremental,
+                ParseCacheDirectory = _converter.ParseCacheDirectory,
+                MemoryBudgetBytes = _converter.MemoryBudgetBytes,
+                ResolveDependencies = _converter.ResolveDependencies,
+                FileTimeBudget = _converter.FileTimeBudget
+            };
+            if (maxConcurrentJobs.HasValue)
+            {
+                batch.MaxConcurrentJobs = maxConcurrentJobs.Value;
+            }
+            return batch.Run(jobs);
+        }
+
         /// <summary>
         /// Converts specific C++ files from a source directory to C# equivalents.
         /// </summary>
@@ -43,6 +176,19 @@ namespace CppToCsConverter.Core
             _converter.ConvertSpecificFiles(sourceDirectory, specificFiles, outputDirectory);
         }
 
+        /// <summary>
+        /// Converts specific C++ files from a source directory to C# equivalents without blocking the caller.
+        /// </summary>
+        /// <param name="sourceDirectory">The directory containing C++ files to convert</param>
+        /// <param name="specificFiles">Array of specific files to convert</param>
+        /// <param name="outputDirectory">The directory where C# files will be generated</param>
+        /// <param name="progress">Receives an event as each stage starts and completes and as each file is parsed and generated</param>
+        /// <param name="cancellationToken">Stops the conversion; the task then throws <see cref="OperationCanceledException"/></param>
+        public Task ConvertSpecificFilesAsync(string sourceDirectory, string[] specificFiles, string outputDirectory, IProgress<ConversionProgress>? progress = null, CancellationToken cancellationToken = default)
+        {
+            return _converter.ConvertSpecificFilesAsync(sourceDirectory, specificFiles, outputDirectory, progress, cancellationToken);
+        }
+
         /// <summary>
         /// Converts specific C++ header and source files to C# equivalents.
         /// </summary>
@@ -56,6 +202,35 @@ namespace CppToCsConverter.Core
             _converter.ConvertFiles(headerFiles, sourceFiles, outputDirectory, sourceDirectory);
         }
 
+        /// <summary>
+        /// Converts C++ files held in memory without reading or writing files (apart from parse cache entries).
+        /// The generated C# files, including partial class files and the defines classes of public interfaces,
+        /// are returned as each header file is generated, in the order <see cref="ConvertFiles"/> writes them.
+        /// </summary>
+        /// <param name="files">Path and content of each .h and .cpp file; the paths give the file names and the namespace</param>
+        /// <param name="cancellationToken">Stops the conversion; enumeration then throws <see cref="OperationCanceledException"/></param>
+        /// <returns>Generated files whose <see cref="GeneratedFile.FilePath"/> is the file name, e.g. "CSample.cs"</returns>
+        public IAsyncEnumerable<GeneratedFile> ConvertInMemoryAsync(IEnumerable<KeyValuePair<string, string>> files, CancellationToken cancellationToken = default)
+        {
+            var inputs = files.ToList();
+            string sourceDirectory = ExtractSourceDirectoryFromFiles(inputs.Select(f => f.Key).ToArray(), Array.Empty<string>());
+            return _converter.ConvertInMemoryAsync(inputs, sourceDirectory, cancellationToken);
+        }
+
+        /// <summary>
+        /// Converts C++ files read from streams without writing files, like <see cref="ConvertInMemoryAsync(IEnumerable{KeyValuePair{string, string}}, CancellationToken)"/>.
+        /// Every stream is read to its end before parsing starts; the caller keeps ownership of the streams.
+        /// </summary>
+        /// <param name="files">Path and content stream of each .h and .cpp file</param>
+        /// <param name="cancellationToken">Stops the conversion; enumeration then throws <see cref="OperationCanceledException"/></param>
+        /// <returns>Generated files whose <see cref="GeneratedFile.FilePath"/> is the file name, e.g. "CSample.cs"</returns>
+        public IAsyncEnumerable<GeneratedFile> ConvertInMemoryAsync(IEnumerable<KeyValuePair<string, Stream>> files, CancellationToken cancellationToken = default)
+        {
+            var inputs = files.ToList();
+            string sourceDirectory = ExtractSourceDirectoryFromFiles(inputs.Select(f => f.Key).ToArray(), Array.Empty<string>());
+            return _converter.ConvertInMemoryAsync(inputs, sourceDirectory, cancellationToken);
+        }
+
         /// <summary>
         /// Extracts the source directory from the provided file paths for namespace resolution.
         /// </summary>
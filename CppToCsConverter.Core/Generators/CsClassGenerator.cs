@@ -2,6 +2,7 @@ using System;
 using System.Collections.Generic;
 using System.Linq;
 using System.Text;
+using CppToCsConverter.Core.Logging;
 using CppToCsConverter.Core.Models;
 
 namespace CppToCsConverter.Core.Generators
@@ -9,10 +10,12 @@ namespace CppToCsConverter.Core.Generators
     public class CsClassGenerator
     {
         private readonly TypeConverter _typeConverter;
+        private readonly ILogger _logger;
 
-        public CsClassGenerator()
+        public CsClassGenerator(ILogger? logger = null)
         {
             _typeConverter = new TypeConverter();
+            _logger = logger ?? new ConsoleLogger();
         }
 
         public string GenerateClass(CppClass cppClass, List<CppMethod> implementationMethods, string fileName)
@@ -41,12 +44,8 @@ namespace CppToCsConverter.Core.Generators
 
             if (isHeaderOnlyGeneration)
             {
-                // Write warning to console with yellow color
-                var currentColor = Console.ForegroundColor;
-                Console.ForegroundColor = ConsoleColor.Yellow;
-                Console.WriteLine($"⚠️  WARNING: Generating '{fileName}' from header-only content. Methods will contain TODO implementations.");
-                Console.WriteLine($"    Class: {cppClass.Name} | Header methods: {cppClass.Methods.Count} | Implementation methods: {availableImplementations}");
-                Console.ForegroundColor = currentColor;
+                _logger.LogWarning($"⚠️  WARNING: Generating '{fileName}' from header-only content. Methods will contain TODO implementations.{Environment.NewLine}" +
+                                   $"    Class: {cppClass.Name} | Header methods: {cppClass.Methods.Count} | Implementation methods: {availableImplementations}");
             }
 
             var sb = new StringBuilder();
@@ -174,7 +173,7 @@ namespace CppToCsConverter.Core.Generators
             }
 
             // Add comments from .h file with proper indentation
-            if (method.HeaderComments.Any())
+            if (method.HeaderCommentsOrEmpty.Count > 0)
             {
                 var indentedComments = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodComments(
                     method.HeaderComments, method.HeaderCommentIndentation);
@@ -185,7 +184,7 @@ namespace CppToCsConverter.Core.Generators
             }
 
             // Add comments from .cpp file with proper indentation
-            if (method.SourceComments.Any())
+            if (method.SourceCommentsOrEmpty.Count > 0)
             {
                 var indentedComments = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodComments(
                     method.SourceComments, method.SourceCommentIndentation);
@@ -224,7 +223,7 @@ namespace CppToCsConverter.Core.Generators
             if (method.HasInlineImplementation)
             {
                 // For constructors with member initializer lists, add them first
-                if (method.IsConstructor && method.MemberInitializerList.Count > 0)
+                if (method.IsConstructor && method.MemberInitializerListOrEmpty.Count > 0)
                 {
 
                     foreach (var initializer in method.MemberInitializerList)
@@ -235,9 +234,10 @@ namespace CppToCsConverter.Core.Generators
                 }
                 
                 // Use inline implementation from header
-                var convertedBody = ConvertCppToCsBody(method.InlineImplementation);
+                var inlineImplementation = method.InlineImplementation;
+                var convertedBody = ConvertCppToCsBody(inlineImplementation);
                 // For inline implementations, detect indentation from the inline body
-                var originalIndentation = CppToCsConverter.Core.Utils.IndentationManager.DetectOriginalIndentation(method.InlineImplementation);
+                var originalIndentation = CppToCsConverter.Core.Utils.IndentationManager.DetectOriginalIndentation(inlineImplementation);
                 var indentedBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
                     convertedBody, originalIndentation);
                 sb.AppendLine(indentedBody);
@@ -248,7 +248,7 @@ namespace CppToCsConverter.Core.Generators
                 var implMethod = implementationMethods.FirstOrDefault(m => 
                     m.Name == method.Name && m.ClassName == method.ClassName);
                 
-                if (implMethod != null && !string.IsNullOrEmpty(implMethod.ImplementationBody))
+                if (implMethod != null && !implMethod.ImplementationBodyText.IsEmpty)
                 {
                     var convertedBody = ConvertCppToCsBody(implMethod.ImplementationBody);
                     var indentedBody = CppToCsConverter.Core.Utils.IndentationManager.ReindentMethodBody(
@@ -259,7 +259,7 @@ namespace CppToCsConverter.Core.Generators
                 {
                     // Method has resolved implementation but body is empty - don't add TODO
                 }
-                else if (!string.IsNullOrEmpty(method.ImplementationBody))
+                else if (!method.ImplementationBodyText.IsEmpty)
                 {
                     // Use implementation from method itself (e.g., struct constructors)
                     var convertedBody = ConvertCppToCsBody(method.ImplementationBody);
@@ -279,7 +279,7 @@ namespace CppToCsConverter.Core.Generators
 
                         
                         // Generate member initializer assignments
-                        foreach (var initializer in method.MemberInitializerList)
+                        foreach (var initializer in method.MemberInitializerListOrEmpty)
                         {
                             var convertedValue = ConvertCppToCsValue(initializer.InitializationValue);
                             sb.AppendLine($"        {initializer.MemberName} = {convertedValue};");
@@ -287,14 +287,14 @@ namespace CppToCsConverter.Core.Generators
                         }
                         
                         // Add existing inline implementation if available (constructor body)
-                        if (!string.IsNullOrEmpty(method.InlineImplementation))
+                        if (!method.InlineImplementationText.IsEmpty)
                         {
                             var convertedBody = ConvertCppToCsBody(method.InlineImplementation);
                             sb.AppendLine(AddIndentation(convertedBody, "        "));
 
                         }
                         
-                        if (method.MemberInitializerList.Count == 0 && string.IsNullOrEmpty(method.InlineImplementation))
+                        if (method.MemberInitializerListOrEmpty.Count == 0 && method.InlineImplementationText.IsEmpty)
                         {
                             sb.AppendLine("        // TODO: Initialize members");
                         }
@@ -376,8 +376,7 @@ namespace CppToCsConverter.Core.Generators
                     // For parameter comments: use implementation comments since this method has an implementation
                     // (per readme.md: "For methods with implementation we need ignore any comments from the header 
                     // and persist the source (.cpp) method argument list comments")
-                    mergedParam.InlineComments = implParam.InlineComments;
-                    mergedParam.PositionedComments = implParam.PositionedComments;
+                    mergedParam.ShareCommentsOf(implParam);
                     mergedParam.OriginalText = implParam.OriginalText;
                 }
                 else if (headerParam != null)
@@ -400,7 +399,7 @@ namespace CppToCsConverter.Core.Generators
             // If original text contains comments and no positioned comments are available, preserve original formatting
             if (!string.IsNullOrEmpty(param.OriginalText) && 
                 (param.OriginalText.Contains("/*") || param.OriginalText.Contains("//")) &&
-                (param.PositionedComments == null || !param.PositionedComments.Any()))
+                param.PositionedCommentsOrEmpty.Count == 0)
             {
                 return param.OriginalText.Trim();
             }
@@ -442,7 +441,7 @@ namespace CppToCsConverter.Core.Generators
             var baseParam = GenerateParameter(param);
             
             // If no positioned comments, fall back to legacy behavior
-            if (param.PositionedComments == null || !param.PositionedComments.Any())
+            if (param.PositionedCommentsOrEmpty.Count == 0)
             {
                 return baseParam;
             }
@@ -578,42 +577,7 @@ namespace CppToCsConverter.Core.Generators
 
         private string ConvertCppToCsValue(string cppValue)
         {
-            if (string.IsNullOrWhiteSpace(cppValue))
-                return "default";
-
-            // Basic conversions for common initialization values
-            var trimmed = cppValue.Trim();
-            
-            // Handle numeric literals
-            if (int.TryParse(trimmed, out _) || 
-                double.TryParse(trimmed, out _) || 
-                trimmed.Equals("true", StringComparison.OrdinalIgnoreCase) ||
-                trimmed.Equals("false", StringComparison.OrdinalIgnoreCase))
-            {
-                return trimmed;
-            }
-
-            // Handle string literals
-            if (trimmed.StartsWith("\"") && trimmed.EndsWith("\""))
-            {
-                return trimmed;
-            }
-
-            // Handle character literals
-            if (trimmed.StartsWith("'") && trimmed.EndsWith("'"))
-            {
-                return trimmed;
-            }
-
-            // Handle nullptr/NULL
-            if (trimmed.Equals("nullptr", StringComparison.OrdinalIgnoreCase) ||
-                trimmed.Equals("NULL", StringComparison.OrdinalIgnoreCase))
-            {
-                return "null";
-            }
-
-            // For other values, return as-is (might be constants, enums, etc.)
-            return trimmed;
+            return CppToCsConverter.Core.Utils.TypeNormalizer.ConvertCppToCsValue(cppValue);
         }
         
         private void GenerateMethodSignatureWithComments(StringBuilder sb, string accessibility, string staticKeyword, 
@@ -621,8 +585,8 @@ namespace CppToCsConverter.Core.Generators
         {
             // Check if any parameter has comments - if not, use simple single-line format
             bool hasParameterComments = parameters.Any(p => 
-                (p.PositionedComments?.Any() ?? false) || 
-                p.InlineComments.Any() ||
+                p.PositionedCommentsOrEmpty.Count > 0 || 
+                p.InlineCommentsOrEmpty.Count > 0 ||
                 (!string.IsNullOrEmpty(p.OriginalText) && (p.OriginalText.Contains("/*") || p.OriginalText.Contains("//"))));
             
             // Generate method signature with optional parameter comments
@@ -1,6 +1,7 @@
 using System;
 using System.Linq;
 using System.Text;
+using CppToCsConverter.Core.Core;
 using CppToCsConverter.Core.Models;
 
 namespace CppToCsConverter.Core.Generators
@@ -30,7 +31,7 @@ namespace CppToCsConverter.Core.Generators
             var accessibility = cppInterface.IsPublicExport ? "public" : "internal";
             if (cppInterface.IsPublicExport && sourceImplementations != null)
             {
-                var implementingClass = ResolveImplementingClassFromFactory(cppInterface, sourceImplementations);
+                var implementingClass = SymbolIndex.ResolveFactoryCreatedClass(cppInterface, sourceImplementations.Where(impl => impl.ClassName == cppInterface.Name));
                 if (!string.IsNullOrEmpty(implementingClass))
                 {
                     sb.AppendLine($"[Create(typeof({implementingClass}))]");
@@ -58,48 +59,6 @@ namespace CppToCsConverter.Core.Generators
             return sb.ToString();
         }
 
-        private string? ResolveImplementingClassFromFactory(CppClass cppInterface, List<CppMethod> sourceImplementations)
-        {
-            // Look for static factory method (e.g., GetInstance, CreateInstance, etc.)
-            var staticFactoryMethod = cppInterface.Methods
-                .FirstOrDefault(m => m.IsStatic && m.AccessSpecifier == AccessSpecifier.Public);
-
-            if (staticFactoryMethod == null)
-                return null;
-
-            // Find implementation in source files
-            var implementation = sourceImplementations.FirstOrDefault(impl =>
-                impl.ClassName == cppInterface.Name &&
-                impl.Name == staticFactoryMethod.Name &&
-                !string.IsNullOrEmpty(impl.ImplementationBody));
-
-            if (implementation == null || string.IsNullOrEmpty(implementation.ImplementationBody))
-                return null;
-
-            // Parse the implementation body to find the implementing class
-            // Look for patterns like: CSample* pSample = new CSample();
-            // or: return new CSample();
-            var body = implementation.ImplementationBody;
-            
-            // Pattern 1: new ClassName()
-            var newPattern = new System.Text.RegularExpressions.Regex(@"new\s+([A-Z][A-Za-z0-9_]*)\s*\(");
-            var match = newPattern.Match(body);
-            if (match.Success)
-            {
-                return match.Groups[1].Value;
-            }
-
-            // Pattern 2: ClassName* variable = new ClassName()
-            var declarationPattern = new System.Text.RegularExpressions.Regex(@"([A-Z][A-Za-z0-9_]*)\s*\*\s*\w+\s*=\s*new\s+([A-Z][A-Za-z0-9_]*)\s*\(");
-            match = declarationPattern.Match(body);
-            if (match.Success)
-            {
-                return match.Groups[2].Value;
-            }
-
-            return null;
-        }
-
         private string GenerateMethodSignature(CppMethod method)
         {
             var returnType = method.ReturnType; // Preserve original C++ return type
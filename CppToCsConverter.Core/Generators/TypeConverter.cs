@@ -1,15 +1,13 @@
 using System;
+using System.Collections.Frozen;
 using System.Collections.Generic;
+using CppToCsConverter.Core.Utils;
 
 namespace CppToCsConverter.Core.Generators
 {
     public class TypeConverter
     {
-        private readonly Dictionary<string, string> _typeMap;
-
-        public TypeConverter()
-        {
-            _typeMap = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase)
+        private static readonly FrozenDictionary<string, string> BuiltInTypeMap = new Dictionary<string, string>
             {
                 // All C++ types preserved for downstream processing
                 // Only keeping identity mappings for modifier cleanup purposes
@@ -32,7 +30,16 @@ namespace CppToCsConverter.Core.Generators
                 // Custom types (these might need to be preserved or mapped)
                 { "TDimValue", "TDimValue" }, // Assuming this struct exists in C#
                 { "TAttId", "TAttId" }, // Assuming this struct exists in C#
-            };
+            }.ToFrozenDictionary(StringComparer.OrdinalIgnoreCase);
+
+        // Mappings added to this instance, and the memo of its conversions; without any, conversions are memoized process wide
+        private Dictionary<string, string>? _customTypeMap;
+        private TypeNormalizer.MemoCache? _customConvertedTypes;
+        private readonly Func<string, string> _computeType;
+
+        public TypeConverter()
+        {
+            _computeType = ComputeType;
         }
 
         public string ConvertType(string cppType)
@@ -40,6 +47,11 @@ namespace CppToCsConverter.Core.Generators
             if (string.IsNullOrWhiteSpace(cppType))
                 return "void";
 
+            return (_customConvertedTypes ?? TypeNormalizer.Types).Get(cppType, _computeType);
+        }
+
+        private string ComputeType(string cppType)
+        {
             // Remove whitespace and normalize
             var normalizedType = cppType.Trim();
             
@@ -54,7 +66,7 @@ namespace CppToCsConverter.Core.Generators
             normalizedType = normalizedType.TrimEnd('*', '&').Trim();
 
             // Check direct mapping
-            if (_typeMap.TryGetValue(normalizedType, out var csType))
+            if ((_customTypeMap != null && _customTypeMap.TryGetValue(normalizedType, out var csType)) || BuiltInTypeMap.TryGetValue(normalizedType, out csType))
             {
                 return csType;
             }
@@ -106,7 +118,9 @@ namespace CppToCsConverter.Core.Generators
 
         public void AddCustomTypeMapping(string cppType, string csType)
         {
-            _typeMap[cppType] = csType;
+            _customTypeMap ??= new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase);
+            _customTypeMap[cppType] = csType;
+            _customConvertedTypes = new TypeNormalizer.MemoCache("Types", null);
         }
     }
 }
\ No newline at end of file
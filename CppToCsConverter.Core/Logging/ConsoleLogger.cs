@@ -4,25 +4,57 @@ namespace CppToCsConverter.Core.Logging
 {
     public class ConsoleLogger : ILogger
     {
+        // Files are parsed and generated in parallel; the lock keeps a message and its color together
+        private static readonly object ConsoleLock = new object();
+
+        public ConsoleLogger(LogVerbosity verbosity = LogVerbosity.Normal)
+        {
+            Verbosity = verbosity;
+        }
+
+        public LogVerbosity Verbosity { get; set; }
+
         public void LogError(string message)
         {
-            var originalColor = Console.ForegroundColor;
-            Console.ForegroundColor = ConsoleColor.Red;
-            Console.WriteLine(message);
-            Console.ForegroundColor = originalColor;
+            WriteLine(message, ConsoleColor.Red);
         }
 
         public void LogWarning(string message)
         {
-            var originalColor = Console.ForegroundColor;
-            Console.ForegroundColor = ConsoleColor.Yellow;
-            Console.WriteLine(message);
-            Console.ForegroundColor = originalColor;
+            WriteLine(message, ConsoleColor.Yellow);
         }
 
         public void LogInfo(string message)
         {
-            Console.WriteLine(message);
+            if (Verbosity >= LogVerbosity.Normal)
+            {
+                WriteLine(message, null);
+            }
+        }
+
+        public void LogDebug(string message)
+        {
+            if (Verbosity >= LogVerbosity.Detailed)
+            {
+                WriteLine(message, null);
+            }
+        }
+
+        private static void WriteLine(string message, ConsoleColor? color)
+        {
+            lock (ConsoleLock)
+            {
+                if (color == null)
+                {
+                    Console.WriteLine(message);
+                    return;
+                }
+
+                var originalColor = Console.ForegroundColor;
+                Console.ForegroundColor = color.Value;
+                Console.WriteLine(message);
+                Console.ForegroundColor = originalColor;
+            }
         }
     }
 }
\ No newline at end of file
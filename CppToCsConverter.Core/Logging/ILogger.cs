@@ -5,5 +5,6 @@ namespace CppToCsConverter.Core.Logging
         void LogError(string message);
         void LogWarning(string message);
         void LogInfo(string message);
+        void LogDebug(string message) { } // Per-file and per-element detail, only shown at detailed verbosity; ignored unless implemented
     }
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+namespace CppToCsConverter.Core.Logging
+{
+    /// <summary>
+    /// Which messages a logger writes; each level includes the ones before it
+    /// </summary>
+    public enum LogVerbosity
+    {
+        Quiet,    // Errors and warnings
+        Normal,   // Plus progress and summary messages
+        Detailed  // Plus a message per parsed file, found type and written file
+    }
+}
@@ -0,0 +1,37 @@
+namespace CppToCsConverter.Core.Logging
+{
+    /// <summary>
+    /// Prefixes every message, so that the interleaved output of concurrent conversions can be told apart
+    /// </summary>
+    public class PrefixedLogger : ILogger
+    {
+        private readonly ILogger _inner;
+        private readonly string _prefix;
+
+        public PrefixedLogger(ILogger inner, string prefix)
+        {
+            _inner = inner;
+            _prefix = prefix;
+        }
+
+        public void LogError(string message)
+        {
+            _inner.LogError(_prefix + message);
+        }
+
+        public void LogWarning(string message)
+        {
+            _inner.LogWarning(_prefix + message);
+        }
+
+        public void LogInfo(string message)
+        {
+            _inner.LogInfo(_prefix + message);
+        }
+
+        public void LogDebug(string message)
+        {
+            _inner.LogDebug(_prefix + message);
+        }
+    }
+}
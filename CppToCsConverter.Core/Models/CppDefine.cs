@@ -1,9 +1,10 @@
 using System.Collections.Generic;
 using System.Text.RegularExpressions;
+using CppToCsConverter.Core.Parsers;
 
 namespace CppToCsConverter.Core.Models
 {
-    public class CppDefine
+    public partial class CppDefine
     {
         public string Name { get; set; } = string.Empty;
         public string Value { get; set; } = string.Empty;
@@ -26,16 +27,16 @@ namespace CppToCsConverter.Core.Models
             var trimmedValue = Value.Trim();
             
             // Check for character literals: _T('x'), 'x', _T('\t')
-            if (Regex.IsMatch(trimmedValue, @"^_T\s*\(\s*'.*?'\s*\)$") || 
-                Regex.IsMatch(trimmedValue, @"^'.*?'$"))
+            if (CharLiteralRegex().IsMatch(trimmedValue) || 
+                QuotedCharRegex().IsMatch(trimmedValue))
             {
                 return "char";
             }
             
             // Check for string literals: _T("..."), "...", _("")
-            if (Regex.IsMatch(trimmedValue, @"^_T\s*\(\s*"".*?""\s*\)$") || 
-                Regex.IsMatch(trimmedValue, @"^_\s*\(\s*"".*?""\s*\)$") ||
-                Regex.IsMatch(trimmedValue, @"^"".*?""$"))
+            if (StringLiteralRegex().IsMatch(trimmedValue) || 
+                LocalizedStringLiteralRegex().IsMatch(trimmedValue) ||
+                QuotedStringRegex().IsMatch(trimmedValue))
             {
                 return "string";
             }
@@ -50,20 +51,20 @@ namespace CppToCsConverter.Core.Models
             }
             
             // Check for long: ends with 'L' or 'l'
-            if (Regex.IsMatch(trimmedValue, @"^-?\d+[Ll]$"))
+            if (LongLiteralRegex().IsMatch(trimmedValue))
             {
                 return "long";
             }
             
             // Check for double: contains decimal point or ends with 'D'/'d'
-            if (Regex.IsMatch(trimmedValue, @"^-?\d+\.\d+$") || 
-                Regex.IsMatch(trimmedValue, @"^-?\d+[Dd]$"))
+            if (DecimalLiteralRegex().IsMatch(trimmedValue) || 
+                DoubleSuffixLiteralRegex().IsMatch(trimmedValue))
             {
                 return "double";
             }
             
             // Check for integer: plain numeric value
-            if (Regex.IsMatch(trimmedValue, @"^-?\d+$"))
+            if (IntegerLiteralRegex().IsMatch(trimmedValue))
             {
                 return "int";
             }
@@ -84,14 +85,14 @@ namespace CppToCsConverter.Core.Models
             var trimmedValue = Value.Trim();
             
             // Handle character literals: _T('x') -> 'x'
-            var charMatch = Regex.Match(trimmedValue, @"^_T\s*\(\s*('.*?')\s*\)$");
+            var charMatch = WrappedCharLiteralRegex().Match(trimmedValue);
             if (charMatch.Success)
             {
                 return charMatch.Groups[1].Value;
             }
             
             // Handle string literals: _T("...") -> "...", _("...") -> "..."
-            var stringMatch = Regex.Match(trimmedValue, @"^_T?\s*\(\s*("".*?"")\s*\)$");
+            var stringMatch = WrappedStringLiteralRegex().Match(trimmedValue);
             if (stringMatch.Success)
             {
                 return stringMatch.Groups[1].Value;
@@ -130,5 +131,40 @@ namespace CppToCsConverter.Core.Models
             
             return $"{accessModifier} const {type} {Name} = {normalizedValue};";
         }
+
+        // Value literals: _T('x'), 'x', _T("..."), _("..."), "...", 10L, 1.5, 10D, 10
+
+        [GeneratedRegex(@"^_T\s*\(\s*'.*?'\s*\)$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex CharLiteralRegex();
+
+        [GeneratedRegex(@"^'.*?'$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex QuotedCharRegex();
+
+        [GeneratedRegex(@"^_T\s*\(\s*"".*?""\s*\)$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex StringLiteralRegex();
+
+        [GeneratedRegex(@"^_\s*\(\s*"".*?""\s*\)$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex LocalizedStringLiteralRegex();
+
+        [GeneratedRegex(@"^"".*?""$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex QuotedStringRegex();
+
+        [GeneratedRegex(@"^-?\d+[Ll]$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex LongLiteralRegex();
+
+        [GeneratedRegex(@"^-?\d+\.\d+$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex DecimalLiteralRegex();
+
+        [GeneratedRegex(@"^-?\d+[Dd]$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex DoubleSuffixLiteralRegex();
+
+        [GeneratedRegex(@"^-?\d+$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex IntegerLiteralRegex();
+
+        [GeneratedRegex(@"^_T\s*\(\s*('.*?')\s*\)$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex WrappedCharLiteralRegex();
+
+        [GeneratedRegex(@"^_T?\s*\(\s*("".*?"")\s*\)$", RegexOptions.None, CppPatterns.MatchTimeoutMilliseconds)]
+        private static partial Regex WrappedStringLiteralRegex();
     }
 }
\ No newline at end of file
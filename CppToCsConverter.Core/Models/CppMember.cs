@@ -1,9 +1,16 @@
+using System;
 using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
 
 namespace CppToCsConverter.Core.Models
 {
+    /// <summary>
+    /// A data member of a class. Its comment list is allocated on first use, since most members have none.
+    /// </summary>
     public class CppMember
     {
+        private List<string>? _precedingComments;
+
         public string Type { get; set; } = string.Empty;
         public string Name { get; set; } = string.Empty;
         public AccessSpecifier AccessSpecifier { get; set; }
@@ -12,10 +19,16 @@ namespace CppToCsConverter.Core.Models
         public string InitializationValue { get; set; } = string.Empty; // For const members with initialization (e.g., const int x = 5)
         public bool IsArray { get; set; }
         public string ArraySize { get; set; } = string.Empty;
-        public List<string> PrecedingComments { get; set; } = new List<string>(); // Comments before member declaration
+        [AllowNull]
+        public List<string> PrecedingComments { get => _precedingComments ??= new List<string>(); set => _precedingComments = value; } // Comments before member declaration
         public string PostfixComment { get; set; } = string.Empty; // Comment on the same line as member declaration (after the semicolon)
         public string RegionStart { get; set; } = string.Empty; // Region start marker (from .h file - converted to comment)
         public string RegionEnd { get; set; } = string.Empty; // Region end marker (from .h file - converted to comment)
         public int OrderIndex { get; set; } // Position in file relative to other elements
+
+        /// <summary>
+        /// The preceding comments without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<string> PrecedingCommentsOrEmpty => _precedingComments ?? (IReadOnlyList<string>)Array.Empty<string>();
     }
 }
\ No newline at end of file
@@ -1,9 +1,23 @@
+using System;
 using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
 
 namespace CppToCsConverter.Core.Models
 {
+    /// <summary>
+    /// A method declared in a header or implemented in a source file. Comment and initializer lists are
+    /// allocated on first use, since most methods have none; read them through the OrEmpty views to keep it that way.
+    /// Parsed bodies are kept as <see cref="MethodBodyText"/> and only become strings when read, so test and copy
+    /// them through the Text properties.
+    /// </summary>
     public class CppMethod
     {
+        private List<CppMemberInitializer>? _memberInitializerList;
+        private List<string>? _headerComments;
+        private List<string>? _sourceComments;
+        private MethodBodyText _inlineImplementation = MethodBodyText.FromText(string.Empty);
+        private MethodBodyText _implementationBody = MethodBodyText.FromText(string.Empty);
+
         public string Name { get; set; } = string.Empty;
         public string ReturnType { get; set; } = string.Empty;
         public List<CppParameter> Parameters { get; set; } = new List<CppParameter>();
@@ -16,15 +30,18 @@ namespace CppToCsConverter.Core.Models
         public bool IsConst { get; set; }
         public bool IsLocalMethod { get; set; } = false; // Local method without class scope regulator (::)
         public bool HasInlineImplementation { get; set; }
-        public string InlineImplementation { get; set; } = string.Empty;
-        public string ImplementationBody { get; set; } = string.Empty;
+        public string InlineImplementation { get => _inlineImplementation.ToString(); set => _inlineImplementation = MethodBodyText.FromText(value); }
+        public string ImplementationBody { get => _implementationBody.ToString(); set => _implementationBody = MethodBodyText.FromText(value); }
         public bool HasResolvedImplementation { get; set; } = false; // True if implementation was found in source file (even if body is empty)
         public string ClassName { get; set; } = string.Empty; // For source file parsing
         public int OrderIndex { get; set; } // For maintaining order from .cpp files
         public string TargetFileName { get; set; } = string.Empty; // Target .cs file name (without extension) - .cpp file name for implementations, .h file name for inline methods
-        public List<CppMemberInitializer> MemberInitializerList { get; set; } = new List<CppMemberInitializer>();
-        public List<string> HeaderComments { get; set; } = new List<string>(); // Comments from .h file
-        public List<string> SourceComments { get; set; } = new List<string>(); // Comments from .cpp file
+        [AllowNull]
+        public List<CppMemberInitializer> MemberInitializerList { get => _memberInitializerList ??= new List<CppMemberInitializer>(); set => _memberInitializerList = value; }
+        [AllowNull]
+        public List<string> HeaderComments { get => _headerComments ??= new List<string>(); set => _headerComments = value; } // Comments from .h file
+        [AllowNull]
+        public List<string> SourceComments { get => _sourceComments ??= new List<string>(); set => _sourceComments = value; } // Comments from .cpp file
         public string HeaderRegionStart { get; set; } = string.Empty; // Region start from .h file (converted to comment)
         public string HeaderRegionEnd { get; set; } = string.Empty; // Region end from .h file (converted to comment)  
         public string SourceRegionStart { get; set; } = string.Empty; // Region start from .cpp file (preserved as region)
@@ -34,5 +51,30 @@ namespace CppToCsConverter.Core.Models
         public int HeaderCommentIndentation { get; set; } = 0; // Original indentation level of header comments
         public int SourceCommentIndentation { get; set; } = 0; // Original indentation level of source comments  
         public int ImplementationIndentation { get; set; } = 0; // Original indentation level of method body
+
+        /// <summary>
+        /// The inline body from the header, materialized by <see cref="InlineImplementation"/>
+        /// </summary>
+        internal MethodBodyText InlineImplementationText { get => _inlineImplementation; set => _inlineImplementation = value; }
+
+        /// <summary>
+        /// The body from the source file, materialized by <see cref="ImplementationBody"/>
+        /// </summary>
+        internal MethodBodyText ImplementationBodyText { get => _implementationBody; set => _implementationBody = value; }
+
+        /// <summary>
+        /// The member initializers without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<CppMemberInitializer> MemberInitializerListOrEmpty => _memberInitializerList ?? (IReadOnlyList<CppMemberInitializer>)Array.Empty<CppMemberInitializer>();
+
+        /// <summary>
+        /// The header comments without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<string> HeaderCommentsOrEmpty => _headerComments ?? (IReadOnlyList<string>)Array.Empty<string>();
+
+        /// <summary>
+        /// The source comments without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<string> SourceCommentsOrEmpty => _sourceComments ?? (IReadOnlyList<string>)Array.Empty<string>();
     }
 }
\ No newline at end of file
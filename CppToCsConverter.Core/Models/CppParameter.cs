@@ -1,4 +1,6 @@
+using System;
 using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
 
 namespace CppToCsConverter.Core.Models
 {
@@ -14,21 +16,48 @@ namespace CppToCsConverter.Core.Models
         public CommentPosition Position { get; set; }
     }
 
+    /// <summary>
+    /// A parameter of a method. Its comment lists are allocated on first use, since most parameters have none.
+    /// </summary>
     public class CppParameter
     {
+        private List<string>? _inlineComments;
+        private List<ParameterComment>? _positionedComments;
+
         public string Type { get; set; } = string.Empty;
         public string Name { get; set; } = string.Empty;
         public string DefaultValue { get; set; } = string.Empty;
         public bool IsReference { get; set; }
         public bool IsPointer { get; set; }
         public bool IsConst { get; set; }
-        public List<string> InlineComments { get; set; } = new List<string>(); // Comments within the parameter list (legacy)
-        public List<ParameterComment> PositionedComments { get; set; } = new List<ParameterComment>(); // Comments with position information
+        [AllowNull]
+        public List<string> InlineComments { get => _inlineComments ??= new List<string>(); set => _inlineComments = value; } // Comments within the parameter list (legacy)
+        [AllowNull]
+        public List<ParameterComment> PositionedComments { get => _positionedComments ??= new List<ParameterComment>(); set => _positionedComments = value; } // Comments with position information
         public string OriginalText { get; set; } = string.Empty; // Original parameter text with comments for reconstruction
         
         // Formatting metadata for preserving original style
         public bool HasLineBreak { get; set; } // Whether this parameter started on a new line
         public int OriginalIndent { get; set; } // Number of spaces/tabs of indentation
         public string CanonicalSignature { get; set; } = string.Empty; // Normalized signature for whitespace-insensitive matching
+
+        /// <summary>
+        /// The inline comments without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<string> InlineCommentsOrEmpty => _inlineComments ?? (IReadOnlyList<string>)Array.Empty<string>();
+
+        /// <summary>
+        /// The positioned comments without allocating a list for an empty one
+        /// </summary>
+        internal IReadOnlyList<ParameterComment> PositionedCommentsOrEmpty => _positionedComments ?? (IReadOnlyList<ParameterComment>)Array.Empty<ParameterComment>();
+
+        /// <summary>
+        /// Makes this parameter use the comment lists of <paramref name="other"/>, without allocating them if it has none
+        /// </summary>
+        internal void ShareCommentsOf(CppParameter other)
+        {
+            _inlineComments = other._inlineComments;
+            _positionedComments = other._positionedComments;
+        }
     }
 }
\ No newline at end of file
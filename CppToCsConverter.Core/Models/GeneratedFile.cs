@@ -0,0 +1,13 @@
+namespace CppToCsConverter.Core.Models
+{
+    /// <summary>
+    /// Represents a generated C# file that has been rendered but not yet written to disk,
+    /// or a file returned by an in-memory conversion
+    /// </summary>
+    public class GeneratedFile
+    {
+        public string FilePath { get; set; } = string.Empty; // Full output path of the .cs file; just the file name for in-memory conversions
+        public string FileName { get; set; } = string.Empty; // Type/file name without extension, used for logging
+        public string Content { get; set; } = string.Empty; // Generated C# source text
+    }
+}
@@ -0,0 +1,67 @@
+using System;
+using System.Runtime.InteropServices;
+using CppToCsConverter.Core.Utils;
+
+namespace CppToCsConverter.Core.Models
+{
+    /// <summary>
+    /// A method body as the model holds it: either the body text, or the raw text between the method's braces in the
+    /// parsed file, which is only normalized by <see cref="IndentationManager.NormalizeMethodBody"/> when the body is read.
+    /// Parsers store the raw text, so a body costs no allocation until generation emits it; the raw text keeps the file
+    /// content alive instead, unless the converter normalizes the bodies of a file that is mostly other code
+    /// (see CppSourceParser.CompactMethodBodies). The normalized text is not kept, so reading a raw body twice
+    /// normalizes it twice.
+    /// </summary>
+    internal readonly struct MethodBodyText
+    {
+        private readonly ReadOnlyMemory<char> _text;
+        private readonly bool _isRaw;
+
+        private MethodBodyText(ReadOnlyMemory<char> text, bool isRaw)
+        {
+            _text = text;
+            _isRaw = isRaw;
+        }
+
+        /// <summary>
+        /// A body given by the text between the braces in the source, without normalizing it
+        /// </summary>
+        public static MethodBodyText FromRaw(ReadOnlyMemory<char> rawBody) => new MethodBodyText(rawBody, isRaw: true);
+
+        /// <summary>
+        /// A body given by its final text
+        /// </summary>
+        public static MethodBodyText FromText(string? body) => new MethodBodyText(body.AsMemory(), isRaw: false);
+
+        /// <summary>
+        /// True if reading the body gives an empty string; does not normalize it
+        /// </summary>
+        public bool IsEmpty => _isRaw ? _text.Span.IsWhiteSpace() : _text.IsEmpty;
+
+        /// <summary>
+        /// Length of the raw text, or 0 if the body is given by its text
+        /// </summary>
+        public int RawLength => _isRaw ? _text.Length : 0;
+
+        /// <summary>
+        /// Length of the whole text a raw body is part of, or 0 if the body is given by its text
+        /// </summary>
+        public int SourceTextLength => _isRaw && MemoryMarshal.TryGetString(_text, out var text, out _, out _) ? text.Length : 0;
+
+        /// <summary>
+        /// The body given by its text, normalizing it now if it is raw, so that it no longer refers to the source text
+        /// </summary>
+        public MethodBodyText Normalize() => _isRaw ? FromText(ToString()) : this;
+
+        /// <summary>
+        /// The body text, normalized now if it is raw
+        /// </summary>
+        public override string ToString()
+        {
+            if (_isRaw)
+                return IndentationManager.NormalizeMethodBody(_text.Span);
+
+            return MemoryMarshal.TryGetString(_text, out var text, out _, out _) ? text : string.Empty;
+        }
+    }
+}
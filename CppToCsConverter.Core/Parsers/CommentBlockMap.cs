@@ -0,0 +1,145 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// How a parser collects the comment block preceding a declaration
+    /// </summary>
+    internal enum CommentBlockStyle
+    {
+        /// <summary>
+        /// Header rules: a line ending with "*/" after code stops the block, a blank line is only kept
+        /// when a pure comment line precedes it, and the common indentation is removed from the block
+        /// </summary>
+        Header,
+
+        /// <summary>
+        /// Source rules: any line ending with "*/" belongs to the block and lines are kept as written
+        /// </summary>
+        Source
+    }
+
+    /// <summary>
+    /// Preceding comment blocks for every line of one file, built in a single forward pass.
+    /// Gives the same blocks as scanning backwards from each declaration, without rescanning
+    /// the lines above it for every declaration.
+    /// </summary>
+    internal class CommentBlockMap
+    {
+        private readonly string[] _lines;
+        private readonly CommentBlockStyle _style;
+
+        // Last non-blank line before each line, or -1
+        private readonly int[] _lastNonBlankBefore;
+
+        // First line of the comment block ending at each line, when the backward scan reaches the line
+        // outside (_blockStart) or inside (_multiLineBlockStart) a multi-line comment. Equal to the
+        // line index + 1 when the line does not belong to the block.
+        private readonly int[] _blockStart;
+        private readonly int[] _multiLineBlockStart;
+
+        public CommentBlockMap(string[] lines, CommentBlockStyle style)
+        {
+            _lines = lines;
+            _style = style;
+            _lastNonBlankBefore = new int[lines.Length];
+            _blockStart = new int[lines.Length];
+            _multiLineBlockStart = new int[lines.Length];
+
+            int lastNonBlank = -1;
+            for (int i = 0; i < lines.Length; i++)
+            {
+                _lastNonBlankBefore[i] = lastNonBlank;
+
+                var line = lines[i].Trim();
+                int previousStart = i > 0 ? _blockStart[i - 1] : 0;
+                int previousMultiLineStart = i > 0 ? _multiLineBlockStart[i - 1] : 0;
+
+                if (line.StartsWith("//"))
+                {
+                    _blockStart[i] = previousStart;
+                    _multiLineBlockStart[i] = previousMultiLineStart;
+                }
+                else if (line.EndsWith("*/"))
+                {
+                    // A line that ends a comment continues the block inside the comment until it is opened
+                    int start = !IsCommentEndLine(line) ? i + 1 : line.StartsWith("/*") ? previousStart : previousMultiLineStart;
+                    _blockStart[i] = start;
+                    _multiLineBlockStart[i] = start;
+                }
+                else
+                {
+                    _multiLineBlockStart[i] = line.StartsWith("/*") ? previousStart : previousMultiLineStart;
+
+                    // A blank line between comment blocks belongs to the block if a comment precedes it
+                    bool continuesBlock = line.Length == 0 && lastNonBlank >= 0 && IsCommentBeforeBlankLine(lines[lastNonBlank].Trim());
+                    _blockStart[i] = continuesBlock ? previousStart : i + 1;
+                }
+
+                if (line.Length > 0)
+                {
+                    lastNonBlank = i;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns the comment block before a line, skipping blank lines directly above it,
+        /// and the indentation of its first line
+        /// </summary>
+        public (List<string> comments, int indentation) GetPrecedingComments(int lineIndex)
+        {
+            var comments = new List<string>();
+            int end = lineIndex > 0 ? (lineIndex < _lines.Length ? _lastNonBlankBefore[lineIndex] : LastNonBlankAtOrBefore(_lines.Length - 1)) : -1;
+            if (end < 0 || _blockStart[end] > end)
+                return (comments, 0);
+
+            int start = _blockStart[end];
+            var firstComment = _lines[start];
+            int originalIndentation = firstComment.Length - firstComment.TrimStart().Length;
+
+            if (_style == CommentBlockStyle.Source)
+            {
+                comments.AddRange(_lines.Skip(start).Take(end - start + 1));
+                return (comments, originalIndentation);
+            }
+
+            // Remove minimum indentation while preserving relative indentation
+            var block = new ArraySegment<string>(_lines, start, end - start + 1);
+            int minIndent = block
+                .Where(l => !string.IsNullOrWhiteSpace(l))
+                .Min(l => l.Length - l.TrimStart().Length);
+
+            comments.AddRange(block.Select(l =>
+                string.IsNullOrWhiteSpace(l) ? "" : (l.Length >= minIndent ? l.Substring(minIndent) : l)));
+            return (comments, originalIndentation);
+        }
+
+        private int LastNonBlankAtOrBefore(int lineIndex)
+        {
+            return string.IsNullOrWhiteSpace(_lines[lineIndex]) ? _lastNonBlankBefore[lineIndex] : lineIndex;
+        }
+
+        private bool IsCommentEndLine(string trimmedLine)
+        {
+            if (_style == CommentBlockStyle.Source)
+                return true;
+
+            // Pure comment line or multi-line comment continuation; code with a postfix comment is not
+            return trimmedLine.StartsWith("/*") || trimmedLine.StartsWith("*") || !trimmedLine.Contains("/*");
+        }
+
+        private bool IsCommentBeforeBlankLine(string trimmedLine)
+        {
+            if (_style == CommentBlockStyle.Source)
+                return trimmedLine.StartsWith("//") || trimmedLine.EndsWith("*/");
+
+            // Only a pure comment, not a member with a postfix comment
+            return trimmedLine.StartsWith("//") ||
+                   (trimmedLine.StartsWith("/*") && trimmedLine.EndsWith("*/")) ||
+                   (trimmedLine.StartsWith("*") && trimmedLine.EndsWith("*/"));
+        }
+    }
+}
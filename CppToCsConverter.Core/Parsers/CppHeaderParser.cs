@@ -2,11 +2,14 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Runtime.CompilerServices;
 using System.Text;
 using System.Text.RegularExpressions;
 using CppToCsConverter.Core.Models;
 using CppToCsConverter.Core.Logging;
 using CppToCsConverter.Core.Parsers.ParameterParsing;
+using CppToCsConverter.Core.Parsers.Lexing;
+using CppToCsConverter.Core.Utils;
 
 namespace CppToCsConverter.Core.Parsers
 {
@@ -14,38 +17,34 @@ namespace CppToCsConverter.Core.Parsers
     {
         private readonly ILogger _logger;
         private readonly CppParameterParser _parameterParser;
-        private readonly Regex _classRegex = new Regex(@"(?:class|struct)\s+(?:__declspec\s*\([^)]+\)\s+)?(\w+)(?:\s*:\s*(?:public|private|protected)\s+(\w+))?", RegexOptions.Compiled);
-        private readonly Regex _methodRegex = new Regex(@"(?:(virtual)\s+)?(?:(static)\s+)?(?:((?:const\s+)?\w+(?:::\w+)?[\*&]*)\s+)?([~]?\w+)\s*\(.*?\)(?:\s*(const))?(?:\s*:\s*([^{]*))?(?:\s*=\s*0)?(?:\s*\{.*?\})?", RegexOptions.Compiled | RegexOptions.Singleline);
-        private readonly Regex _memberRegex = new Regex(@"^\s*(?:(static)\s+)?(?:(const)\s+)?(\w+(?:\s*\*|\s*&)?)\s+(\w+)(?:\s*\[\s*([^]]*)\s*\])?(?:\s*=\s*([^;]+))?;\s*(.*)$", RegexOptions.Compiled);
-        private readonly Regex _accessSpecifierRegex = new Regex(@"^(private|protected|public)\s*:\s*(.*)$", RegexOptions.Compiled);
-        private readonly Regex _pragmaRegionRegex = new Regex(@"^\s*#pragma\s+(region|endregion)(?:\s+(.*))?$", RegexOptions.Compiled);
-        private readonly Regex _defineRegex = new Regex(@"^\s*#define\s+(\w+)(?:\s+(.*))?$", RegexOptions.Compiled);
-        
-        // Regex for typedef struct name extraction (e.g., "} MyStruct;")
-        private readonly Regex _typedefNameRegex = new Regex(@"^\s*}\s*(\w+)\s*;\s*$", RegexOptions.Compiled);
-        
-        // Deprecated struct-specific regex patterns (kept for backward compatibility with ParseStructsFromHeaderFile)
-        private readonly Regex _simpleStructRegex = new Regex(@"^\s*struct\s+(\w+)", RegexOptions.Compiled);
-        private readonly Regex _typedefStructRegex = new Regex(@"^\s*typedef\s+struct\s*$", RegexOptions.Compiled);
-        private readonly Regex _typedefStructTagRegex = new Regex(@"^\s*typedef\s+struct\s+(\w+)\s*$", RegexOptions.Compiled);
+        private readonly ConditionalWeakTable<string[], CommentBlockMap> _commentBlockMaps = new ConditionalWeakTable<string[], CommentBlockMap>();
 
         public CppHeaderParser(ILogger? logger = null)
         {
             _logger = logger ?? new ConsoleLogger();
-            _parameterParser = new CppParameterParser(
-                new ParameterBlockSplitter(),
-                new ParameterComponentExtractor()
-            );
+            _parameterParser = new CppParameterParser();
         }
 
+        /// <summary>
+        /// Parameter list parser with its cache of parsed parameter lists, shared with source parsers using this parser
+        /// </summary>
+        internal CppParameterParser ParameterParser => _parameterParser;
+
         public List<CppClass> ParseHeaderFile(string filePath)
+        {
+            return ParseHeaderFile(filePath, null);
+        }
+
+        /// <summary>
+        /// Parses a header file, taking its content from the store when one is given
+        /// </summary>
+        internal List<CppClass> ParseHeaderFile(string filePath, FileContentStore? contents)
         {
             try
             {
-                var content = File.ReadAllText(filePath);
-                var lines = content.Split(new[] { '\r', '\n' }, StringSplitOptions.RemoveEmptyEntries);
+                var file = contents?.Take(filePath) ?? SourceFileContent.Read(filePath);
                 
-                return ParseAllClassesFromLines(lines, Path.GetFileNameWithoutExtension(filePath));
+                return ParseAllClassesFromLines(file.NonEmptyLines, Path.GetFileNameWithoutExtension(filePath));
             }
             catch (Exception ex)
             {
@@ -134,7 +133,7 @@ namespace CppToCsConverter.Core.Parsers
                 var line = lines[i].Trim();
                 
                 // Check if this is a define statement
-                var defineMatch = _defineRegex.Match(line);
+                var defineMatch = CppPatterns.Define().Match(line);
                 if (defineMatch.Success)
                 {
                     // Only collect defines that have a value (ignore defines with no value like #define ARCHIVER_H_)
@@ -214,7 +213,7 @@ namespace CppToCsConverter.Core.Parsers
                     continue;
 
                 // Check for class/struct declaration
-                var classMatch = _classRegex.Match(line);
+                var classMatch = CppPatterns.ClassDeclaration().Match(line);
                 bool isTypedefStruct = line.TrimStart().StartsWith("typedef struct");
                 
                 // Exclude lines ending with semicolon that are variable declarations (e.g., "struct tm time;")
@@ -259,7 +258,7 @@ namespace CppToCsConverter.Core.Parsers
                     // For typedef struct, extract the name from the closing line (e.g., "} MyStruct;")
                     if (currentClass.IsStruct && line.Contains("}"))
                     {
-                        var typedefNameMatch = _typedefNameRegex.Match(line);
+                        var typedefNameMatch = CppPatterns.TypedefName().Match(line);
                         if (typedefNameMatch.Success)
                         {
                             currentClass.Name = typedefNameMatch.Groups[1].Value;
@@ -273,7 +272,7 @@ namespace CppToCsConverter.Core.Parsers
                 }
 
                 // Check for access specifiers (both standalone and inline with declarations)
-                var accessMatch = _accessSpecifierRegex.Match(line);
+                var accessMatch = CppPatterns.AccessSpecifier().Match(line);
                 if (accessMatch.Success)
                 {
                     Enum.TryParse<AccessSpecifier>(accessMatch.Groups[1].Value, true, out currentAccess);
@@ -328,7 +327,16 @@ namespace CppToCsConverter.Core.Parsers
                     // This converts "CAgrMT *GetMethod" to "CAgrMT* GetMethod" for consistent regex matching
                     var normalizedMethodLine = NormalizePointerSpacing(methodLine);
                     
-                    var methodMatch = _methodRegex.Match(normalizedMethodLine);
+                    Match methodMatch;
+                    try
+                    {
+                        methodMatch = CppPatterns.MethodDeclaration().Match(normalizedMethodLine);
+                    }
+                    catch (RegexMatchTimeoutException)
+                    {
+                        _logger.LogWarning($"Warning: Skipping a declaration in {fileName}.h that is too long or malformed to parse: {methodLine.Trim().Substring(0, Math.Min(60, methodLine.Trim().Length))}...");
+                        continue;
+                    }
                     
 
                     
@@ -342,7 +350,7 @@ namespace CppToCsConverter.Core.Parsers
                             {
                                 // Collect comments and region markers for method from .h file
                                 var (headerComments, headerIndentation) = CollectPrecedingCommentsWithIndentation(lines, originalIndex);
-                                method.HeaderComments = headerComments;
+                                method.HeaderComments = headerComments.Count > 0 ? headerComments : null; // Most methods have none
                                 method.HeaderCommentIndentation = headerIndentation;
                                 
                                 var (regionStart, regionEnd) = ParseRegionMarkers(lines, originalIndex, i);
@@ -354,14 +362,14 @@ namespace CppToCsConverter.Core.Parsers
                         }
                         catch (Exception ex)
                         {
-                            Console.WriteLine($"Error parsing method '{methodMatch.Groups[4].Value}': {ex.Message}");
+                            _logger.LogError($"Error parsing method '{methodMatch.Groups[4].Value}': {ex.Message}");
                         }
                         continue;
                     }
                 }
 
                 // Parse members - only if it looks like a proper member declaration
-                var memberMatch = _memberRegex.Match(line);
+                var memberMatch = CppPatterns.MemberDeclaration().Match(line);
                 
 
                 
@@ -390,15 +398,15 @@ namespace CppToCsConverter.Core.Parsers
                         
                         var member = new CppMember
                         {
-                            Type = memberMatch.Groups[3].Value.Trim(),
-                            Name = memberMatch.Groups[4].Value,
+                            Type = StringPool.Intern(memberMatch.Groups[3].ValueSpan.Trim()),
+                            Name = StringPool.Intern(memberMatch.Groups[4].ValueSpan),
                             AccessSpecifier = currentAccess,
                             IsStatic = memberMatch.Groups[1].Success,
                             IsConst = memberMatch.Groups[2].Success,
                             IsArray = memberMatch.Groups[5].Success,
                             ArraySize = memberMatch.Groups[5].Success ? memberMatch.Groups[5].Value : string.Empty,
                             InitializationValue = memberMatch.Groups[6].Success ? memberMatch.Groups[6].Value.Trim() : string.Empty,
-                            PrecedingComments = precedingComments,
+                            PrecedingComments = precedingComments.Count > 0 ? precedingComments : null, // Most members have none
                             PostfixComment = postfixComment,
                             RegionStart = regionStart,
                             RegionEnd = regionEnd
@@ -426,8 +434,8 @@ namespace CppToCsConverter.Core.Parsers
             
             var method = new CppMethod
             {
-                Name = methodMatch.Groups[4].Value,
-                ReturnType = returnType,
+                Name = StringPool.Intern(methodMatch.Groups[4].ValueSpan),
+                ReturnType = StringPool.Intern(returnType),
                 AccessSpecifier = currentAccess,
                 IsVirtual = methodMatch.Groups[1].Success,
                 IsStatic = methodMatch.Groups[2].Success,
@@ -463,12 +471,7 @@ namespace CppToCsConverter.Core.Parsers
                 
                 if (openBrace >= 0 && closeBrace > openBrace)
                 {
-                    var methodBody = fullMethod.Substring(openBrace + 1, closeBrace - openBrace - 1);
-                    // Replace tab characters with four spaces
-                    methodBody = methodBody.Replace("\t", "    ");
-                    
-                    // Normalize indentation: find minimum indentation and remove it from all lines
-                    method.InlineImplementation = NormalizeIndentation(methodBody);
+                    method.InlineImplementationText = MethodBodyText.FromRaw(fullMethod.AsMemory(openBrace + 1, closeBrace - openBrace - 1));
                 }
                 else
                 {
@@ -552,8 +555,9 @@ namespace CppToCsConverter.Core.Parsers
             }
             
             // Check if this is a single-line inline method (balanced braces on same line)
-            int braceLevel = currentLine.Count(c => c == '{') - currentLine.Count(c => c == '}');
-            if (braceLevel == 0 && currentLine.Contains("{") && currentLine.Contains("}"))
+            var (openBraces, closeBraces) = CppLexer.CountCodeBraces(currentLine);
+            int braceLevel = openBraces - closeBraces;
+            if (braceLevel == 0 && openBraces > 0)
             {
                 // Single-line inline method - return as-is without collecting more lines
                 return methodBuilder.ToString();
@@ -585,7 +589,8 @@ namespace CppToCsConverter.Core.Parsers
                         methodBuilder.Append(" " + nextLine.Trim());
                     }
                     
-                    braceLevel += nextLine.Count(c => c == '{') - nextLine.Count(c => c == '}');
+                    var (nextOpenBraces, nextCloseBraces) = CppLexer.CountCodeBraces(nextLine);
+                    braceLevel += nextOpenBraces - nextCloseBraces;
                     
                     // If we hit a semicolon and no braces, it's a declaration
                     if (nextLine.TrimEnd().EndsWith(";") && braceLevel == 0)
@@ -625,7 +630,8 @@ namespace CppToCsConverter.Core.Parsers
                     // Add line break and preserve the original line exactly
                     methodBuilder.Append("\n" + nextLine);
                     
-                    braceLevel += nextLine.Count(c => c == '{') - nextLine.Count(c => c == '}');
+                    var (nextOpenBraces, nextCloseBraces) = CppLexer.CountCodeBraces(nextLine);
+                    braceLevel += nextOpenBraces - nextCloseBraces;
                     
                     if (braceLevel == 0)
                     {
@@ -693,7 +699,7 @@ namespace CppToCsConverter.Core.Parsers
                     continue;
 
                 // Parse "memberName(value)" or "memberName{value}"
-                var match = Regex.Match(trimmedPart, @"(\w+)\s*[\(\{]([^\)\}]*?)[\)\}]");
+                var match = CppPatterns.MemberInitializer().Match(trimmedPart);
                 if (match.Success)
                 {
                     initializers.Add(new CppMemberInitializer
@@ -842,205 +848,12 @@ namespace CppToCsConverter.Core.Parsers
             return (methodLine.Substring(startParamIndex), "");
         }
 
-        private List<string> SplitParametersRespectingParentheses(string parametersString)
-        {
-            var result = new List<string>();
-            var current = new StringBuilder();
-            int parenLevel = 0;
-            int angleLevel = 0;
-            bool inQuotes = false;
-            char quoteChar = '\0';
-
-            for (int i = 0; i < parametersString.Length; i++)
-            {
-                char c = parametersString[i];
-                
-                // Handle quotes
-                if (!inQuotes && (c == '"' || c == '\''))
-                {
-                    inQuotes = true;
-                    quoteChar = c;
-                    current.Append(c);
-                }
-                else if (inQuotes && c == quoteChar)
-                {
-                    // Check if it's escaped
-                    if (i > 0 && parametersString[i - 1] == '\\')
-                    {
-                        current.Append(c);
-                    }
-                    else
-                    {
-                        inQuotes = false;
-                        current.Append(c);
-                    }
-                }
-                else if (inQuotes)
-                {
-                    current.Append(c);
-                }
-                else
-                {
-                    // Not in quotes, handle brackets and commas
-                    if (c == '(') parenLevel++;
-                    else if (c == ')') parenLevel--;
-                    else if (c == '<') angleLevel++;
-                    else if (c == '>') angleLevel--;
-                    else if (c == ',' && parenLevel == 0 && angleLevel == 0)
-                    {
-                        // This comma is a parameter separator
-                        if (current.Length > 0)
-                        {
-                            result.Add(current.ToString().Trim());
-                            current.Clear();
-                        }
-                        continue; // Don't add the comma to current
-                    }
-                    
-                    current.Append(c);
-                }
-            }
-
-            if (current.Length > 0)
-            {
-                result.Add(current.ToString().Trim());
-            }
-
-            return result;
-        }
-
         // Comment and region parsing methods
         private (List<string> comments, int indentation) CollectPrecedingCommentsWithIndentation(string[] lines, int currentIndex)
         {
-            var comments = new List<string>();
-            int originalIndentation = 0;
-            int lookbackIndex = currentIndex - 1;
-            
-            // Skip empty lines immediately before
-            while (lookbackIndex >= 0 && string.IsNullOrWhiteSpace(lines[lookbackIndex]))
-            {
-                lookbackIndex--;
-            }
-            
-            // Collect comment blocks working backwards
-            var commentBlock = new List<string>();
-            bool inMultiLineComment = false;
-            
-            while (lookbackIndex >= 0)
-            {
-                var line = lines[lookbackIndex];
-                var trimmedLine = line.Trim();
-                
-                // Check for single line comments
-                if (trimmedLine.StartsWith("//"))
-                {
-                    commentBlock.Insert(0, line); // Keep original indentation temporarily
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Check for end of multi-line comment
-                if (trimmedLine.EndsWith("*/"))
-                {
-                    // Check if this is a pure comment line or a code line with postfix comment
-                    // Pure comment: starts with //, /*, or * (continuation line)
-                    // Code with postfix: has non-comment content before the /*
-                    bool isPureCommentLine = trimmedLine.StartsWith("//") || 
-                                            trimmedLine.StartsWith("/*") || 
-                                            trimmedLine.StartsWith("*") ||
-                                            !trimmedLine.Contains("/*"); // Multi-line comment continuation without /* on this line
-                    
-                    if (isPureCommentLine)
-                    {
-                        inMultiLineComment = true;
-                        commentBlock.Insert(0, line); // Keep original indentation temporarily
-                        
-                        // If this line also starts the comment, we're done with this block
-                        if (trimmedLine.StartsWith("/*"))
-                        {
-                            inMultiLineComment = false;
-                            lookbackIndex--;
-                            continue;
-                        }
-                        
-                        lookbackIndex--;
-                        continue;
-                    }
-                    else
-                    {
-                        // Line ends with */ but has code before /* 
-                        // This is a code line with postfix comment - stop collecting
-                        break;
-                    }
-                }
-                
-                // Check for start of multi-line comment
-                if (inMultiLineComment && trimmedLine.StartsWith("/*"))
-                {
-                    commentBlock.Insert(0, line); // Keep original indentation temporarily
-                    inMultiLineComment = false;
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Inside multi-line comment
-                if (inMultiLineComment)
-                {
-                    commentBlock.Insert(0, line); // Keep original indentation temporarily
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Check for empty lines between comment blocks
-                if (string.IsNullOrWhiteSpace(trimmedLine))
-                {
-                    // Peek ahead to see if there are more comments
-                    int peekIndex = lookbackIndex - 1;
-                    while (peekIndex >= 0 && string.IsNullOrWhiteSpace(lines[peekIndex]))
-                    {
-                        peekIndex--;
-                    }
-                    
-                    if (peekIndex >= 0)
-                    {
-                        var peekLine = lines[peekIndex].Trim();
-                        // Only continue if the peeked line is a PURE comment (not a member with postfix comment)
-                        bool isPureComment = (peekLine.StartsWith("//")) || 
-                                            (peekLine.StartsWith("/*") && peekLine.EndsWith("*/")) ||
-                                            (peekLine.StartsWith("*") && peekLine.EndsWith("*/"));
-                        
-                        if (isPureComment)
-                        {
-                            // There are more comments, include the empty line
-                            commentBlock.Insert(0, line);
-                            lookbackIndex--;
-                            continue;
-                        }
-                    }
-                }
-                
-                // Not a comment line, stop collecting
-                break;
-            }
-            
-            // Process collected comments - remove minimum indentation while preserving relative indentation
-            if (commentBlock.Any())
-            {
-                // Capture original indentation from first comment line
-                var firstComment = commentBlock[0];
-                originalIndentation = firstComment.Length - firstComment.TrimStart().Length;
-                
-                // Find minimum indentation from non-empty lines
-                int minIndent = commentBlock
-                    .Where(l => !string.IsNullOrWhiteSpace(l))
-                    .Min(l => l.Length - l.TrimStart().Length);
-                
-                // Remove minimum indentation from all lines to preserve relative indentation
-                comments.AddRange(commentBlock.Select(l => 
-                    string.IsNullOrWhiteSpace(l) ? "" : (l.Length >= minIndent ? l.Substring(minIndent) : l)));
-            }
-            
-            return (comments, originalIndentation);
+            // The comment map of a line array is built on first use and shared by all declarations in it
+            var comments = _commentBlockMaps.GetValue(lines, l => new CommentBlockMap(l, CommentBlockStyle.Header));
+            return comments.GetPrecedingComments(currentIndex);
         }
 
         private List<string> CollectPrecedingComments(string[] lines, int currentIndex)
@@ -1111,7 +924,7 @@ namespace CppToCsConverter.Core.Parsers
                 var line = lines[i].Trim();
                 if (string.IsNullOrWhiteSpace(line)) continue;
                 
-                var regionMatch = _pragmaRegionRegex.Match(line);
+                var regionMatch = CppPatterns.HeaderRegionMarker().Match(line);
                 if (regionMatch.Success && regionMatch.Groups[1].Value.Equals("region", StringComparison.OrdinalIgnoreCase))
                 {
                     var description = regionMatch.Groups[2].Success ? regionMatch.Groups[2].Value.Trim() : string.Empty;
@@ -1140,7 +953,7 @@ namespace CppToCsConverter.Core.Parsers
                 var line = lines[i].Trim();
                 if (string.IsNullOrWhiteSpace(line)) continue;
                 
-                var regionMatch = _pragmaRegionRegex.Match(line);
+                var regionMatch = CppPatterns.HeaderRegionMarker().Match(line);
                 if (regionMatch.Success && regionMatch.Groups[1].Value.Equals("endregion", StringComparison.OrdinalIgnoreCase))
                 {
                     var comment = regionMatch.Groups[2].Success ? regionMatch.Groups[2].Value.Trim() : string.Empty;
@@ -1158,65 +971,6 @@ namespace CppToCsConverter.Core.Parsers
             return (regionStart, regionEnd);
         }
         
-        /// <summary>
-        /// Normalizes the indentation of a method body by finding the minimum indentation
-        /// of all non-empty lines and removing that amount from all lines.
-        /// This ensures consistent relative indentation regardless of the original context.
-        /// </summary>
-        /// <param name="methodBody">The raw method body content</param>
-        /// <returns>The method body with normalized indentation</returns>
-        private string NormalizeIndentation(string methodBody)
-        {
-            if (string.IsNullOrWhiteSpace(methodBody))
-                return string.Empty;
-                
-            var lines = methodBody.Split(new[] { "\r\n", "\n", "\r" }, StringSplitOptions.None);
-            
-            // Find the minimum indentation among all non-empty lines
-            int minIndentation = int.MaxValue;
-            foreach (var line in lines)
-            {
-                if (!string.IsNullOrWhiteSpace(line))
-                {
-                    int leadingSpaces = 0;
-                    foreach (char c in line)
-                    {
-                        if (c == ' ')
-                            leadingSpaces++;
-                        else
-                            break;
-                    }
-                    minIndentation = Math.Min(minIndentation, leadingSpaces);
-                }
-            }
-            
-            // If no non-empty lines found, return empty
-            if (minIndentation == int.MaxValue)
-                return string.Empty;
-                
-            // Remove the minimum indentation from all lines
-            var normalizedLines = new List<string>();
-            foreach (var line in lines)
-            {
-                if (string.IsNullOrWhiteSpace(line))
-                {
-                    // Keep empty lines as empty
-                    normalizedLines.Add(string.Empty);
-                }
-                else
-                {
-                    // Remove the minimum indentation
-                    var normalizedLine = line.Length > minIndentation 
-                        ? line.Substring(minIndentation) 
-                        : line.TrimStart();
-                    normalizedLines.Add(normalizedLine);
-                }
-            }
-            
-            // Join lines and trim trailing whitespace
-            return string.Join("\n", normalizedLines).Trim();
-        }
-
         /// <summary>
         /// Parses structs from header file and returns them with original C++ syntax preserved
         /// </summary>
@@ -1225,8 +979,7 @@ namespace CppToCsConverter.Core.Parsers
         {
             try
             {
-                var content = File.ReadAllText(filePath);
-                var lines = content.Split(new[] { '\r', '\n' }, StringSplitOptions.RemoveEmptyEntries);
+                var lines = SourceFileContent.Read(filePath).NonEmptyLines;
                 
                 return ParseStructsFromLines(lines);
             }
@@ -1243,6 +996,20 @@ namespace CppToCsConverter.Core.Parsers
         }
 
         public List<CppStruct> ParseStructsFromLines(string[] lines, bool skipMethodBodies)
+        {
+            return ParseStructsFromLines(lines, skipMethodBodies, null);
+        }
+
+        /// <summary>
+        /// Parses structs from the lines of a source file, skipping method bodies. Brace counts come from the
+        /// file's token stream, whose lines correspond one-to-one to the lines.
+        /// </summary>
+        internal List<CppStruct> ParseStructsFromLines(string[] lines, CppTokenStream tokens)
+        {
+            return ParseStructsFromLines(lines, skipMethodBodies: true, tokens);
+        }
+
+        private List<CppStruct> ParseStructsFromLines(string[] lines, bool skipMethodBodies, CppTokenStream? tokens)
         {
             var structs = new List<CppStruct>();
             int i = 0;
@@ -1258,8 +1025,9 @@ namespace CppToCsConverter.Core.Parsers
                 if (skipMethodBodies)
                 {
                     // Count braces on this line
-                    int openBraces = line.Count(c => c == '{');
-                    int closeBraces = line.Count(c => c == '}');
+                    var (openBraces, closeBraces) = tokens != null && i < tokens.LineCount
+                        ? tokens.GetLineBraceCounts(i)
+                        : CppLexer.CountCodeBraces(line);
                     
                     // Check if this line is a method signature (has :: and ( at depth 0)
                     if (!insideMethodBody && braceDepth == 0 && line.Contains("::") && line.Contains("("))
@@ -1361,21 +1129,21 @@ namespace CppToCsConverter.Core.Parsers
                 if (!isVariableDeclaration)
                 {
                     // Pattern 1: struct MyStruct
-                    var simpleMatch = _simpleStructRegex.Match(line);
+                    var simpleMatch = CppPatterns.SimpleStruct().Match(line);
                     if (simpleMatch.Success)
                     {
                         structResult = ParseSimpleStruct(lines, ref i, simpleMatch.Groups[1].Value);
                     }
                     
                     // Pattern 2: typedef struct
-                    var typedefMatch = _typedefStructRegex.Match(line);
+                    var typedefMatch = CppPatterns.TypedefStruct().Match(line);
                     if (typedefMatch.Success)
                     {
                         structResult = ParseTypedefStruct(lines, ref i);
                     }
                     
                     // Pattern 3: typedef struct MyTag  
-                    var typedefTagMatch = _typedefStructTagRegex.Match(line);
+                    var typedefTagMatch = CppPatterns.TypedefStructTag().Match(line);
                     if (typedefTagMatch.Success)
                     {
                         structResult = ParseTypedefStructTag(lines, ref i, typedefTagMatch.Groups[1].Value);
@@ -1408,18 +1176,9 @@ namespace CppToCsConverter.Core.Parsers
                 structLines.Add(line);
                 
                 // Count braces to find the end
-                foreach (char c in line)
-                {
-                    if (c == '{')
-                    {
-                        braceCount++;
-                        foundOpenBrace = true;
-                    }
-                    else if (c == '}')
-                    {
-                        braceCount--;
-                    }
-                }
+                var (openBraces, closeBraces) = CppLexer.CountCodeBraces(line);
+                braceCount += openBraces - closeBraces;
+                foundOpenBrace |= openBraces > 0;
                 
                 // Check for end of struct
                 if (foundOpenBrace && braceCount == 0 && line.TrimEnd().EndsWith(";"))
@@ -1457,23 +1216,14 @@ namespace CppToCsConverter.Core.Parsers
                 structLines.Add(line);
                 
                 // Count braces
-                foreach (char c in line)
-                {
-                    if (c == '{')
-                    {
-                        braceCount++;
-                        foundOpenBrace = true;
-                    }
-                    else if (c == '}')
-                    {
-                        braceCount--;
-                    }
-                }
+                var (openBraces, closeBraces) = CppLexer.CountCodeBraces(line);
+                braceCount += openBraces - closeBraces;
+                foundOpenBrace |= openBraces > 0;
                 
                 // Check for end with struct name
                 if (foundOpenBrace && braceCount == 0)
                 {
-                    var nameMatch = _typedefNameRegex.Match(line);
+                    var nameMatch = CppPatterns.TypedefName().Match(line);
                     if (nameMatch.Success)
                     {
                         structName = nameMatch.Groups[1].Value;
@@ -1511,23 +1261,14 @@ namespace CppToCsConverter.Core.Parsers
                 structLines.Add(line);
                 
                 // Count braces
-                foreach (char c in line)
-                {
-                    if (c == '{')
-                    {
-                        braceCount++;
-                        foundOpenBrace = true;
-                    }
-                    else if (c == '}')
-                    {
-                        braceCount--;
-                    }
-                }
+                var (openBraces, closeBraces) = CppLexer.CountCodeBraces(line);
+                braceCount += openBraces - closeBraces;
+                foundOpenBrace |= openBraces > 0;
                 
                 // Check for end with struct name
                 if (foundOpenBrace && braceCount == 0)
                 {
-                    var nameMatch = _typedefNameRegex.Match(line);
+                    var nameMatch = CppPatterns.TypedefName().Match(line);
                     if (nameMatch.Success)
                     {
                         structName = nameMatch.Groups[1].Value;
@@ -1564,18 +1305,9 @@ namespace CppToCsConverter.Core.Parsers
                 var trimmedLine = line.Trim();
                 
                 // Track brace depth
-                foreach (char c in trimmedLine)
-                {
-                    if (c == '{')
-                    {
-                        braceDepth++;
-                        insideBraces = true;
-                    }
-                    else if (c == '}')
-                    {
-                        braceDepth--;
-                    }
-                }
+                var (openBraces, closeBraces) = CppLexer.CountCodeBraces(trimmedLine);
+                braceDepth += openBraces - closeBraces;
+                insideBraces |= openBraces > 0;
                 
                 // Exit when we leave the struct body completely
                 if (insideBraces && braceDepth == 0)
@@ -1678,9 +1410,9 @@ namespace CppToCsConverter.Core.Parsers
             var trimmedLine = line.Trim();
             
             // Check for the three struct patterns
-            return _simpleStructRegex.IsMatch(trimmedLine) || 
-                   _typedefStructRegex.IsMatch(trimmedLine) || 
-                   _typedefStructTagRegex.IsMatch(trimmedLine);
+            return CppPatterns.SimpleStruct().IsMatch(trimmedLine) || 
+                   CppPatterns.TypedefStruct().IsMatch(trimmedLine) || 
+                   CppPatterns.TypedefStructTag().IsMatch(trimmedLine);
         }
         
         /// <summary>
@@ -1689,6 +1421,9 @@ namespace CppToCsConverter.Core.Parsers
         /// </summary>
         private string RemoveCommentedOutParameters(string parametersString)
         {
+            if (!parametersString.Contains("/*", StringComparison.Ordinal))
+                return parametersString.Trim();
+
             var result = new StringBuilder();
             var i = 0;
             
@@ -1739,104 +1474,6 @@ namespace CppToCsConverter.Core.Parsers
             
             return result.ToString().Trim();
         }
-
-        /// <summary>
-        /// Extracts positioned comments from parameter text while preserving the clean parameter declaration
-        /// </summary>
-        private (string cleanText, List<ParameterComment> positionedComments) ExtractPositionedCommentsFromParameter(string parameterText)
-        {
-            var positionedComments = new List<ParameterComment>();
-            var cleanText = new StringBuilder();
-            var i = 0;
-            
-            // Track if we've seen the parameter name to determine prefix vs suffix
-            // We'll consider comments prefix until we see both type and name parts
-            var hasSeenParameterName = false;
-            var cleanContentSoFar = new StringBuilder();
-            
-            while (i < parameterText.Length)
-            {
-                // Check for single-line comment
-                if (i < parameterText.Length - 1 && parameterText[i] == '/' && parameterText[i + 1] == '/')
-                {
-                    var commentStart = i;
-                    // Find end of line or end of string
-                    while (i < parameterText.Length && parameterText[i] != '\n')
-                        i++;
-                    
-                    var comment = parameterText.Substring(commentStart, i - commentStart).Trim();
-                    var position = hasSeenParameterName ? CommentPosition.Suffix : CommentPosition.Prefix;
-                    positionedComments.Add(new ParameterComment { CommentText = comment, Position = position });
-                    
-                    // Add newline if present
-                    if (i < parameterText.Length && parameterText[i] == '\n')
-                    {
-                        cleanText.Append('\n');
-                        i++;
-                    }
-                }
-                // Check for multi-line comment
-                else if (i < parameterText.Length - 1 && parameterText[i] == '/' && parameterText[i + 1] == '*')
-                {
-                    var commentStart = i;
-                    i += 2; // Skip /*
-                    
-                    // Find end of comment
-                    while (i <= parameterText.Length - 2)
-                    {
-                        if (parameterText[i] == '*' && parameterText[i + 1] == '/')
-                        {
-                            i += 2; // Skip */
-                            break;
-                        }
-                        i++;
-                    }
-                    
-                    var comment = parameterText.Substring(commentStart, i - commentStart).Trim();
-                    var position = hasSeenParameterName ? CommentPosition.Suffix : CommentPosition.Prefix;
-                    positionedComments.Add(new ParameterComment { CommentText = comment, Position = position });
-                }
-                else
-                {
-                    var ch = parameterText[i];
-                    cleanText.Append(ch);
-                    
-                    // Add to clean content for parameter name detection (preserve spaces for word counting)
-                    cleanContentSoFar.Append(ch);
-                    
-                    // Try to detect if we've seen a parameter name
-                    // A parameter typically has format: [const] Type[*|&] paramName
-                    // We'll check if we have at least one word that could be a type and another that could be a name
-                    if (!hasSeenParameterName && !char.IsWhiteSpace(ch))
-                    {
-                        var cleanSoFar = cleanContentSoFar.ToString().Trim();
-                        // Simple heuristic: if we have multiple words and the current clean content ends with identifier characters
-                        if (cleanSoFar.Contains(' ') || cleanSoFar.Contains('&') || cleanSoFar.Contains('*'))
-                        {
-                            var words = cleanSoFar.Split(new[] { ' ', '*', '&', '<', '>', ':' }, StringSplitOptions.RemoveEmptyEntries);
-                            if (words.Length >= 2) // We have type and possibly name
-                            {
-                                hasSeenParameterName = true;
-                            }
-                        }
-                    }
-                    
-                    i++;
-                }
-            }
-            
-            return (cleanText.ToString(), positionedComments);
-        }
-
-        /// <summary>
-        /// Extracts inline comments from parameter text while preserving the clean parameter declaration (legacy method)
-        /// </summary>
-        private (string cleanText, List<string> comments) ExtractInlineCommentsFromParameter(string parameterText)
-        {
-            var (cleanText, positionedComments) = ExtractPositionedCommentsFromParameter(parameterText);
-            var comments = positionedComments.Select(pc => pc.CommentText).ToList();
-            return (cleanText, comments);
-        }
         /// <summary>
         /// Extracts the return type from the original method line to preserve C++ formatting (spaces before * or &).
         /// Uses the method name to identify where the return type ends.
@@ -1851,20 +1488,8 @@ namespace CppToCsConverter.Core.Parsers
             if (methodNameIndex == -1)
                 return "void"; // Can't find method name, default to void
 
-            // Extract everything before the method name
-            string beforeMethodName = originalMethodLine.Substring(0, methodNameIndex).Trim();
-
-            // Remove modifiers to get the return type
-            beforeMethodName = System.Text.RegularExpressions.Regex.Replace(beforeMethodName, @"^\s*(virtual|static)\s+", "");
-            beforeMethodName = System.Text.RegularExpressions.Regex.Replace(beforeMethodName, @"^\s*(virtual|static)\s+", ""); // Handle both virtual and static
-
-            beforeMethodName = beforeMethodName.Trim();
-
-            // If nothing left, it's a constructor/destructor (no return type)
-            if (string.IsNullOrWhiteSpace(beforeMethodName) || beforeMethodName.StartsWith("~"))
-                return "void";
-
-            return beforeMethodName;
+            // Extract everything before the method name, without modifiers; nothing left means a constructor/destructor
+            return TypeNormalizer.ReturnTypeFromDeclarationPrefix(originalMethodLine.Substring(0, methodNameIndex).Trim());
         }
 
 
@@ -1882,19 +1507,14 @@ namespace CppToCsConverter.Core.Parsers
                 return methodLine; // No parameters, return as-is
 
             // Only normalize the part before the parameters (the return type and method name part)
-            string beforeParams = methodLine.Substring(0, paramStartIndex);
-            string fromParams = methodLine.Substring(paramStartIndex);
-
             // Normalize pointer spacing: "Type *" or "Type * " -> "Type* "
             // Normalize reference spacing: "Type &" or "Type & " -> "Type& "
-            // Use regex to find type followed by optional spaces, then * or &, then method name
-            beforeParams = System.Text.RegularExpressions.Regex.Replace(
-                beforeParams,
-                @"(\w+)\s+([\*&]+)\s*(\w+)",  // Type, spaces, pointer/ref, optional spaces, methodName
-                "$1$2 $3"  // Type+pointer/ref, space, methodName
-            );
-
-            return beforeParams + fromParams;
+            string beforeParams = methodLine.Substring(0, paramStartIndex);
+            string normalizedBeforeParams = TypeNormalizer.NormalizeDeclarationPrefix(beforeParams);
+            if (ReferenceEquals(normalizedBeforeParams, beforeParams))
+                return methodLine;
+
+            return string.Concat(normalizedBeforeParams, methodLine.AsSpan(paramStartIndex));
         }
     }
 }
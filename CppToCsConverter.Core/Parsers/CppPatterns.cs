@@ -0,0 +1,79 @@
+using System.Text.RegularExpressions;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// Regular expressions shared by the parsers and generators. They are source generated once per process
+    /// instead of being compiled per parser instance, and every match is bounded by <see cref="MatchTimeoutMilliseconds"/>
+    /// so a single malformed input cannot stall a batch run.
+    /// Patterns whose failed attempts rescan the rest of the input from every start position use the
+    /// non-backtracking engine, which matches in linear time and finds the same matches for these patterns.
+    /// </summary>
+    internal static partial class CppPatterns
+    {
+        public const int MatchTimeoutMilliseconds = 2000;
+
+        // Header declarations
+
+        [GeneratedRegex(@"(?:class|struct)\s+(?:__declspec\s*\([^)]+\)\s+)?(\w+)(?:\s*:\s*(?:public|private|protected)\s+(\w+))?", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex ClassDeclaration();
+
+        [GeneratedRegex(@"(?:(virtual)\s+)?(?:(static)\s+)?(?:((?:const\s+)?\w+(?:::\w+)?[\*&]*)\s+)?([~]?\w+)\s*\(.*?\)(?:\s*(const))?(?:\s*:\s*([^{]*))?(?:\s*=\s*0)?(?:\s*\{.*?\})?", RegexOptions.Singleline | RegexOptions.NonBacktracking, MatchTimeoutMilliseconds)]
+        public static partial Regex MethodDeclaration();
+
+        [GeneratedRegex(@"^\s*(?:(static)\s+)?(?:(const)\s+)?(\w+(?:\s*\*|\s*&)?)\s+(\w+)(?:\s*\[\s*([^]]*)\s*\])?(?:\s*=\s*([^;]+))?;\s*(.*)$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex MemberDeclaration();
+
+        [GeneratedRegex(@"^(private|protected|public)\s*:\s*(.*)$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex AccessSpecifier();
+
+        // "memberName(value)" or "memberName{value}" in a constructor initializer list
+        [GeneratedRegex(@"(\w+)\s*[\(\{]([^\)\}]*?)[\)\}]", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex MemberInitializer();
+
+        [GeneratedRegex(@"^\s*(virtual|static)\s+", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex LeadingMethodModifier();
+
+        // Type, spaces, pointer/ref, optional spaces, method name
+        [GeneratedRegex(@"(\w+)\s+([\*&]+)\s*(\w+)", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex SpacedPointerReturnType();
+
+        // Header regions are "#pragma region" only
+        [GeneratedRegex(@"^\s*#pragma\s+(region|endregion)(?:\s+(.*))?$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex HeaderRegionMarker();
+
+        [GeneratedRegex(@"^\s*#define\s+(\w+)(?:\s+(.*))?$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex Define();
+
+        // Structs: "} MyStruct;", "struct Name", "typedef struct" and "typedef struct Tag"
+
+        [GeneratedRegex(@"^\s*}\s*(\w+)\s*;\s*$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex TypedefName();
+
+        [GeneratedRegex(@"^\s*struct\s+(\w+)", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex SimpleStruct();
+
+        [GeneratedRegex(@"^\s*typedef\s+struct\s*$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex TypedefStruct();
+
+        [GeneratedRegex(@"^\s*typedef\s+struct\s+(\w+)\s*$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex TypedefStructTag();
+
+        // Source implementations
+
+        [GeneratedRegex(@"(?:(\w+(?:\s*\*|\s*&)?)\s+)?(\w+)\s*::\s*([~]?\w+)\s*\(([^)]*)\)(?:\s*(const))?\s*\{", RegexOptions.Multiline | RegexOptions.NonBacktracking, MatchTimeoutMilliseconds)]
+        public static partial Regex MethodImplementation();
+
+        // Source regions accept "#region" as well as "#pragma region"
+        [GeneratedRegex(@"^\s*#(?:pragma\s+)?(region|endregion)(?:\s+(.*))?$", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex SourceRegionMarker();
+
+        // Factory methods: "new CClass(" and "IInterface* p = new CClass("
+
+        [GeneratedRegex(@"new\s+([A-Z][A-Za-z0-9_]*)\s*\(", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex NewExpression();
+
+        [GeneratedRegex(@"([A-Z][A-Za-z0-9_]*)\s*\*\s*\w+\s*=\s*new\s+([A-Z][A-Za-z0-9_]*)\s*\(", RegexOptions.None, MatchTimeoutMilliseconds)]
+        public static partial Regex PointerInitializedWithNew();
+    }
+}
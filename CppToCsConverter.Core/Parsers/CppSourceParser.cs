@@ -4,41 +4,54 @@ using System.IO;
 using System.Linq;
 using System.Text;
 using System.Text.RegularExpressions;
+using System.Threading.Tasks;
 using CppToCsConverter.Core.Models;
 using CppToCsConverter.Core.Logging;
 using CppToCsConverter.Core.Parsers.ParameterParsing;
+using CppToCsConverter.Core.Parsers.Lexing;
+using CppToCsConverter.Core.Utils;
 
 namespace CppToCsConverter.Core.Parsers
 {
     public class CppSourceParser
     {
+        // Share of a source file's text its method bodies must make up to be kept as raw text after parsing
+        private const int RawMethodBodiesMinPercentOfText = 75;
+
+        // Chunks per degree of parallelism when a large source file is split, so uneven chunks still balance
+        private const int ChunksPerThread = 4;
+
         private readonly ILogger _logger;
         private readonly CppParameterParser _parameterParser;
-        private readonly Regex _methodImplementationRegex = new Regex(
-            @"(?:(\w+(?:\s*\*|\s*&)?)\s+)?(\w+)\s*::\s*([~]?\w+)\s*\(([^)]*)\)(?:\s*(const))?\s*\{", 
-            RegexOptions.Compiled | RegexOptions.Multiline);
-        
-        // Regex to detect local methods (functions without class scope regulator ::)
-        private readonly Regex _localMethodRegex = new Regex(
-            @"(?:^|\n)\s*(?:(\w+(?:\s*\*|\s*&)?)\s+)?([~]?\w+)\s*\(([^)]*)\)(?:\s*(const))?\s*\{",
-            RegexOptions.Compiled | RegexOptions.Multiline);
-        
-        private readonly Regex _staticMemberInitRegex = new Regex(
-            @"(?:(const)\s+)?(?:(\w+)\s+)?(\w+)\s*::\s*(\w+)(?:\s*\[\s*\])?(?:\s*\[\s*(\d*)\s*\])?\s*=\s*([^;]+);", 
-            RegexOptions.Compiled);
-
-        private readonly Regex _pragmaRegionRegex = new Regex(@"^\s*#(?:pragma\s+)?(region|endregion)(?:\s+(.*))?$", RegexOptions.Compiled);
-        private readonly Regex _defineRegex = new Regex(@"^\s*#define\s+(\w+)(?:\s+(.*))?$", RegexOptions.Compiled);
+        private readonly CppHeaderParser _structParser;
+        private readonly ICppLexer _lexer = new CppLexer();
 
         public CppSourceParser(ILogger? logger = null)
+            : this(logger, null)
+        {
+        }
+
+        /// <param name="logger">Logger for parse errors</param>
+        /// <param name="structParser">Parser for structs defined in source files, whose parameter list cache is shared too; pass the converter's header parser to share them</param>
+        public CppSourceParser(ILogger? logger, CppHeaderParser? structParser)
         {
             _logger = logger ?? new ConsoleLogger();
-            _parameterParser = new CppParameterParser(
-                new ParameterBlockSplitter(),
-                new ParameterComponentExtractor()
-            );
+            _structParser = structParser ?? new CppHeaderParser(_logger);
+            _parameterParser = _structParser.ParameterParser;
         }
 
+        /// <summary>
+        /// Maximum number of chunks of one large source file scanned for method implementations concurrently.
+        /// The default of 1 parses every file serially; the result is identical regardless of this setting.
+        /// </summary>
+        public int MaxDegreeOfParallelism { get; set; } = 1;
+
+        /// <summary>
+        /// Source files with at least this many lines are split into chunks at top-level closing braces and the chunks
+        /// are scanned in parallel, when <see cref="MaxDegreeOfParallelism"/> allows it
+        /// </summary>
+        internal int ParallelParseMinLines { get; set; } = 20000;
+
         public (List<CppMethod> Methods, List<CppStaticMemberInit> StaticInits) ParseSourceFile(string filePath)
         {
             var (methods, staticInits, _) = ParseSourceFileWithDefines(filePath);
@@ -52,6 +65,14 @@ namespace CppToCsConverter.Core.Parsers
         }
 
         public CppSourceFile ParseSourceFileComplete(string filePath)
+        {
+            return ParseSourceFileComplete(filePath, null);
+        }
+
+        /// <summary>
+        /// Parses a source file, taking its content from the store when one is given
+        /// </summary>
+        internal CppSourceFile ParseSourceFileComplete(string filePath, FileContentStore? contents)
         {
             var sourceFile = new CppSourceFile
             {
@@ -60,35 +81,36 @@ namespace CppToCsConverter.Core.Parsers
             
             try
             {
-                var content = File.ReadAllText(filePath);
-                // DO NOT use RemoveEmptyEntries - we need to preserve line structure for brace tracking
-                var lines = content.Split(new[] { "\r\n", "\r", "\n" }, StringSplitOptions.None);
+                var file = contents?.Take(filePath) ?? SourceFileContent.Read(filePath);
+                // All lines including empty ones - we need to preserve line structure for brace tracking
+                var lines = file.Lines;
+                var tokens = _lexer.Tokenize(file.Text);
                 
                 // Parse file top comments first
                 sourceFile.FileTopComments.AddRange(ParseFileTopComments(lines));
                 
                 // Parse structs defined in source file (skip those inside method bodies)
-                var headerParser = new CppHeaderParser(_logger);
-                var parsedStructs = headerParser.ParseStructsFromLines(lines, skipMethodBodies: true);
+                var parsedStructs = _structParser.ParseStructsFromLines(lines, tokens);
                 sourceFile.Structs.AddRange(parsedStructs);
                 
                 // Parse method implementations using the original approach
-                sourceFile.Methods.AddRange(ParseMethodImplementations(content, sourceFile.FileName));
+                sourceFile.Methods.AddRange(ParseMethodImplementations(tokens, sourceFile.FileName));
                 
                 // Move struct constructors/methods from Methods list to their respective structs
                 MoveStructMethodsToStructs(sourceFile.Methods, sourceFile.Structs);
                 
                 // Add comments and regions to the parsed methods
-                AddCommentsAndRegionsToMethods(lines, sourceFile.Methods);
+                var declarations = new SourceDeclarationMap(lines, CppPatterns.SourceRegionMarker(), CppPatterns.MethodImplementation());
+                AddCommentsAndRegionsToMethods(declarations, sourceFile.Methods);
                 
                 // Parse region markers as standalone elements
-                sourceFile.Regions.AddRange(ParseRegionMarkers(lines, sourceFile.FileName));
+                sourceFile.Regions.AddRange(ParseRegionMarkers(lines, tokens, sourceFile.FileName));
                 
                 // Parse static member initializations
-                sourceFile.StaticMemberInits.AddRange(ParseStaticMemberInitializations(content));
+                sourceFile.StaticMemberInits.AddRange(ParseStaticMemberInitializations(tokens));
                 
                 // Parse define statements
-                sourceFile.Defines.AddRange(ParseDefineStatementsFromLines(lines, sourceFile.FileName));
+                sourceFile.Defines.AddRange(ParseDefineStatementsFromLines(lines, declarations.Comments, sourceFile.FileName));
                 
                 return sourceFile;
             }
@@ -99,7 +121,7 @@ namespace CppToCsConverter.Core.Parsers
             }
         }
 
-        private List<CppDefine> ParseDefineStatementsFromLines(string[] lines, string fileName)
+        private List<CppDefine> ParseDefineStatementsFromLines(string[] lines, CommentBlockMap comments, string fileName)
         {
             var defines = new List<CppDefine>();
             
@@ -108,14 +130,14 @@ namespace CppToCsConverter.Core.Parsers
                 var line = lines[i].Trim();
                 
                 // Check if this is a define statement
-                var defineMatch = _defineRegex.Match(line);
+                var defineMatch = CppPatterns.Define().Match(line);
                 if (defineMatch.Success)
                 {
                     // Only collect defines that have a value (ignore defines with no value like #define ARCHIVER_H_)
                     if (defineMatch.Groups[2].Success && !string.IsNullOrWhiteSpace(defineMatch.Groups[2].Value))
                     {
                         // Collect comments before the define
-                        var precedingComments = CollectPrecedingComments(lines, i);
+                        var (precedingComments, _) = comments.GetPrecedingComments(i);
                         
                         // Extract postfix comment from value (e.g., "2 // comment" -> value="2", comment="// comment")
                         string rawValue = defineMatch.Groups[2].Value.Trim();
@@ -160,91 +182,52 @@ namespace CppToCsConverter.Core.Parsers
             return defines;
         }
 
-        private void AddCommentsAndRegionsToMethods(string[] lines, List<CppMethod> methods)
+        private void AddCommentsAndRegionsToMethods(SourceDeclarationMap declarations, List<CppMethod> methods)
         {
             // For each method, find its line in the source file and collect comments
             foreach (var method in methods)
             {
                 // Look for method declaration line (may span multiple lines)
-                for (int i = 0; i < lines.Length; i++)
-                {
-                    var line = lines[i].Trim();
-                    
-                    // Check if this line contains the method signature
-                    if (line.Contains($"{method.ClassName}::{method.Name}") && line.Contains("("))
-                    {
-                        // Collect comments before method with indentation
-                        var (sourceComments, sourceIndentation) = CollectPrecedingCommentsWithIndentation(lines, i);
-                        method.SourceComments = sourceComments;
-                        method.SourceCommentIndentation = sourceIndentation;
-                        
-                        // Capture implementation indentation from the method body
-                        if (!string.IsNullOrEmpty(method.ImplementationBody))
-                        {
-                            method.ImplementationIndentation = CppToCsConverter.Core.Utils.IndentationManager.DetectOriginalIndentation(method.ImplementationBody);
-                        }
-                        
-                        // Look for region markers around method
-                        var (regionStart, regionEnd) = ParseSourceRegionMarkers(lines, i, methods, method.OrderIndex);
-                        method.SourceRegionStart = regionStart;
-                        method.SourceRegionEnd = regionEnd;
-                        
-                        break; // Found this method, move to next one
-                    }
-                }
+                int i = declarations.FindDeclarationLine(method.ClassName, method.Name);
+                if (i < 0)
+                    continue;
+
+                // Collect comments before method with indentation
+                var (sourceComments, sourceIndentation) = declarations.Comments.GetPrecedingComments(i);
+                method.SourceComments = sourceComments.Count > 0 ? sourceComments : null; // Most methods have none
+                method.SourceCommentIndentation = sourceIndentation;
+                
+                // Look for region markers around method
+                var (regionStart, regionEnd) = declarations.GetRegionMarkers(i);
+                method.SourceRegionStart = regionStart;
+                method.SourceRegionEnd = regionEnd;
             }
         }
 
-        private List<CppMethod> ParseMethodImplementations(string content, string fileName)
+        /// <summary>
+        /// Finds class method implementations "[ReturnType] Class::Method(params) [const] [: initializers] {" in the
+        /// token stream, followed by local methods. Comments and string literals never produce matches.
+        /// A large file is scanned in chunks in parallel (see <see cref="GetParallelChunks"/>) with the same result.
+        /// </summary>
+        private List<CppMethod> ParseMethodImplementations(CppTokenStream tokens, string fileName)
         {
-            var methods = new List<CppMethod>();
-            var matches = _methodImplementationRegex.Matches(content);
-            
-            int orderIndex = 0;
-            foreach (Match match in matches)
+            var chunks = GetParallelChunks(tokens);
+            var matches = FindClassMethodImplementations(tokens, fileName, chunks);
+            var methods = new List<CppMethod>(matches.Count);
+            foreach (var match in matches)
             {
-                var method = new CppMethod
-                {
-                    ReturnType = match.Groups[1].Success ? match.Groups[1].Value.Trim() : "void",
-                    ClassName = match.Groups[2].Value,
-                    Name = match.Groups[3].Value,
-                    IsConst = match.Groups[5].Success,
-                    OrderIndex = orderIndex++
-                };
-
-                // Check if constructor or destructor
-                method.IsConstructor = !method.Name.StartsWith("~") && method.Name == method.ClassName;
-                method.IsDestructor = method.Name.StartsWith("~");
-                
-                // Constructors and destructors have no return type in C#
-                if (method.IsConstructor || method.IsDestructor)
-                {
-                    method.ReturnType = string.Empty;
-                }
-
-                // Parse parameters from implementation
-                var parametersString = match.Groups[4].Value;
-                method.Parameters = ParseParametersFromImplementation(parametersString);
-
-                // Extract method body
-                method.ImplementationBody = ExtractMethodBody(content, match.Index + match.Length);
-                method.HasResolvedImplementation = true; // Mark as resolved even if body is empty
-                
-                // Set TargetFileName for .cpp implementations
-                method.TargetFileName = fileName;
-
-                methods.Add(method);
+                match.Method.OrderIndex = methods.Count;
+                methods.Add(match.Method);
             }
 
-            // Handle multi-line method signatures that the regex missed
-            methods.AddRange(ParseMultiLineMethodImplementations(content, fileName, methods, orderIndex));
-
             // Parse local methods (functions without class scope regulator ::)
-            var localMethods = ParseLocalMethods(content, fileName, methods);
+            var positionIndex = new SourcePositionIndex(tokens);
+            var localMethodPositions = new Dictionary<CppMethod, int>();
+            var localMethods = ParseLocalMethods(positionIndex, fileName, methods, localMethodPositions, chunks);
             methods.AddRange(localMethods);
 
             // Recalculate order indices based on actual file positions
-            RecalculateMethodOrderIndices(content, methods);
+            RecalculateMethodOrderIndices(positionIndex, methods, localMethodPositions);
             
             // Sort methods by their recalculated order indices
             methods = methods.OrderBy(m => m.OrderIndex).ToList();
@@ -252,501 +235,341 @@ namespace CppToCsConverter.Core.Parsers
             return methods;
         }
 
-        private List<CppMethod> ParseMultiLineMethodImplementations(string content, string fileName, List<CppMethod> existingMethods, int startOrderIndex)
+        /// <summary>
+        /// Splits a large source file into token ranges ending at top-level closing braces, or returns null when it is
+        /// parsed serially. No function body spans two chunks, so most chunks scan exactly as the whole file would.
+        /// </summary>
+        private List<(int Start, int End)>? GetParallelChunks(CppTokenStream tokens)
         {
-            var methods = new List<CppMethod>();
-            var lines = content.Split('\n');
-            
-            for (int i = 0; i < lines.Length; i++)
+            if (MaxDegreeOfParallelism <= 1 || tokens.LineCount < ParallelParseMinLines)
+                return null;
+
+            var chunks = SplitAtTopLevelBraces(tokens, tokens.Count / (MaxDegreeOfParallelism * ChunksPerThread));
+            return chunks.Count > 1 ? chunks : null;
+        }
+
+        /// <summary>
+        /// Splits the token stream into consecutive ranges of at least minTokens tokens (except the last), each ending
+        /// after a closing brace at brace depth 0
+        /// </summary>
+        internal static List<(int Start, int End)> SplitAtTopLevelBraces(CppTokenStream tokens, int minTokens)
+        {
+            var chunks = new List<(int Start, int End)>();
+            int start = 0;
+            int depth = 0;
+            for (int i = 0; i < tokens.Count; i++)
             {
-                var line = lines[i].Trim();
-                
-                // Look for pattern: ClassName::MethodName ( - allow params on same line or next line
-                var methodHeaderMatch = Regex.Match(line, @"^(?:(\w+(?:\s*\*|\s*&)?)\s+)?(\w+)\s*::\s*([~]?\w+)\s*\(");
-                if (methodHeaderMatch.Success)
+                if (tokens.IsPunctuation(i, '{'))
                 {
-                    var className = methodHeaderMatch.Groups[2].Value;
-                    var methodName = methodHeaderMatch.Groups[3].Value;
-                    var returnType = methodHeaderMatch.Groups[1].Success ? methodHeaderMatch.Groups[1].Value.Trim() : "void";
-                    
-                    // Find the closing parenthesis and opening brace
-                    var parametersString = "";
-                    
-                    // Check if there are parameters on the same line as the opening paren
-                    int openParenIndex = line.IndexOf('(');
-                    int currentLine = i;
-                    int parenCount = 0;
-                    bool foundClosingParen = false;
-                    
-                    // Start counting parens from the opening paren
-                    if (openParenIndex >= 0)
-                    {
-                        for (int charIndex = openParenIndex; charIndex < line.Length; charIndex++)
-                        {
-                            char c = line[charIndex];
-                            if (c == '(') parenCount++;
-                            else if (c == ')')
-                            {
-                                parenCount--;
-                                if (parenCount == 0)
-                                {
-                                    // Found closing paren on same line - extract parameters between parens
-                                    parametersString = line.Substring(openParenIndex + 1, charIndex - openParenIndex - 1) + "\n";
-                                    foundClosingParen = true;
-                                    break;
-                                }
-                            }
-                        }
-                        
-                        // If closing paren not on first line, add rest of first line to parametersString
-                        if (!foundClosingParen && openParenIndex < line.Length - 1)
-                        {
-                            parametersString = line.Substring(openParenIndex + 1) + "\n";
-                        }
-                    }
-                    
-                    currentLine = i + 1;
-                    bool foundOpeningBrace = false;
-                    int braceLineIndex = -1;
-                    
-                    // Collect parameters across multiple lines
-                    while (currentLine < lines.Length && parenCount > 0 && !foundClosingParen)
-                    {
-                        var paramLine = lines[currentLine];
-                        
-                        // Count parentheses to find the closing paren position
-                        int closingParenPos = -1;
-                        for (int charIndex = 0; charIndex < paramLine.Length; charIndex++)
-                        {
-                            char c = paramLine[charIndex];
-                            if (c == '(') parenCount++;
-                            else if (c == ')')
-                            {
-                                parenCount--;
-                                if (parenCount == 0)
-                                {
-                                    // Found the closing paren - only include content before it
-                                    closingParenPos = charIndex;
-                                    foundClosingParen = true;
-                                    break;
-                                }
-                            }
-                        }
-                        
-                        // Add the line content (up to closing paren if found)
-                        if (closingParenPos >= 0)
-                        {
-                            parametersString += paramLine.Substring(0, closingParenPos) + "\n";
-                        }
-                        else
-                        {
-                            parametersString += paramLine + "\n"; // Add newline to preserve line structure
-                        }
-                        
-                        if (foundClosingParen)
-                            break;
-                        
-                        currentLine++;
-                    }
-                    
-                    if (!foundClosingParen)
-                        continue;
-                    
-                    // Look for const modifier and opening brace after the closing paren
-                    // Check the current line first (where closing paren was found) for opening brace
-                    bool isConst = false;
-                    var currentBraceLine = lines[currentLine - 1].Trim(); // currentLine is one past the closing paren line
-                    if (currentBraceLine.Contains("const"))
-                    {
-                        isConst = true;
-                    }
-                    if (currentBraceLine.Contains("{"))
-                    {
-                        foundOpeningBrace = true;
-                        braceLineIndex = currentLine - 1;
-                    }
-                    
-                    // If not found on same line, look on subsequent lines
-                    if (!foundOpeningBrace)
-                    {
-                        while (currentLine < lines.Length && !foundOpeningBrace)
-                        {
-                            var braceLine = lines[currentLine].Trim();
-                            if (braceLine.Contains("const") && !foundOpeningBrace)
-                            {
-                                isConst = true;
-                            }
-                            if (braceLine.Contains("{"))
-                            {
-                                foundOpeningBrace = true;
-                                braceLineIndex = currentLine;
-                                break;
-                            }
-                            currentLine++;
-                        }
-                    }
-                    
-                    if (foundOpeningBrace)
-                    {
-                        // Create the method
-                        var method = new CppMethod
-                        {
-                            ReturnType = returnType,
-                            ClassName = className,
-                            Name = methodName,
-                            IsConst = isConst,
-                            OrderIndex = startOrderIndex + methods.Count
-                        };
+                    depth++;
+                }
+                else if (tokens.IsPunctuation(i, '}') && depth > 0 && --depth == 0 && i + 1 - start >= minTokens && i + 1 < tokens.Count)
+                {
+                    chunks.Add((start, i + 1));
+                    start = i + 1;
+                }
+            }
+            chunks.Add((start, tokens.Count));
+            return chunks;
+        }
 
-                        // Check if constructor or destructor
-                        method.IsConstructor = !method.Name.StartsWith("~") && method.Name == method.ClassName;
-                        method.IsDestructor = method.Name.StartsWith("~");
-                        
-                        // Constructors and destructors have no return type in C#
-                        if (method.IsConstructor || method.IsDestructor)
-                        {
-                            method.ReturnType = string.Empty;
-                        }
+        /// <summary>
+        /// Class method implementations in file order with the token index of each match and the index the scan
+        /// continues at. With chunks, each chunk is scanned on its own in parallel and the results are stitched in order.
+        /// </summary>
+        private List<(CppMethod Method, int Index, int Next)> FindClassMethodImplementations(CppTokenStream tokens, string fileName, List<(int Start, int End)>? chunks)
+        {
+            var matches = new List<(CppMethod Method, int Index, int Next)>();
+            if (chunks == null)
+            {
+                ScanMethodImplementations(tokens, fileName, 0, tokens.Count, matches);
+                return matches;
+            }
 
-                        // Parse parameters
-                        method.Parameters = ParseParametersFromImplementation(parametersString);
-
-                        // Check if we already parsed this exact method (same name + parameters)
-                        // This prevents duplicates while allowing overloads
-                        bool isDuplicate = methods.Any(m => 
-                            m.ClassName == className && 
-                            m.Name == methodName &&
-                            m.Parameters.Count == method.Parameters.Count &&
-                            ParametersEqual(m.Parameters, method.Parameters)) ||
-                            existingMethods.Any(m => 
-                                m.ClassName == className && 
-                                m.Name == methodName &&
-                                m.Parameters.Count == method.Parameters.Count &&
-                                ParametersEqual(m.Parameters, method.Parameters));
-                        
-                        if (isDuplicate)
-                            continue;
-
-                        // Extract method body
-                        // Calculate the position of the opening brace based on line numbers
-                        int braceIndex = -1;
-                        int charPos = 0;
-                        for (int lineIdx = 0; lineIdx <= braceLineIndex && lineIdx < lines.Length; lineIdx++)
-                        {
-                            if (lineIdx == braceLineIndex)
-                            {
-                                // Find the brace in this specific line
-                                int braceInLine = lines[lineIdx].IndexOf('{');
-                                if (braceInLine >= 0)
-                                {
-                                    braceIndex = charPos + braceInLine;
-                                    break;
-                                }
-                            }
-                            charPos += lines[lineIdx].Length + 1; // +1 for the newline character
-                        }
-                        
-                        if (braceIndex >= 0)
-                        {
-                            method.ImplementationBody = ExtractMethodBody(content, braceIndex + 1);
-                            method.HasResolvedImplementation = true; // Mark as resolved even if body is empty
-                        }
-                        
-                        // Set TargetFileName
-                        method.TargetFileName = fileName;
+            var chunkMatches = new List<(CppMethod Method, int Index, int Next)>[chunks.Count];
+            Parallel.For(0, chunks.Count, new ParallelOptions { MaxDegreeOfParallelism = MaxDegreeOfParallelism }, k =>
+            {
+                chunkMatches[k] = new List<(CppMethod Method, int Index, int Next)>();
+                ScanMethodImplementations(tokens, fileName, chunks[k].Start, chunks[k].End, chunkMatches[k]);
+            });
 
-                        methods.Add(method);
-                    }
+            // The serial scan skips the body of each match, so it enters a chunk where the previous one left off.
+            // From that index on, the chunk's own matches are the serial ones, since its scan passes the same index;
+            // should the index fall inside a body the chunk skipped instead, the chunk is rescanned from there.
+            int resumeAt = 0;
+            for (int k = 0; k < chunks.Count; k++)
+            {
+                var (start, end) = chunks[k];
+                if (resumeAt >= end)
+                    continue;
+
+                var found = chunkMatches[k];
+                if (found.Any(m => m.Index < resumeAt && resumeAt < m.Next))
+                {
+                    found = new List<(CppMethod Method, int Index, int Next)>();
+                    ScanMethodImplementations(tokens, fileName, resumeAt, end, found);
+                }
+
+                var next = end;
+                foreach (var match in found)
+                {
+                    if (match.Index < resumeAt)
+                        continue;
+                    matches.Add(match);
+                    next = Math.Max(end, match.Next);
                 }
+                resumeAt = next;
             }
-            
-            return methods;
+            return matches;
         }
 
-        private List<CppParameter> ParseParametersFromImplementation(string parametersString)
+        /// <summary>
+        /// Scans for class method implementations starting at token indexes from start up to end, skipping the body of each
+        /// </summary>
+        private void ScanMethodImplementations(CppTokenStream tokens, string fileName, int start, int end, List<(CppMethod Method, int Index, int Next)> matches)
         {
-            if (string.IsNullOrWhiteSpace(parametersString))
-                return new List<CppParameter>();
+            for (int i = Math.Max(start, 1); i < end && i + 2 < tokens.Count; i++)
+            {
+                var method = TryParseMethodImplementation(tokens, i, fileName, out var closeBraceIndex);
+                if (method == null)
+                    continue;
 
-            // Use new parameter parser
-            return _parameterParser.ParseParameters(parametersString);
+                // Continue after the body; nothing inside it can be another implementation
+                var next = closeBraceIndex > i ? closeBraceIndex + 1 : i + 1;
+                matches.Add((method, i, next));
+                i = next - 1;
+            }
         }
 
-        private string[] SplitParameters(string parametersString)
+        /// <summary>
+        /// Parses "[ReturnType] Class::Method(params) [const] [: initializers] {" with the scope operator at token index i,
+        /// or returns null if there is no implementation there
+        /// </summary>
+        private CppMethod? TryParseMethodImplementation(CppTokenStream tokens, int i, string fileName, out int closeBraceIndex)
         {
-            var parameters = new List<string>();
-            var current = new System.Text.StringBuilder();
-            int depth = 0;
-            bool inCStyleComment = false;
-            bool inCppStyleComment = false;
+            closeBraceIndex = -1;
+            if (!tokens.IsScopeOperator(i) || tokens[i - 1].Kind != CppTokenKind.Identifier)
+                return null;
+
+            int classIndex = i - 1;
+            int nameIndex = i + 1;
+            bool isDestructor = false;
+            if (tokens.IsPunctuation(nameIndex, '~') && nameIndex + 1 < tokens.Count && tokens[nameIndex + 1].Start == tokens[nameIndex].End)
+            {
+                isDestructor = true;
+                nameIndex++;
+            }
             
-            for (int i = 0; i < parametersString.Length; i++)
+            if (tokens[nameIndex].Kind != CppTokenKind.Identifier || nameIndex + 1 >= tokens.Count || !tokens.IsPunctuation(nameIndex + 1, '('))
+                return null;
+
+            int openParenIndex = nameIndex + 1;
+            int closeParenIndex = FindClosingParenthesis(tokens, openParenIndex);
+            if (closeParenIndex < 0)
+                return null;
+
+            int openBraceIndex = FindMethodBodyStart(tokens, closeParenIndex, out bool isConst);
+            if (openBraceIndex < 0)
+                return null;
+
+            var method = new CppMethod
             {
-                char c = parametersString[i];
-                
-                // Check for start of C++ style comment (//)
-                if (!inCStyleComment && !inCppStyleComment && c == '/' && i + 1 < parametersString.Length && parametersString[i + 1] == '/')
-                {
-                    inCppStyleComment = true;
-                    current.Append(c);
+                ReturnType = GetImplementationReturnType(tokens, classIndex),
+                ClassName = tokens.GetPooledText(classIndex),
+                Name = isDestructor ? StringPool.Intern("~" + tokens.GetText(nameIndex)) : tokens.GetPooledText(nameIndex),
+                IsConst = isConst
+            };
+
+            // Check if constructor or destructor
+            method.IsConstructor = !method.Name.StartsWith("~") && method.Name == method.ClassName;
+            method.IsDestructor = method.Name.StartsWith("~");
+            
+            // Constructors and destructors have no return type in C#
+            if (method.IsConstructor || method.IsDestructor)
+            {
+                method.ReturnType = string.Empty;
+            }
+
+            // Parse parameters from implementation
+            var parametersStart = tokens[openParenIndex].End;
+            var parametersString = tokens.Text.Substring(parametersStart, tokens[closeParenIndex].Start - parametersStart);
+            method.Parameters = ParseParametersFromImplementation(parametersString);
+
+            // Extract method body
+            method.ImplementationBodyText = ExtractMethodBody(tokens, openBraceIndex);
+            method.HasResolvedImplementation = true; // Mark as resolved even if body is empty
+            
+            // Set TargetFileName for .cpp implementations
+            method.TargetFileName = fileName;
+
+            closeBraceIndex = tokens.GetMatchingBrace(openBraceIndex);
+            return method;
+        }
+
+        /// <summary>
+        /// Returns the index of the parenthesis closing the one at openParenIndex, or -1 if a statement or block
+        /// boundary is reached first
+        /// </summary>
+        private static int FindClosingParenthesis(CppTokenStream tokens, int openParenIndex)
+        {
+            // Both lookups are precomputed, so unclosed calls in a long malformed line do not rescan the rest of the file
+            var closeParenIndex = tokens.GetMatchingParenthesis(openParenIndex);
+            return closeParenIndex >= 0 && closeParenIndex < tokens.FindNextStatementBoundary(openParenIndex) ? closeParenIndex : -1;
+        }
+
+        /// <summary>
+        /// Finds the opening brace of a method body after the parameter list, skipping "const", exception
+        /// specifications, comments and a constructor initializer list. Returns -1 for declarations and calls.
+        /// </summary>
+        private static int FindMethodBodyStart(CppTokenStream tokens, int closeParenIndex, out bool isConst)
+        {
+            isConst = false;
+            bool inInitializerList = false;
+            bool firstSpecifier = true;
+            for (int i = closeParenIndex + 1; i < tokens.Count; i++)
+            {
+                ref readonly var token = ref tokens[i];
+                if (token.IsComment)
                     continue;
-                }
-                
-                // Check for end of C++ style comment (newline)
-                if (inCppStyleComment && (c == '\n' || c == '\r'))
+
+                if (token.Kind == CppTokenKind.Identifier && !inInitializerList)
                 {
-                    inCppStyleComment = false;
-                    current.Append(c);
-                    
-                    // After a C++ style comment ends (at newline), this is a good place to split parameters
-                    // if we're not inside nested parens/angles and the current content looks complete
-                    if (depth == 0 && current.ToString().Trim().Length > 0)
+                    if (firstSpecifier && tokens.IsIdentifier(i, "const"))
+                        isConst = true;
+                    firstSpecifier = false;
+
+                    // noexcept(...) / throw(...)
+                    if (i + 1 < tokens.Count && tokens.IsPunctuation(i + 1, '('))
                     {
-                        // Check if there's a previous comma in the current parameter
-                        // If so, this comment was a trailing comment and the newline marks the parameter end
-                        var currentStr = current.ToString();
-                        var lastCommaIndex = currentStr.LastIndexOf(',');
-                        if (lastCommaIndex >= 0)
-                        {
-                            // There's a comma followed by a comment and newline - this is a parameter boundary
-                            // Add this parameter and start fresh
-                            parameters.Add(current.ToString());
-                            current.Clear();
-                            continue;
-                        }
+                        i = FindClosingParenthesis(tokens, i + 1);
+                        if (i < 0)
+                            return -1;
                     }
                     continue;
                 }
-                
-                // Check for start of C-style comment
-                if (!inCStyleComment && !inCppStyleComment && c == '/' && i + 1 < parametersString.Length && parametersString[i + 1] == '*')
-                {
-                    inCStyleComment = true;
-                    current.Append(c);
-                    continue;
-                }
-                
-                // Check for end of C-style comment
-                if (inCStyleComment && c == '*' && i + 1 < parametersString.Length && parametersString[i + 1] == '/')
-                {
-                    inCStyleComment = false;
-                    current.Append(c);
-                    continue;
-                }
-                
-                // If we're inside a comment, just append the character
-                if (inCStyleComment || inCppStyleComment)
-                {
-                    current.Append(c);
-                    continue;
-                }
-                
-                // Normal parameter splitting logic (only when not in comment)
-                if (c == '(' || c == '<')
-                    depth++;
-                else if (c == ')' || c == '>')
-                    depth--;
-                else if (c == ',' && depth == 0)
+
+                if (tokens.IsPunctuation(i, '{'))
                 {
-                    // Add the comma to current parameter
-                    current.Append(c);
-                    
-                    // Check if there's a trailing // comment on this line
-                    // Look ahead to see if there's a // before the next newline
-                    bool hasTrailingComment = false;
-                    int commentStart = -1;
-                    for (int j = i + 1; j < parametersString.Length; j++)
-                    {
-                        char lookAhead = parametersString[j];
-                        if (lookAhead == '\n' || lookAhead == '\r')
-                        {
-                            // Newline before //, so no trailing comment
-                            break;
-                        }
-                        if (lookAhead == '/' && j + 1 < parametersString.Length && parametersString[j + 1] == '/')
-                        {
-                            // Found // comment before newline - this is a trailing comment
-                            hasTrailingComment = true;
-                            commentStart = j;
-                            break;
-                        }
-                        if (!char.IsWhiteSpace(lookAhead))
-                        {
-                            // Non-whitespace, non-comment content - this is the next parameter
-                            break;
-                        }
-                    }
-                    
-                    if (!hasTrailingComment)
+                    // Brace initializer of a member, e.g. ": m_value{0}"
+                    if (inInitializerList && tokens[i - 1].Kind == CppTokenKind.Identifier)
                     {
-                        // Normal comma split - no trailing comment
-                        parameters.Add(current.ToString());
-                        current.Clear();
+                        i = tokens.GetMatchingBrace(i);
+                        if (i < 0)
+                            return -1;
                         continue;
                     }
-                    else
+                    return i;
+                }
+
+                if (!inInitializerList)
+                {
+                    if (tokens.IsPunctuation(i, ':'))
                     {
-                        // Has trailing comment - include whitespace and comment, then split after newline
-                        // Add whitespace before comment
-                        for (int j = i + 1; j < commentStart; j++)
-                        {
-                            current.Append(parametersString[j]);
-                        }
-                        // Add the comment
-                        i = commentStart;
-                        while (i < parametersString.Length && parametersString[i] != '\n' && parametersString[i] != '\r')
-                        {
-                            current.Append(parametersString[i]);
-                            i++;
-                        }
-                        // Add newline if present
-                        if (i < parametersString.Length && (parametersString[i] == '\n' || parametersString[i] == '\r'))
-                        {
-                            current.Append(parametersString[i]);
-                        }
-                        // Split here
-                        parameters.Add(current.ToString());
-                        current.Clear();
+                        inInitializerList = true;
                         continue;
                     }
+                    return -1;
                 }
-                
-                current.Append(c);
-            }
-            
-            if (current.Length > 0)
-                parameters.Add(current.ToString());
-            
-            // Fix misassigned suffix comments: move leading comments from parameters to suffix of previous parameter
-            return FixSuffixCommentAssignment(parameters.ToArray());
-        }
 
-        private string[] FixSuffixCommentAssignment(string[] parameters)
-        {
-            var fixedParameters = new List<string>();
-            
-            for (int i = 0; i < parameters.Length; i++)
-            {
-                var param = parameters[i].Trim();
-                
-                // Check if this parameter starts with a comment that might be a misplaced suffix comment
-                if (i > 0 && (param.StartsWith("/*") || param.StartsWith("//")))
+                // Inside the initializer list: skip member initializers up to the body
+                if (tokens.IsPunctuation(i, '('))
                 {
-                    // Extract the comment and remainder
-                    string comment = "";
-                    string remainder = param;
-                    
-                    if (param.StartsWith("/*"))
-                    {
-                        var endIndex = param.IndexOf("*/");
-                        if (endIndex >= 0)
-                        {
-                            comment = param.Substring(0, endIndex + 2);
-                            remainder = param.Substring(endIndex + 2).Trim();
-                        }
-                    }
-                    else if (param.StartsWith("//"))
-                    {
-                        var newlineIndex = param.IndexOf('\n');
-                        if (newlineIndex >= 0)
-                        {
-                            comment = param.Substring(0, newlineIndex);
-                            remainder = param.Substring(newlineIndex + 1).Trim();
-                        }
-                        else
-                        {
-                            comment = param;
-                            remainder = "";
-                        }
-                    }
-                    
-                    // Only move the comment if it looks like a misplaced suffix comment
-                    // Heuristics to distinguish:
-                    // - "/* IN */ const CString& param1" (don't move - legitimate short prefix)
-                    // - "/*IN/OUT: Memory table with open cursor pointing to specific row*/ double &dValue" (move - long misplaced suffix)
-                    var isLikelyMisplacedSuffix = !string.IsNullOrWhiteSpace(remainder) && 
-                                           comment.Length > 20 && // Long comments are likely documentation (suffix)
-                                           (comment.Contains(":") || comment.Contains("to ") || 
-                                            comment.Contains("for ") || comment.Contains("with ") ||
-                                            comment.Contains("Return") || comment.Contains("Set ")) && // Documentation keywords
-                                           remainder.Length > 10 && // Substantial parameter content
-                                           (remainder.Contains("&") || remainder.Contains("*") || 
-                                            remainder.Split(' ', '\t').Length >= 2); // Looks like type + name
-                    
-                    var shouldMoveComment = isLikelyMisplacedSuffix;
-                    
-                    if (shouldMoveComment && !string.IsNullOrEmpty(comment) && fixedParameters.Count > 0)
-                    {
-                        // Move comment to previous parameter as suffix
-                        fixedParameters[fixedParameters.Count - 1] += " " + comment;
-                        
-                        // Add remainder as current parameter
-                        if (!string.IsNullOrWhiteSpace(remainder))
-                        {
-                            fixedParameters.Add(remainder);
-                        }
-                    }
-                    else
-                    {
-                        // Don't move - keep as is (legitimate prefix comment)
-                        fixedParameters.Add(param);
-                    }
+                    i = FindClosingParenthesis(tokens, i);
+                    if (i < 0)
+                        return -1;
                 }
-                else
+                else if (tokens.IsPunctuation(i, ';') || tokens.IsPunctuation(i, '}'))
                 {
-                    fixedParameters.Add(param);
+                    return -1;
                 }
             }
-            
-            return fixedParameters.ToArray();
+            return -1;
         }
 
-        private string ExtractMethodBody(string content, int startIndex)
+        /// <summary>
+        /// Returns the return type written directly before "Class::" as a single word with an optional "*" or "&"
+        /// (e.g. "int", "CString&", "CFoo *"), or "void" when there is none.
+        /// </summary>
+        private static string GetImplementationReturnType(CppTokenStream tokens, int classIndex)
         {
-            int braceCount = 0;
-            int startBrace = -1;
-            
-            // Find the opening brace (should be at or near startIndex)
-            for (int i = startIndex - 10; i < content.Length && i < startIndex + 50; i++)
+            int typeEnd = classIndex - 1;
+            if (typeEnd < 0 || tokens[typeEnd].End == tokens[classIndex].Start)
+                return "void";
+
+            int typeStart = typeEnd;
+            if (tokens.IsPunctuation(typeEnd, '*') || tokens.IsPunctuation(typeEnd, '&'))
             {
-                if (content[i] == '{')
-                {
-                    startBrace = i;
-                    braceCount = 1;
-                    break;
-                }
+                typeStart = typeEnd - 1;
             }
-            
-            if (startBrace == -1)
-                return string.Empty;
-            
-            // Find the closing brace
-            for (int i = startBrace + 1; i < content.Length; i++)
+
+            if (typeStart < 0 || tokens[typeStart].Kind != CppTokenKind.Identifier)
+                return "void";
+
+            // A qualified type keeps only its last part ("std::string" -> "string")
+            var start = tokens[typeStart].Start;
+            return StringPool.Intern(tokens.Text.AsSpan(start, tokens[typeEnd].End - start).Trim());
+        }
+
+        private List<CppParameter> ParseParametersFromImplementation(string parametersString)
+        {
+            if (string.IsNullOrWhiteSpace(parametersString))
+                return new List<CppParameter>();
+
+            // Use new parameter parser
+            return _parameterParser.ParseParameters(parametersString);
+        }
+
+        /// <summary>
+        /// Normalizes the raw method bodies of a parsed source file now unless they are most of its text. Raw bodies
+        /// keep the whole file text in memory, which costs more than the normalized bodies when the file is mostly
+        /// declarations, comments and code outside methods.
+        /// </summary>
+        internal static void CompactMethodBodies(CppSourceFile sourceFile)
+        {
+            var methods = sourceFile.Methods.Concat(sourceFile.Structs.SelectMany(s => s.Methods)).ToList();
+            long rawLength = 0;
+            long textLength = 0;
+            foreach (var method in methods)
             {
-                if (content[i] == '{')
-                    braceCount++;
-                else if (content[i] == '}')
-                {
-                    braceCount--;
-                    if (braceCount == 0)
-                    {
-                        // Extract the method body (without the outer braces)
-                        var methodBody = content.Substring(startBrace + 1, i - startBrace - 1);
-                        // Replace tab characters with four spaces
-                        methodBody = methodBody.Replace("\t", "    ");
-                        
-                        // Normalize indentation: find minimum indentation and remove it from all lines
-                        return NormalizeIndentation(methodBody);
-                    }
-                }
+                rawLength += method.ImplementationBodyText.RawLength;
+                textLength = Math.Max(textLength, method.ImplementationBodyText.SourceTextLength);
+            }
+            if (rawLength * 100 >= textLength * RawMethodBodiesMinPercentOfText)
+                return;
+
+            foreach (var method in methods)
+            {
+                method.ImplementationBodyText = method.ImplementationBodyText.Normalize();
+
+                // Struct constructors share their body with their inline implementation
+                if (method.HasInlineImplementation)
+                    method.InlineImplementationText = method.ImplementationBodyText;
             }
+        }
+
+        /// <summary>
+        /// The text between the brace at openBraceIndex and its matching closing brace, as a raw body that is
+        /// normalized when generation reads it
+        /// </summary>
+        private static MethodBodyText ExtractMethodBody(CppTokenStream tokens, int openBraceIndex)
+        {
+            var closeBraceIndex = tokens.GetMatchingBrace(openBraceIndex);
+            if (closeBraceIndex < 0)
+                return MethodBodyText.FromText(string.Empty);
             
-            return string.Empty;
+            // Extract the method body (without the outer braces)
+            var bodyStart = tokens[openBraceIndex].End;
+            return MethodBodyText.FromRaw(tokens.Text.AsMemory(bodyStart, tokens[closeBraceIndex].Start - bodyStart));
         }
 
-        private List<CppMethod> ParseLocalMethods(string content, string fileName, List<CppMethod> existingMethods)
+        /// <summary>
+        /// Finds local methods: "[Type] Name(params) [const] {" starting a line, outside of class method bodies
+        /// </summary>
+        private List<CppMethod> ParseLocalMethods(SourcePositionIndex positionIndex, string fileName, List<CppMethod> existingMethods, Dictionary<CppMethod, int> localMethodPositions, List<(int Start, int End)>? chunks)
         {
             var localMethods = new List<CppMethod>();
+            var tokens = positionIndex.Tokens;
+            var content = tokens.Text;
             
             // First, determine which class methods are implemented in this file
             // Local methods belong to the class with the most methods implemented in the same .cpp file
@@ -759,26 +582,73 @@ namespace CppToCsConverter.Core.Parsers
                                             .FirstOrDefault().Key ?? "Unknown";
             
             // Get ranges of content that are inside method bodies (to exclude them)
-            var methodBodyRanges = GetMethodBodyRanges(content, existingMethods);
+            var methodBodyRanges = GetMethodBodyRanges(positionIndex, existingMethods);
+            var existingMethodNames = new HashSet<string>(existingMethods.Select(m => m.Name));
+            var existingMethodPositions = GetSortedMethodPositions(positionIndex, existingMethods);
+            var firstPositionByName = new Dictionary<string, int>(StringComparer.OrdinalIgnoreCase);
             
-            // Find all potential local method matches
-            var matches = _localMethodRegex.Matches(content);
-            var lines = content.Split('\n');
+            // Candidates are checked independently, so chunks of a large file are scanned in parallel and joined in order
+            var found = new List<(CppMethod Method, string Name, int Position)>();
+            if (chunks == null)
+            {
+                ScanChunk(0, tokens.Count, found);
+            }
+            else
+            {
+                var chunkFound = new List<(CppMethod Method, string Name, int Position)>[chunks.Count];
+                Parallel.For(0, chunks.Count, new ParallelOptions { MaxDegreeOfParallelism = MaxDegreeOfParallelism }, k =>
+                {
+                    chunkFound[k] = new List<(CppMethod Method, string Name, int Position)>();
+                    ScanChunk(chunks[k].Start, chunks[k].End, chunkFound[k]);
+                });
+                foreach (var chunk in chunkFound)
+                {
+                    found.AddRange(chunk);
+                }
+            }
+
+            foreach (var (localMethod, methodName, namePosition) in found)
+            {
+                localMethods.Add(localMethod);
+                
+                // Overloads share the position of the first definition with the name
+                if (!firstPositionByName.TryGetValue(methodName, out var position))
+                {
+                    position = namePosition;
+                    firstPositionByName.Add(methodName, position);
+                }
+                localMethodPositions[localMethod] = position;
+            }
             
-            foreach (Match match in matches)
+            return localMethods;
+
+            void ScanChunk(int start, int end, List<(CppMethod Method, string Name, int Position)> chunkFound)
             {
-                // Skip if this match is inside an existing method body
-                if (methodBodyRanges.Any(range => match.Index >= range.Start && match.Index < range.End))
-                    continue;
+                for (int i = start; i < end; i++)
+                {
+                    ScanCandidate(i, chunkFound);
+                }
+            }
+
+            void ScanCandidate(int i, List<(CppMethod Method, string Name, int Position)> chunkFound)
+            {
+                // Candidates start a line
+                if (tokens[i].Kind != CppTokenKind.Identifier ||
+                    (i > 0 && tokens[i - 1].End > tokens.GetLineStart(tokens[i].Line)))
+                    return;
+
+                if (!TryMatchLocalMethod(tokens, i, out var returnType, out var nameIndex, out var openParenIndex, out var closeParenIndex, out var isConst, out var openBraceIndex))
+                    return;
+
+                var matchIndex = tokens[i].Start;
                 
-                var returnType = match.Groups[1].Success ? match.Groups[1].Value.Trim() : "void";
-                var methodName = match.Groups[2].Value;
-                var parametersString = match.Groups[3].Value;
-                var isConst = match.Groups[4].Success;
+                // Skip if this match is inside an existing method body
+                if (SourcePositionIndex.IsInRanges(methodBodyRanges, matchIndex))
+                    return;
                 
-                // Skip if this looks like it might be a class method (contains ::)
-                if (methodName.Contains("::"))
-                    continue;
+                var methodName = tokens.GetText(nameIndex);
+                if (nameIndex > 0 && tokens.IsPunctuation(nameIndex - 1, '~') && tokens[nameIndex - 1].End == tokens[nameIndex].Start)
+                    methodName = "~" + methodName;
                 
                 // Skip if method name contains common non-method patterns (control flow keywords)
                 if (methodName.Equals("if", StringComparison.OrdinalIgnoreCase) ||
@@ -787,21 +657,20 @@ namespace CppToCsConverter.Core.Parsers
                     methodName.Equals("switch", StringComparison.OrdinalIgnoreCase) ||
                     methodName.Equals("catch", StringComparison.OrdinalIgnoreCase) ||
                     methodName.Equals("try", StringComparison.OrdinalIgnoreCase))
-                    continue;
+                    return;
                 
                 // Check if this is already found as a class method (to avoid duplicates)
-                if (existingMethods.Any(m => m.Name == methodName))
-                    continue;
+                if (existingMethodNames.Contains(methodName))
+                    return;
                 
                 // Determine order index based on position in file
-                int lineNumber = content.Substring(0, match.Index).Split('\n').Length - 1;
-                int orderIndex = GetMethodOrderIndex(content, match.Index, existingMethods);
+                int orderIndex = SourcePositionIndex.CountBefore(existingMethodPositions, matchIndex);
                 
                 // Create local method
                 var localMethod = new CppMethod
                 {
-                    ReturnType = returnType,
-                    Name = methodName,
+                    ReturnType = StringPool.Intern(returnType),
+                    Name = StringPool.Intern(methodName),
                     IsConst = isConst,
                     IsLocalMethod = true,
                     IsStatic = true,
@@ -812,62 +681,95 @@ namespace CppToCsConverter.Core.Parsers
                 };
 
                 // Parse parameters
-                localMethod.Parameters = ParseParametersFromImplementation(parametersString);
+                var parametersStart = tokens[openParenIndex].End;
+                localMethod.Parameters = ParseParametersFromImplementation(content.Substring(parametersStart, tokens[closeParenIndex].Start - parametersStart));
 
                 // Extract method body
-                localMethod.ImplementationBody = ExtractMethodBody(content, match.Index + match.Length);
+                localMethod.ImplementationBodyText = ExtractMethodBody(tokens, openBraceIndex);
                 localMethod.HasResolvedImplementation = true; // Mark as resolved even if body is empty
                 
                 // Only add if we successfully extracted a method body (not just forward declaration)
-                if (!string.IsNullOrWhiteSpace(localMethod.ImplementationBody))
+                if (!localMethod.ImplementationBodyText.IsEmpty)
                 {
-                    localMethods.Add(localMethod);
+                    chunkFound.Add((localMethod, methodName, tokens[nameIndex].Start));
                 }
             }
-            
-            return localMethods;
+        }
+
+        /// <summary>
+        /// Matches "[Type[*|&]] [~]Name(params) [const] {" at token index start. The parameter list ends at the
+        /// first closing parenthesis and only whitespace may separate the parts, as for a plain function definition.
+        /// </summary>
+        private static bool TryMatchLocalMethod(CppTokenStream tokens, int start, out string returnType, out int nameIndex, out int openParenIndex, out int closeParenIndex, out bool isConst, out int openBraceIndex)
+        {
+            returnType = "void";
+            isConst = false;
+            openParenIndex = closeParenIndex = openBraceIndex = -1;
+
+            // With a return type: Type [*|&] <whitespace> [~]Name
+            int typeEnd = start;
+            if (start + 1 < tokens.Count && (tokens.IsPunctuation(start + 1, '*') || tokens.IsPunctuation(start + 1, '&')))
+                typeEnd = start + 1;
+            nameIndex = typeEnd + 1;
+            if (nameIndex < tokens.Count && tokens.IsPunctuation(nameIndex, '~'))
+                nameIndex++;
+            if (nameIndex < tokens.Count && tokens[nameIndex].Kind == CppTokenKind.Identifier &&
+                tokens[typeEnd + 1].Start > tokens[typeEnd].End &&
+                TryMatchLocalMethodTail(tokens, nameIndex, out openParenIndex, out closeParenIndex, out isConst, out openBraceIndex))
+            {
+                returnType = tokens.Text.Substring(tokens[start].Start, tokens[typeEnd].End - tokens[start].Start).Trim();
+                return true;
+            }
+
+            // Without a return type
+            nameIndex = start;
+            return TryMatchLocalMethodTail(tokens, nameIndex, out openParenIndex, out closeParenIndex, out isConst, out openBraceIndex);
+        }
+
+        private static bool TryMatchLocalMethodTail(CppTokenStream tokens, int nameIndex, out int openParenIndex, out int closeParenIndex, out bool isConst, out int openBraceIndex)
+        {
+            isConst = false;
+            closeParenIndex = openBraceIndex = -1;
+            openParenIndex = nameIndex + 1;
+            if (openParenIndex >= tokens.Count || !tokens.IsPunctuation(openParenIndex, '('))
+                return false;
+
+            if (openParenIndex + 1 < tokens.Count)
+            {
+                closeParenIndex = tokens.FindNextCloseParenthesis(openParenIndex + 1);
+            }
+            if (closeParenIndex < 0 || closeParenIndex + 1 >= tokens.Count)
+                return false;
+
+            int next = closeParenIndex + 1;
+            if (tokens.IsIdentifier(next, "const"))
+            {
+                isConst = true;
+                next++;
+            }
+            if (next >= tokens.Count || !tokens.IsPunctuation(next, '{'))
+                return false;
+
+            openBraceIndex = next;
+            return true;
         }
         
         /// <summary>
-        /// Returns the character ranges (start, end) of all method bodies in the content
+        /// Returns the character ranges (start, end) of all method bodies in the content, sorted and merged
         /// </summary>
-        private List<(int Start, int End)> GetMethodBodyRanges(string content, List<CppMethod> methods)
+        private List<(int Start, int End)> GetMethodBodyRanges(SourcePositionIndex positionIndex, List<CppMethod> methods)
         {
             var ranges = new List<(int Start, int End)>();
             
             foreach (var method in methods)
             {
-                // Find the method signature in the content
-                var searchPattern = $"{method.ClassName}::{method.Name}";
-                var methodIndex = content.IndexOf(searchPattern);
-                if (methodIndex < 0)
-                    continue;
-                
-                // Find the opening brace
-                var openBraceIndex = content.IndexOf('{', methodIndex);
-                if (openBraceIndex < 0)
-                    continue;
-                
-                // Track braces to find the matching closing brace
-                int braceCount = 1;
-                int currentIndex = openBraceIndex + 1;
-                while (currentIndex < content.Length && braceCount > 0)
-                {
-                    if (content[currentIndex] == '{')
-                        braceCount++;
-                    else if (content[currentIndex] == '}')
-                        braceCount--;
-                    currentIndex++;
-                }
-                
-                if (braceCount == 0)
+                if (positionIndex.TryGetBodyRange(method.ClassName, method.Name, out var range))
                 {
-                    // Found the matching closing brace
-                    ranges.Add((openBraceIndex, currentIndex));
+                    ranges.Add(range);
                 }
             }
             
-            return ranges;
+            return SourcePositionIndex.MergeRanges(ranges);
         }
         
         /// <summary>
@@ -879,296 +781,138 @@ namespace CppToCsConverter.Core.Parsers
             return className.StartsWith("I") && className.Length > 1 && char.IsUpper(className[1]);
         }
         
-        private int GetMethodOrderIndex(string content, int matchIndex, List<CppMethod> existingMethods)
+        /// <summary>
+        /// Returns the signature positions of the methods found in the file, sorted
+        /// </summary>
+        private List<int> GetSortedMethodPositions(SourcePositionIndex positionIndex, List<CppMethod> methods)
         {
-            // Count how many existing methods appear before this position in the file
-            int orderIndex = 0;
-            
-            foreach (var method in existingMethods)
+            var positions = new List<int>(methods.Count);
+            foreach (var method in methods)
             {
-                // Find the position of each existing method in the content
-                var methodPattern = $"{method.ClassName}::{method.Name}";
-                var methodIndex = content.IndexOf(methodPattern);
-                if (methodIndex >= 0 && methodIndex < matchIndex)
+                var position = positionIndex.GetSignaturePosition(method.ClassName, method.Name);
+                if (position >= 0)
                 {
-                    orderIndex++;
+                    positions.Add(position);
                 }
             }
-            
-            return orderIndex;
+            positions.Sort();
+            return positions;
         }
 
-        private void RecalculateMethodOrderIndices(string content, List<CppMethod> methods)
+        private void RecalculateMethodOrderIndices(SourcePositionIndex positionIndex, List<CppMethod> methods, Dictionary<CppMethod, int> localMethodPositions)
         {
-            // Create a list of (method, position) pairs
-            var methodPositions = new List<(CppMethod method, int position)>();
-            
             foreach (var method in methods)
             {
-                int position = -1;
-                
+                int position;
                 if (method.IsLocalMethod)
                 {
-                    // For local methods, find by method name and opening brace
-                    var pattern = $"{method.Name}\\s*\\([^)]*\\)\\s*\\{{";
-                    var regex = new Regex(pattern, RegexOptions.IgnoreCase);
-                    var match = regex.Match(content);
-                    if (match.Success)
-                    {
-                        position = match.Index;
-                    }
+                    // For local methods, the position of the method name in its definition
+                    position = localMethodPositions.TryGetValue(method, out var localPosition) ? localPosition : -1;
                 }
                 else
                 {
-                    // For class methods, find by ClassName::MethodName
-                    var pattern = $"{Regex.Escape(method.ClassName)}::{Regex.Escape(method.Name)}";
-                    position = content.IndexOf(pattern);
+                    // For class methods, the first occurrence of ClassName::MethodName
+                    position = positionIndex.GetSignaturePosition(method.ClassName, method.Name);
                 }
                 
                 if (position >= 0)
                 {
-                    methodPositions.Add((method, position));
+                    method.OrderIndex = position; // Use character position for consistent ordering with regions
                 }
             }
-            
-            // Sort by file position and use position as OrderIndex (not sequential index)
-            foreach (var (method, position) in methodPositions)
-            {
-                method.OrderIndex = position; // Use character position for consistent ordering with regions
-            }
         }
 
-        private List<CppStaticMemberInit> ParseStaticMemberInitializations(string content)
+        private List<CppStaticMemberInit> ParseStaticMemberInitializations(CppTokenStream tokens)
         {
             var staticInits = new List<CppStaticMemberInit>();
-            var matches = _staticMemberInitRegex.Matches(content);
-            
-            foreach (Match match in matches)
-            {
-                var isConst = match.Groups[1].Success;
-                var type = match.Groups[2].Success ? match.Groups[2].Value : "auto";
-                var className = match.Groups[3].Value;
-                var memberName = match.Groups[4].Value;
-                var arraySize = match.Groups[5].Success ? match.Groups[5].Value : string.Empty;
-                var initValue = match.Groups[6].Value.Trim();
-                
-                staticInits.Add(new CppStaticMemberInit
-                {
-                    ClassName = className,
-                    MemberName = memberName,
-                    InitializationValue = initValue,
-                    IsArray = !string.IsNullOrEmpty(arraySize) || initValue.Trim().StartsWith("{"),
-                    ArraySize = arraySize,
-                    Type = type,
-                    IsConst = isConst
-                });
-                
-                Console.WriteLine($"Found static member initialization: {className}::{memberName} = {initValue}");
-            }
-            
-            return staticInits;
-        }
-
-        // Comment and region parsing methods for .cpp files
-        private (List<string> comments, int indentation) CollectPrecedingCommentsWithIndentation(string[] lines, int currentIndex)
-        {
-            var comments = new List<string>();
-            int originalIndentation = 0;
-            int lookbackIndex = currentIndex - 1;
-            
-            // Skip empty lines immediately before
-            while (lookbackIndex >= 0 && string.IsNullOrWhiteSpace(lines[lookbackIndex]))
-            {
-                lookbackIndex--;
-            }
+            var content = tokens.Text;
             
-            // Collect comment blocks working backwards
-            var commentBlock = new List<string>();
-            bool inMultiLineComment = false;
-            
-            while (lookbackIndex >= 0)
+            for (int i = 1; i + 2 < tokens.Count; i++)
             {
-                var line = lines[lookbackIndex].Trim();
-                
-                // Check for single line comments
-                if (line.StartsWith("//"))
-                {
-                    commentBlock.Insert(0, lines[lookbackIndex]);
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Check for end of multi-line comment
-                if (line.EndsWith("*/"))
-                {
-                    inMultiLineComment = true;
-                    commentBlock.Insert(0, lines[lookbackIndex]);
-                    
-                    // If this line also starts the comment, we're done with this block
-                    if (line.StartsWith("/*"))
-                    {
-                        inMultiLineComment = false;
-                        lookbackIndex--;
-                        continue;
-                    }
-                    
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Check for start of multi-line comment
-                if (inMultiLineComment && line.StartsWith("/*"))
-                {
-                    commentBlock.Insert(0, lines[lookbackIndex]);
-                    inMultiLineComment = false;
-                    lookbackIndex--;
-                    continue;
-                }
-                
-                // Inside multi-line comment
-                if (inMultiLineComment)
-                {
-                    commentBlock.Insert(0, lines[lookbackIndex]);
-                    lookbackIndex--;
+                if (!tokens.IsScopeOperator(i) ||
+                    tokens[i - 1].Kind != CppTokenKind.Identifier ||
+                    tokens[i + 1].Kind != CppTokenKind.Identifier)
                     continue;
-                }
-                
-                // Check for empty lines between comment blocks
-                if (string.IsNullOrWhiteSpace(line))
+
+                // Optional "[]" followed by optional "[size]"
+                int next = i + 2;
+                var arraySize = string.Empty;
+                if (next + 1 < tokens.Count && tokens.IsPunctuation(next, '[') && tokens.IsPunctuation(next + 1, ']'))
+                    next += 2;
+                if (next + 1 < tokens.Count && tokens.IsPunctuation(next, '['))
                 {
-                    // Peek ahead to see if there are more comments
-                    int peekIndex = lookbackIndex - 1;
-                    while (peekIndex >= 0 && string.IsNullOrWhiteSpace(lines[peekIndex]))
+                    if (tokens.IsPunctuation(next + 1, ']'))
                     {
-                        peekIndex--;
+                        next += 2;
                     }
-                    
-                    if (peekIndex >= 0)
+                    else if (next + 2 < tokens.Count && tokens[next + 1].Kind == CppTokenKind.Number &&
+                             tokens.GetSpan(next + 1).IndexOfAnyExceptInRange('0', '9') < 0 && tokens.IsPunctuation(next + 2, ']'))
                     {
-                        var peekLine = lines[peekIndex].Trim();
-                        if (peekLine.StartsWith("//") || peekLine.EndsWith("*/"))
-                        {
-                            // There are more comments, include the empty line
-                            commentBlock.Insert(0, lines[lookbackIndex]);
-                            lookbackIndex--;
-                            continue;
-                        }
+                        arraySize = tokens.GetText(next + 1);
+                        next += 3;
                     }
                 }
-                
-                // Not a comment line, stop collecting
-                break;
-            }
-            
-            // Add the collected comment block to results if any
-            comments.AddRange(commentBlock);
-            
-            // Capture original indentation from first comment line
-            if (comments.Any())
-            {
-                var firstComment = comments[0];
-                originalIndentation = firstComment.Length - firstComment.TrimStart().Length;
-            }
-            
-            return (comments, originalIndentation);
-        }
 
-        private List<string> CollectPrecedingComments(string[] lines, int currentIndex)
-        {
-            var (comments, _) = CollectPrecedingCommentsWithIndentation(lines, currentIndex);
-            return comments;
-        }
+                // "=" but not "=="
+                if (next + 1 >= tokens.Count || !tokens.IsPunctuation(next, '=') ||
+                    (tokens.IsPunctuation(next + 1, '=') && tokens[next + 1].Start == tokens[next].End))
+                    continue;
 
-        private (string regionStart, string regionEnd) ParseSourceRegionMarkers(string[] lines, int currentIndex, List<CppMethod> existingMethods, int currentOrderIndex)
-        {
-            string regionStart = string.Empty;
-            string regionEnd = string.Empty;
-            
-            // Look for region start before current method
-            for (int i = currentIndex - 1; i >= 0; i--)
-            {
-                var line = lines[i].Trim();
-                if (string.IsNullOrWhiteSpace(line)) continue;
-                
-                var regionMatch = _pragmaRegionRegex.Match(line);
-                if (regionMatch.Success && regionMatch.Groups[1].Value.Equals("region", StringComparison.OrdinalIgnoreCase))
-                {
-                    var description = regionMatch.Groups[2].Success ? regionMatch.Groups[2].Value.Trim() : string.Empty;
-                    regionStart = $"#region {description}".Trim();
-                    break;
-                }
-                
-                // If we hit a method implementation or non-empty, non-comment line, stop looking
-                if (_methodImplementationRegex.IsMatch(line) || (!line.StartsWith("//") && !line.StartsWith("/*") && !line.EndsWith("*/")))
-                {
-                    break;
-                }
-            }
-            
-            // Look for region end after the current method (look ahead to find the corresponding endregion)
-            if (!string.IsNullOrEmpty(regionStart))
-            {
-                // Find the end of the current method first
-                int methodEndIndex = currentIndex;
-                int braceCount = 0;
-                bool inMethodBody = false;
-                
-                for (int i = currentIndex; i < lines.Length; i++)
+                int semicolonIndex = next + 1;
+                while (semicolonIndex < tokens.Count && !tokens.IsPunctuation(semicolonIndex, ';'))
+                    semicolonIndex++;
+                if (semicolonIndex >= tokens.Count)
+                    continue;
+
+                var valueStart = tokens[next].End;
+                var initValue = content.Substring(valueStart, tokens[semicolonIndex].Start - valueStart).Trim();
+                if (initValue.Length == 0)
+                    continue;
+
+                // Optional "const" and type words directly before the class name
+                var type = "auto";
+                var isConst = false;
+                int previous = i - 2;
+                if (previous >= 0 && tokens[previous].Kind == CppTokenKind.Identifier)
                 {
-                    var line = lines[i].Trim();
-                    if (string.IsNullOrWhiteSpace(line)) continue;
-                    
-                    if (line.Contains("{"))
+                    if (tokens.IsIdentifier(previous, "const"))
                     {
-                        inMethodBody = true;
-                        braceCount += line.Count(c => c == '{');
+                        isConst = true;
                     }
-                    
-                    if (inMethodBody && line.Contains("}"))
+                    else
                     {
-                        braceCount -= line.Count(c => c == '}');
-                        if (braceCount <= 0)
-                        {
-                            methodEndIndex = i;
-                            break;
-                        }
+                        type = tokens.GetText(previous);
+                        isConst = previous > 0 && tokens.IsIdentifier(previous - 1, "const");
                     }
                 }
+
+                var className = tokens.GetText(i - 1);
+                var memberName = tokens.GetText(i + 1);
                 
-                // Now look for region end after the method
-                for (int i = methodEndIndex + 1; i < lines.Length; i++)
+                staticInits.Add(new CppStaticMemberInit
                 {
-                    var line = lines[i].Trim();
-                    if (string.IsNullOrWhiteSpace(line)) continue;
-                    
-                    var regionMatch = _pragmaRegionRegex.Match(line);
-                    if (regionMatch.Success && regionMatch.Groups[1].Value.Equals("endregion", StringComparison.OrdinalIgnoreCase))
-                    {
-                        var description = regionMatch.Groups[2].Success ? regionMatch.Groups[2].Value.Trim() : string.Empty;
-                        regionEnd = $"#endregion{(string.IsNullOrEmpty(description) ? "" : " " + description)}";
-                        break;
-                    }
-                    
-                    // If we hit another method, this current method is NOT the last one in the region
-                    // So don't assign the endregion to it
-                    if (_methodImplementationRegex.IsMatch(line))
-                    {
-                        regionEnd = string.Empty; // Clear any found endregion
-                        break;
-                    }
-                }
+                    ClassName = className,
+                    MemberName = memberName,
+                    InitializationValue = initValue,
+                    IsArray = !string.IsNullOrEmpty(arraySize) || initValue.Trim().StartsWith("{"),
+                    ArraySize = arraySize,
+                    Type = type,
+                    IsConst = isConst
+                });
+                
+                _logger.LogDebug($"Found static member initialization: {className}::{memberName} = {initValue}");
+                i = semicolonIndex;
             }
             
-            return (regionStart, regionEnd);
+            return staticInits;
         }
-        
+
         /// <summary>
         /// Parse region markers (#region/#endregion) as standalone elements with order index
         /// </summary>
-        private List<CppRegion> ParseRegionMarkers(string[] lines, string sourceFileName)
+        private List<CppRegion> ParseRegionMarkers(string[] lines, CppTokenStream tokens, string sourceFileName)
         {
             var regions = new List<CppRegion>();
-            int charPosition = 0; // Track character position in file
             
             for (int i = 0; i < lines.Length; i++)
             {
@@ -1177,7 +921,7 @@ namespace CppToCsConverter.Core.Parsers
                 
                 if (!string.IsNullOrWhiteSpace(trimmedLine))
                 {
-                    var regionMatch = _pragmaRegionRegex.Match(trimmedLine);
+                    var regionMatch = CppPatterns.SourceRegionMarker().Match(trimmedLine);
                     if (regionMatch.Success)
                     {
                         var regionType = regionMatch.Groups[1].Value.ToLower();
@@ -1189,7 +933,7 @@ namespace CppToCsConverter.Core.Parsers
                             Text = regionType == "region" 
                                 ? $"#region {description}".Trim()
                                 : $"#endregion{(string.IsNullOrEmpty(description) ? "" : " " + description)}",
-                            OrderIndex = charPosition + line.IndexOf('#'), // Character position in file
+                            OrderIndex = tokens.GetLineStart(i) + line.IndexOf('#'), // Character position in file
                             SourceFileName = sourceFileName,
                             IsFromHeader = false
                         };
@@ -1197,73 +941,11 @@ namespace CppToCsConverter.Core.Parsers
                         regions.Add(region);
                     }
                 }
-                
-                // Add line length + newline characters for next iteration
-                charPosition += line.Length + Environment.NewLine.Length;
             }
             
             return regions;
         }
         
-        /// <summary>
-        /// Normalizes the indentation of a method body by finding the minimum indentation
-        /// of all non-empty lines and removing that amount from all lines.
-        /// This ensures consistent relative indentation regardless of the original context.
-        /// </summary>
-        /// <param name="methodBody">The raw method body content</param>
-        /// <returns>The method body with normalized indentation</returns>
-        private string NormalizeIndentation(string methodBody)
-        {
-            if (string.IsNullOrWhiteSpace(methodBody))
-                return string.Empty;
-                
-            var lines = methodBody.Split(new[] { "\r\n", "\n", "\r" }, StringSplitOptions.None);
-            
-            // Find the minimum indentation among all non-empty lines
-            int minIndentation = int.MaxValue;
-            foreach (var line in lines)
-            {
-                if (!string.IsNullOrWhiteSpace(line))
-                {
-                    int leadingSpaces = 0;
-                    foreach (char c in line)
-                    {
-                        if (c == ' ')
-                            leadingSpaces++;
-                        else
-                            break;
-                    }
-                    minIndentation = Math.Min(minIndentation, leadingSpaces);
-                }
-            }
-            
-            // If no non-empty lines found, return empty
-            if (minIndentation == int.MaxValue)
-                return string.Empty;
-                
-            // Remove the minimum indentation from all lines
-            var normalizedLines = new List<string>();
-            foreach (var line in lines)
-            {
-                if (string.IsNullOrWhiteSpace(line))
-                {
-                    // Keep empty lines as empty
-                    normalizedLines.Add(string.Empty);
-                }
-                else
-                {
-                    // Remove the minimum indentation
-                    var normalizedLine = line.Length > minIndentation 
-                        ? line.Substring(minIndentation) 
-                        : line.TrimStart();
-                    normalizedLines.Add(normalizedLine);
-                }
-            }
-            
-            // Join lines and trim trailing whitespace
-            return string.Join("\n", normalizedLines).Trim();
-        }
-
         private List<string> ParseFileTopComments(string[] lines)
         {
             var fileTopComments = new List<string>();
@@ -1332,144 +1014,6 @@ namespace CppToCsConverter.Core.Parsers
             return fileTopComments;
         }
         
-        /// <summary>
-        /// Extracts positioned comments from parameter text while preserving the clean parameter declaration
-        /// </summary>
-        private (string cleanText, List<ParameterComment> positionedComments) ExtractPositionedCommentsFromParameter(string parameterText)
-        {
-            var positionedComments = new List<ParameterComment>();
-            var cleanText = new StringBuilder();
-            var i = 0;
-            
-            // Track if we've seen the parameter name to determine prefix vs suffix
-            // We'll consider comments prefix until we see both type and name parts
-            var hasSeenParameterName = false;
-            var cleanContentSoFar = new StringBuilder();
-            
-            while (i < parameterText.Length)
-            {
-                // Check for single-line comment
-                if (i < parameterText.Length - 1 && parameterText[i] == '/' && parameterText[i + 1] == '/')
-                {
-                    var commentStart = i;
-                    // Find end of line or end of string
-                    while (i < parameterText.Length && parameterText[i] != '\n')
-                        i++;
-                    
-                    var comment = parameterText.Substring(commentStart, i - commentStart).Trim();
-                    var position = hasSeenParameterName ? CommentPosition.Suffix : CommentPosition.Prefix;
-                    positionedComments.Add(new ParameterComment { CommentText = comment, Position = position });
-                    
-                    // Add newline if present
-                    if (i < parameterText.Length && parameterText[i] == '\n')
-                    {
-                        cleanText.Append('\n');
-                        i++;
-                    }
-                }
-                // Check for multi-line comment
-                else if (i < parameterText.Length - 1 && parameterText[i] == '/' && parameterText[i + 1] == '*')
-                {
-                    var commentStart = i;
-                    i += 2; // Skip /*
-                    
-                    // Find end of comment
-                    while (i < parameterText.Length - 1)
-                    {
-                        if (parameterText[i] == '*' && parameterText[i + 1] == '/')
-                        {
-                            i += 2; // Skip */
-                            break;
-                        }
-                        i++;
-                    }
-                    
-                    var comment = parameterText.Substring(commentStart, i - commentStart).Trim();
-                    var position = hasSeenParameterName ? CommentPosition.Suffix : CommentPosition.Prefix;
-                    positionedComments.Add(new ParameterComment { CommentText = comment, Position = position });
-                }
-                else
-                {
-                    var ch = parameterText[i];
-                    cleanText.Append(ch);
-                    
-                    // Add to clean content for parameter name detection (include spaces for proper word detection)
-                    cleanContentSoFar.Append(ch);
-                    
-                    // Try to detect if we've seen a parameter name
-                    // A parameter typically has format: [const] Type[*|&] paramName
-                    // We'll check if we have at least one word that could be a type and another that could be a name
-                    if (!hasSeenParameterName)
-                    {
-                        var cleanSoFar = cleanContentSoFar.ToString().Trim();
-                        // Simple heuristic: if we have multiple words and the current clean content ends with identifier characters
-                        if (cleanSoFar.Contains(' ') || cleanSoFar.Contains('&') || cleanSoFar.Contains('*'))
-                        {
-                            var words = cleanSoFar.Split(new[] { ' ', '*', '&', '<', '>', ':', ',' }, StringSplitOptions.RemoveEmptyEntries);
-                            if (words.Length >= 2) // We have type and possibly name
-                            {
-                                hasSeenParameterName = true;
-                            }
-                        }
-                    }
-                    
-                    i++;
-                }
-            }
-            
-            // Remove trailing comma from clean text (comma is parameter separator, not part of declaration)
-            var finalCleanText = cleanText.ToString().TrimEnd();
-            if (finalCleanText.EndsWith(','))
-            {
-                finalCleanText = finalCleanText.Substring(0, finalCleanText.Length - 1).TrimEnd();
-            }
-            
-            return (finalCleanText, positionedComments);
-        }
-
-        /// <summary>
-        /// Extracts inline comments from parameter text while preserving the clean parameter declaration (legacy method)
-        /// </summary>
-        private (string cleanText, List<string> comments) ExtractInlineCommentsFromParameter(string parameterText)
-        {
-            var (cleanText, positionedComments) = ExtractPositionedCommentsFromParameter(parameterText);
-            var comments = positionedComments.Select(pc => pc.CommentText).ToList();
-            return (cleanText, comments);
-        }
-        
-        /// <summary>
-        /// Checks if two parameter lists are equal by comparing normalized types
-        /// </summary>
-        private bool ParametersEqual(List<CppParameter> params1, List<CppParameter> params2)
-        {
-            if (params1.Count != params2.Count)
-                return false;
-                
-            for (int i = 0; i < params1.Count; i++)
-            {
-                var type1 = NormalizeParameterType(params1[i].Type);
-                var type2 = NormalizeParameterType(params2[i].Type);
-                
-                if (type1 != type2)
-                    return false;
-            }
-            
-            return true;
-        }
-        
-        /// <summary>
-        /// Normalizes parameter type for comparison (removes const, &, *, spaces)
-        /// </summary>
-        private string NormalizeParameterType(string type)
-        {
-            return type.Trim()
-                .Replace(" ", "")
-                .Replace("const", "")
-                .Replace("&", "")
-                .Replace("*", "")
-                .ToLowerInvariant();
-        }
-        
         /// <summary>
         /// Moves methods that belong to structs from the methods list to the struct's Methods collection
         /// </summary>
@@ -1495,10 +1039,10 @@ namespace CppToCsConverter.Core.Parsers
                         method.ReturnType = string.Empty; // Constructors have no return type // Associate with the struct
                         
                         // Set inline implementation so the body gets generated
-                        if (!string.IsNullOrEmpty(method.ImplementationBody))
+                        if (!method.ImplementationBodyText.IsEmpty)
                         {
                             method.HasInlineImplementation = true;
-                            method.InlineImplementation = method.ImplementationBody;
+                            method.InlineImplementationText = method.ImplementationBodyText;
                         }
                         
                         // Add to struct's methods collection
@@ -0,0 +1,48 @@
+using System;
+using System.Collections.Concurrent;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// Reads the input files of one conversion run so that each file is read from disk once,
+    /// whether it is hashed, parsed or both. Inputs that are not on disk are added up front.
+    /// Safe to use from parallel parse tasks.
+    /// </summary>
+    internal class FileContentStore
+    {
+        private readonly ConcurrentDictionary<string, SourceFileContent> _contents = new ConcurrentDictionary<string, SourceFileContent>(StringComparer.Ordinal);
+
+        /// <summary>
+        /// Adds the content of an input that is not read from disk, replacing any content for the same path
+        /// </summary>
+        public void Add(SourceFileContent content)
+        {
+            _contents[content.FilePath] = content;
+        }
+
+        /// <summary>
+        /// Returns the content of a file and keeps it for a later <see cref="Take"/>
+        /// </summary>
+        public SourceFileContent Get(string filePath)
+        {
+            return _contents.GetOrAdd(filePath, SourceFileContent.Read);
+        }
+
+        /// <summary>
+        /// Returns the content of a file for parsing and releases it from the store,
+        /// reading the file if it has not been read yet
+        /// </summary>
+        public SourceFileContent Take(string filePath)
+        {
+            return _contents.TryRemove(filePath, out var content) ? content : SourceFileContent.Read(filePath);
+        }
+
+        /// <summary>
+        /// Drops the content of a file that turned out not to need parsing
+        /// </summary>
+        public void Release(string filePath)
+        {
+            _contents.TryRemove(filePath, out _);
+        }
+    }
+}
@@ -0,0 +1,347 @@
+namespace CppToCsConverter.Core.Parsers.Lexing;
+
+/// <summary>
+/// Single-pass C++ tokenizer shared by the header and source parsers.
+/// Recognizes comments, string/char literals (including raw strings), preprocessor directives and braces,
+/// so structure found from the token stream is never confused by braces or "::" inside comments or strings.
+/// Runs in time linear in the length of the input.
+/// </summary>
+public class CppLexer : ICppLexer
+{
+    public CppTokenStream Tokenize(string text)
+    {
+        var tokens = new List<CppToken>(text.Length / 6 + 16);
+        var lineStarts = new List<int>(text.Length / 32 + 16) { 0 };
+        var scanner = new Scanner(text, lineStarts);
+        int depth = 0;
+
+        while (scanner.Next(out var kind, out var start, out var length, out var line))
+        {
+            int tokenDepth = depth;
+            if (kind == CppTokenKind.Punctuation && length == 1)
+            {
+                if (text[start] == '{')
+                {
+                    depth++;
+                }
+                else if (text[start] == '}' && depth > 0)
+                {
+                    depth--;
+                    tokenDepth = depth;
+                }
+            }
+            tokens.Add(new CppToken(kind, start, length, line, tokenDepth));
+        }
+
+        return new CppTokenStream(text, tokens.ToArray(), lineStarts.ToArray());
+    }
+
+    /// <summary>
+    /// Counts the braces on a single line that are code, ignoring braces inside comments and literals.
+    /// The line is tokenized on its own, so a block comment opened on an earlier line is not known here.
+    /// </summary>
+    public static (int Open, int Close) CountCodeBraces(string line)
+    {
+        int open = 0;
+        int close = 0;
+        if (line.IndexOf('{') < 0 && line.IndexOf('}') < 0)
+            return (0, 0);
+
+        var scanner = new Scanner(line, null);
+        while (scanner.Next(out var kind, out var start, out var length, out _))
+        {
+            if (kind == CppTokenKind.Punctuation && length == 1)
+            {
+                if (line[start] == '{') open++;
+                else if (line[start] == '}') close++;
+            }
+        }
+        return (open, close);
+    }
+
+    private struct Scanner
+    {
+        private readonly string _text;
+        private readonly List<int>? _lineStarts;
+        private int _position;
+        private int _line;
+        private bool _atLineStart;
+
+        public Scanner(string text, List<int>? lineStarts)
+        {
+            _text = text;
+            _lineStarts = lineStarts;
+            _position = 0;
+            _line = 0;
+            _atLineStart = true;
+        }
+
+        public bool Next(out CppTokenKind kind, out int start, out int length, out int line)
+        {
+            var text = _text;
+
+            // Skip whitespace and line breaks
+            while (_position < text.Length)
+            {
+                char c = text[_position];
+                if (c == '\r' || c == '\n')
+                {
+                    ConsumeLineBreak();
+                }
+                else if (c == ' ' || c == '\t' || c == '\f' || c == '\v')
+                {
+                    _position++;
+                }
+                else if (c == '\\' && IsLineBreakAt(_position + 1))
+                {
+                    // Line continuation outside of a directive
+                    _position++;
+                    ConsumeLineBreak();
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            start = _position;
+            line = _line;
+            if (_position >= text.Length)
+            {
+                kind = default;
+                length = 0;
+                return false;
+            }
+
+            bool atLineStart = _atLineStart;
+            _atLineStart = false;
+            char ch = text[_position];
+            char next = _position + 1 < text.Length ? text[_position + 1] : '\0';
+
+            if (ch == '/' && next == '/')
+            {
+                kind = CppTokenKind.LineComment;
+                ScanToEndOfLine(allowContinuation: true);
+            }
+            else if (ch == '/' && next == '*')
+            {
+                kind = CppTokenKind.BlockComment;
+                ScanBlockComment();
+            }
+            else if (ch == '#' && atLineStart)
+            {
+                kind = CppTokenKind.Preprocessor;
+                ScanToEndOfLine(allowContinuation: true);
+            }
+            else if (ch == '"')
+            {
+                kind = CppTokenKind.StringLiteral;
+                ScanQuoted('"');
+            }
+            else if (ch == '\'')
+            {
+                kind = CppTokenKind.CharLiteral;
+                ScanQuoted('\'');
+            }
+            else if (char.IsDigit(ch) || (ch == '.' && char.IsDigit(next)))
+            {
+                kind = CppTokenKind.Number;
+                ScanNumber();
+            }
+            else if (IsIdentifierStart(ch))
+            {
+                kind = ScanIdentifierOrPrefixedLiteral();
+            }
+            else
+            {
+                kind = CppTokenKind.Punctuation;
+                _position += ch == ':' && next == ':' ? 2 : 1;
+            }
+
+            length = _position - start;
+            return true;
+        }
+
+        private bool IsLineBreakAt(int index)
+        {
+            return index < _text.Length && (_text[index] == '\r' || _text[index] == '\n');
+        }
+
+        private void ConsumeLineBreak()
+        {
+            if (_text[_position] == '\r' && _position + 1 < _text.Length && _text[_position + 1] == '\n')
+                _position += 2;
+            else
+                _position++;
+
+            _line++;
+            _lineStarts?.Add(_position);
+            _atLineStart = true;
+        }
+
+        private void ScanToEndOfLine(bool allowContinuation)
+        {
+            while (_position < _text.Length)
+            {
+                char c = _text[_position];
+                if (c == '\r' || c == '\n')
+                    return;
+
+                if (allowContinuation && c == '\\' && IsLineBreakAt(_position + 1))
+                {
+                    _position++;
+                    ConsumeLineBreak();
+                    _atLineStart = false;
+                    continue;
+                }
+                _position++;
+            }
+        }
+
+        private void ScanBlockComment()
+        {
+            _position += 2;
+            while (_position < _text.Length)
+            {
+                char c = _text[_position];
+                if (c == '*' && _position + 1 < _text.Length && _text[_position + 1] == '/')
+                {
+                    _position += 2;
+                    return;
+                }
+                if (c == '\r' || c == '\n')
+                {
+                    ConsumeLineBreak();
+                    _atLineStart = false;
+                }
+                else
+                {
+                    _position++;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Scans a string or char literal. An unterminated literal ends at the line break.
+        /// </summary>
+        private void ScanQuoted(char quote)
+        {
+            _position++;
+            while (_position < _text.Length)
+            {
+                char c = _text[_position];
+                if (c == quote)
+                {
+                    _position++;
+                    return;
+                }
+                if (c == '\r' || c == '\n')
+                    return;
+
+                if (c == '\\' && _position + 1 < _text.Length)
+                {
+                    if (IsLineBreakAt(_position + 1))
+                    {
+                        _position++;
+                        ConsumeLineBreak();
+                        _atLineStart = false;
+                        continue;
+                    }
+                    _position += 2;
+                    continue;
+                }
+                _position++;
+            }
+        }
+
+        private void ScanRawString()
+        {
+            // R"delimiter( ... )delimiter"
+            int delimiterStart = ++_position;
+            while (_position < _text.Length && _text[_position] != '(' && _text[_position] != '\r' && _text[_position] != '\n')
+                _position++;
+
+            if (_position >= _text.Length || _text[_position] != '(')
+                return; // Not a valid raw string; the remainder is scanned as ordinary tokens
+
+            var terminator = ")" + _text.Substring(delimiterStart, _position - delimiterStart) + "\"";
+            _position++;
+            while (_position < _text.Length)
+            {
+                if (string.CompareOrdinal(_text, _position, terminator, 0, terminator.Length) == 0)
+                {
+                    _position += terminator.Length;
+                    return;
+                }
+                if (_text[_position] == '\r' || _text[_position] == '\n')
+                {
+                    ConsumeLineBreak();
+                    _atLineStart = false;
+                }
+                else
+                {
+                    _position++;
+                }
+            }
+        }
+
+        private void ScanNumber()
+        {
+            while (_position < _text.Length)
+            {
+                char c = _text[_position];
+                if (char.IsLetterOrDigit(c) || c == '_' || c == '.')
+                {
+                    _position++;
+                }
+                else if (c == '\'' && _position + 1 < _text.Length && char.IsLetterOrDigit(_text[_position + 1]))
+                {
+                    _position++; // Digit separator
+                }
+                else if ((c == '+' || c == '-') && "eEpP".IndexOf(_text[_position - 1]) >= 0)
+                {
+                    _position++; // Exponent sign
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+
+        private CppTokenKind ScanIdentifierOrPrefixedLiteral()
+        {
+            int start = _position;
+            _position++;
+            while (_position < _text.Length && IsIdentifierPart(_text[_position]))
+                _position++;
+
+            if (_position < _text.Length && (_text[_position] == '"' || _text[_position] == '\''))
+            {
+                var prefix = _text.AsSpan(start, _position - start);
+                bool isRaw = prefix.Length > 0 && prefix[prefix.Length - 1] == 'R';
+                var encoding = isRaw ? prefix.Slice(0, prefix.Length - 1) : prefix;
+                bool isEncodingPrefix = encoding.Length == 0 || encoding.SequenceEqual("L") || encoding.SequenceEqual("u") ||
+                                        encoding.SequenceEqual("U") || encoding.SequenceEqual("u8");
+
+                if (isEncodingPrefix && isRaw && _text[_position] == '"')
+                {
+                    ScanRawString();
+                    return CppTokenKind.StringLiteral;
+                }
+                if (isEncodingPrefix && !isRaw)
+                {
+                    char quote = _text[_position];
+                    ScanQuoted(quote);
+                    return quote == '"' ? CppTokenKind.StringLiteral : CppTokenKind.CharLiteral;
+                }
+            }
+
+            return CppTokenKind.Identifier;
+        }
+
+        private static bool IsIdentifierStart(char c) => c == '_' || c == '$' || char.IsLetter(c);
+
+        private static bool IsIdentifierPart(char c) => c == '_' || c == '$' || char.IsLetterOrDigit(c);
+    }
+}
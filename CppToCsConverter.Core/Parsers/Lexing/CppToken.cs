@@ -0,0 +1,36 @@
+namespace CppToCsConverter.Core.Parsers.Lexing;
+
+/// <summary>
+/// A token in a C++ file. Tokens only hold positions; the text lives in the owning <see cref="CppTokenStream"/>.
+/// </summary>
+public readonly struct CppToken
+{
+    public CppToken(CppTokenKind kind, int start, int length, int line, int depth)
+    {
+        Kind = kind;
+        Start = start;
+        Length = length;
+        Line = line;
+        Depth = depth;
+    }
+
+    public CppTokenKind Kind { get; }
+
+    /// <summary>Character offset of the first character of the token</summary>
+    public int Start { get; }
+
+    public int Length { get; }
+
+    /// <summary>Zero-based line of the first character of the token</summary>
+    public int Line { get; }
+
+    /// <summary>
+    /// Brace nesting depth the token is at. An opening brace and its matching closing brace have the same depth
+    /// (the depth outside of the block).
+    /// </summary>
+    public int Depth { get; }
+
+    public int End => Start + Length;
+
+    public bool IsComment => Kind == CppTokenKind.LineComment || Kind == CppTokenKind.BlockComment;
+}
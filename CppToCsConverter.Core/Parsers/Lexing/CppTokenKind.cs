@@ -0,0 +1,17 @@
+namespace CppToCsConverter.Core.Parsers.Lexing;
+
+/// <summary>
+/// Kinds of tokens produced by <see cref="CppLexer"/>.
+/// Whitespace and line breaks are not emitted as tokens; line information is kept on each token instead.
+/// </summary>
+public enum CppTokenKind
+{
+    Identifier,
+    Number,
+    StringLiteral,   // "..." including encoding prefixes and raw strings R"x(...)x"
+    CharLiteral,     // '...'
+    LineComment,     // // ... up to (not including) the line break
+    BlockComment,    // /* ... */
+    Preprocessor,    // # directive up to the end of the (continued) line
+    Punctuation      // single character, except "::" which is one token
+}
@@ -0,0 +1,185 @@
+namespace CppToCsConverter.Core.Parsers.Lexing;
+
+using CppToCsConverter.Core.Utils;
+
+/// <summary>
+/// The tokens of one C++ file together with the file text, the line-offset table and brace and parenthesis matching.
+/// Built once per file by <see cref="CppLexer"/>; all lookups are O(1) or O(log n).
+/// </summary>
+public class CppTokenStream
+{
+    private readonly CppToken[] _tokens;
+    private readonly int[] _lineStarts;
+    private readonly int[] _matchingBrace;
+    private readonly int[] _matchingParenthesis;
+    private readonly int[] _nextCloseParenthesis;
+    private readonly int[] _nextStatementBoundary;
+    private readonly int[] _lineOpenBraces;
+    private readonly int[] _lineCloseBraces;
+
+    public CppTokenStream(string text, CppToken[] tokens, int[] lineStarts)
+    {
+        Text = text;
+        _tokens = tokens;
+        _lineStarts = lineStarts;
+        _matchingBrace = new int[tokens.Length];
+        _matchingParenthesis = new int[tokens.Length];
+        _nextCloseParenthesis = new int[tokens.Length];
+        _nextStatementBoundary = new int[tokens.Length];
+        _lineOpenBraces = new int[lineStarts.Length];
+        _lineCloseBraces = new int[lineStarts.Length];
+
+        var openBraces = new Stack<int>();
+        var openParentheses = new Stack<int>();
+        for (int i = 0; i < tokens.Length; i++)
+        {
+            _matchingBrace[i] = -1;
+            _matchingParenthesis[i] = -1;
+            if (IsPunctuation(i, '('))
+            {
+                openParentheses.Push(i);
+            }
+            else if (IsPunctuation(i, ')'))
+            {
+                if (openParentheses.Count > 0)
+                {
+                    var open = openParentheses.Pop();
+                    _matchingParenthesis[open] = i;
+                    _matchingParenthesis[i] = open;
+                }
+            }
+            else if (IsPunctuation(i, '{'))
+            {
+                openBraces.Push(i);
+                _lineOpenBraces[tokens[i].Line]++;
+            }
+            else if (IsPunctuation(i, '}'))
+            {
+                _lineCloseBraces[tokens[i].Line]++;
+                if (openBraces.Count > 0)
+                {
+                    var open = openBraces.Pop();
+                    _matchingBrace[open] = i;
+                    _matchingBrace[i] = open;
+                }
+            }
+        }
+
+        // Forward lookups, filled from the end so each is a single pass
+        int nextCloseParenthesis = tokens.Length;
+        int nextStatementBoundary = tokens.Length;
+        for (int i = tokens.Length - 1; i >= 0; i--)
+        {
+            if (IsPunctuation(i, ')'))
+                nextCloseParenthesis = i;
+            else if (IsPunctuation(i, ';') || IsPunctuation(i, '{') || IsPunctuation(i, '}'))
+                nextStatementBoundary = i;
+            _nextCloseParenthesis[i] = nextCloseParenthesis;
+            _nextStatementBoundary[i] = nextStatementBoundary;
+        }
+    }
+
+    public string Text { get; }
+
+    public int Count => _tokens.Length;
+
+    public ref readonly CppToken this[int index] => ref _tokens[index];
+
+    /// <summary>
+    /// Number of lines, counting "\r\n", "\r" and "\n" as line breaks (same as splitting the text on them)
+    /// </summary>
+    public int LineCount => _lineStarts.Length;
+
+    public int GetLineStart(int line) => _lineStarts[line];
+
+    /// <summary>
+    /// Returns the zero-based line containing the character position
+    /// </summary>
+    public int GetLineIndex(int position)
+    {
+        int index = Array.BinarySearch(_lineStarts, position);
+        return index >= 0 ? index : ~index - 1;
+    }
+
+    /// <summary>
+    /// Returns the index of the first token ending after the position (the token containing it, or the next one).
+    /// Returns <see cref="Count"/> if there is none.
+    /// </summary>
+    public int FindTokenIndex(int position)
+    {
+        int low = 0;
+        int high = _tokens.Length - 1;
+        while (low <= high)
+        {
+            int mid = low + ((high - low) >> 1);
+            if (_tokens[mid].End <= position)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+        return low;
+    }
+
+    /// <summary>
+    /// Returns the index of the brace token matching the brace at tokenIndex, or -1 if it is unbalanced or not a brace
+    /// </summary>
+    public int GetMatchingBrace(int tokenIndex) => _matchingBrace[tokenIndex];
+
+    /// <summary>
+    /// Returns the index of the parenthesis token matching the one at tokenIndex, or -1 if it is unbalanced or not a parenthesis
+    /// </summary>
+    public int GetMatchingParenthesis(int tokenIndex) => _matchingParenthesis[tokenIndex];
+
+    /// <summary>
+    /// Returns the index of the first ")" at or after tokenIndex, or <see cref="Count"/> if there is none
+    /// </summary>
+    public int FindNextCloseParenthesis(int tokenIndex) => _nextCloseParenthesis[tokenIndex];
+
+    /// <summary>
+    /// Returns the index of the first ";", "{" or "}" at or after tokenIndex, or <see cref="Count"/> if there is none
+    /// </summary>
+    public int FindNextStatementBoundary(int tokenIndex) => _nextStatementBoundary[tokenIndex];
+
+    /// <summary>
+    /// Number of code (not commented or quoted) opening and closing braces on a line
+    /// </summary>
+    public (int Open, int Close) GetLineBraceCounts(int line) => (_lineOpenBraces[line], _lineCloseBraces[line]);
+
+    public bool IsPunctuation(int tokenIndex, char value)
+    {
+        ref readonly var token = ref _tokens[tokenIndex];
+        return token.Kind == CppTokenKind.Punctuation && token.Length == 1 && Text[token.Start] == value;
+    }
+
+    public bool IsScopeOperator(int tokenIndex)
+    {
+        ref readonly var token = ref _tokens[tokenIndex];
+        return token.Kind == CppTokenKind.Punctuation && token.Length == 2;
+    }
+
+    public bool IsIdentifier(int tokenIndex, string value)
+    {
+        ref readonly var token = ref _tokens[tokenIndex];
+        return token.Kind == CppTokenKind.Identifier && GetSpan(tokenIndex).SequenceEqual(value);
+    }
+
+    public ReadOnlySpan<char> GetSpan(int tokenIndex)
+    {
+        ref readonly var token = ref _tokens[tokenIndex];
+        return Text.AsSpan(token.Start, token.Length);
+    }
+
+    public string GetText(int tokenIndex)
+    {
+        ref readonly var token = ref _tokens[tokenIndex];
+        return Text.Substring(token.Start, token.Length);
+    }
+
+    /// <summary>
+    /// Returns the text of a token from the <see cref="StringPool"/>, for names that recur across files
+    /// </summary>
+    public string GetPooledText(int tokenIndex)
+    {
+        return StringPool.Intern(GetSpan(tokenIndex));
+    }
+}
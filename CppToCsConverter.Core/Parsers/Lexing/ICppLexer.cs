@@ -0,0 +1,14 @@
+namespace CppToCsConverter.Core.Parsers.Lexing;
+
+/// <summary>
+/// Interface for tokenizing C++ source text in a single linear pass.
+/// </summary>
+public interface ICppLexer
+{
+    /// <summary>
+    /// Tokenizes the complete text of a C++ file.
+    /// </summary>
+    /// <param name="text">The file content</param>
+    /// <returns>The token stream with line and brace matching information</returns>
+    CppTokenStream Tokenize(string text);
+}
@@ -1,15 +1,32 @@
 namespace CppToCsConverter.Core.Parsers.ParameterParsing;
 
+using System.Collections.Concurrent;
 using CppToCsConverter.Core.Models;
 
 /// <summary>
 /// Main entry point for parsing C++ parameter lists.
 /// Orchestrates the block splitting and component extraction phases.
+/// Results are cached by parameter list text, since the same signature appears in the .h and the .cpp
+/// and identical parameter lists recur across classes; every call returns new parameter objects.
+/// Safe for concurrent use.
 /// </summary>
 public class CppParameterParser
 {
-    private readonly IParameterBlockSplitter _blockSplitter;
-    private readonly IParameterComponentExtractor _componentExtractor;
+    // Bounds the cache of a long-running converter; a full cache is cleared and filled again
+    private const int MaxCachedParameterLists = 16 * 1024;
+
+    private readonly IParameterBlockSplitter? _blockSplitter;
+    private readonly IParameterComponentExtractor? _componentExtractor;
+    private readonly ConcurrentDictionary<string, List<CppParameter>> _cache = new ConcurrentDictionary<string, List<CppParameter>>(StringComparer.Ordinal);
+    private int _cachedCount;
+
+    /// <summary>
+    /// Creates a parser that splits and extracts with <see cref="ParameterBlockSplitter"/> and
+    /// <see cref="ParameterComponentExtractor"/> directly on the parameter list text, without intermediate blocks
+    /// </summary>
+    public CppParameterParser()
+    {
+    }
 
     public CppParameterParser(
         IParameterBlockSplitter blockSplitter,
@@ -29,17 +46,83 @@ public class CppParameterParser
         if (string.IsNullOrWhiteSpace(parameterListText))
             return new List<CppParameter>();
 
+        if (_cache.TryGetValue(parameterListText, out var cached))
+            return Copy(cached);
+
+        var parameters = _blockSplitter == null || _componentExtractor == null
+            ? ParseInPlace(parameterListText)
+            : ParseBlocks(parameterListText, _blockSplitter, _componentExtractor);
+
+        // The cache keeps its own copies, so callers may modify what they get
+        if (Interlocked.Increment(ref _cachedCount) > MaxCachedParameterLists)
+        {
+            _cache.Clear();
+            Interlocked.Exchange(ref _cachedCount, 1);
+        }
+        if (!_cache.TryAdd(parameterListText, Copy(parameters)))
+        {
+            Interlocked.Decrement(ref _cachedCount);
+        }
+
+        return parameters;
+    }
+
+    private static List<CppParameter> ParseInPlace(string parameterListText)
+    {
+        var parameters = new List<CppParameter>();
+        var reader = new ParameterBlockReader(parameterListText);
+        while (reader.TryReadNext(out var block))
+        {
+            parameters.Add(ParameterComponentExtractor.ExtractComponents(parameterListText, block));
+        }
+
+        return parameters;
+    }
+
+    private static List<CppParameter> ParseBlocks(string parameterListText, IParameterBlockSplitter blockSplitter, IParameterComponentExtractor componentExtractor)
+    {
         // Phase 1: Split into blocks
-        var blocks = _blockSplitter.SplitIntoBlocks(parameterListText);
+        var blocks = blockSplitter.SplitIntoBlocks(parameterListText);
 
         // Phase 2: Extract components from each block
-        var parameters = new List<CppParameter>();
+        var parameters = new List<CppParameter>(blocks.Count);
         foreach (var block in blocks)
         {
-            var parameter = _componentExtractor.ExtractComponents(block);
-            parameters.Add(parameter);
+            parameters.Add(componentExtractor.ExtractComponents(block));
         }
 
         return parameters;
     }
+
+    private static List<CppParameter> Copy(IReadOnlyCollection<CppParameter> parameters)
+    {
+        var copies = new List<CppParameter>(parameters.Count);
+        foreach (var parameter in parameters)
+        {
+            var copy = new CppParameter
+            {
+                Type = parameter.Type,
+                Name = parameter.Name,
+                DefaultValue = parameter.DefaultValue,
+                IsReference = parameter.IsReference,
+                IsPointer = parameter.IsPointer,
+                IsConst = parameter.IsConst,
+                OriginalText = parameter.OriginalText,
+                HasLineBreak = parameter.HasLineBreak,
+                OriginalIndent = parameter.OriginalIndent,
+                CanonicalSignature = parameter.CanonicalSignature
+            };
+            if (parameter.InlineCommentsOrEmpty.Count > 0)
+            {
+                copy.InlineComments.AddRange(parameter.InlineCommentsOrEmpty);
+            }
+            foreach (var comment in parameter.PositionedCommentsOrEmpty)
+            {
+                copy.PositionedComments.Add(new ParameterComment { CommentText = comment.CommentText, Position = comment.Position });
+            }
+            copies.Add(copy);
+        }
+
+        return copies;
+    }
 }
@@ -1,5 +1,3 @@
-using System.Text;
-
 namespace CppToCsConverter.Core.Parsers.ParameterParsing;
 
 /// <summary>
@@ -14,39 +12,120 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             return new List<ParameterBlock>();
 
         var blocks = new List<ParameterBlock>();
-        var currentBlock = new StringBuilder();
-        var blockIndex = 0;
-        
+        var reader = new ParameterBlockReader(parameterListText);
+        while (reader.TryReadNext(out var block))
+        {
+            blocks.Add(new ParameterBlock(
+                string.Concat(block.Head(parameterListText), block.Tail(parameterListText)),
+                block.Index,
+                block.StartsOnNewLine,
+                block.LeadingIndent));
+        }
+
+        return blocks;
+    }
+}
+
+/// <summary>
+/// Position of a parameter block in the parameter list text. A block is a contiguous range of the text,
+/// except that the separating comma is left out when a trailing comment after it belongs to the block.
+/// </summary>
+internal readonly struct ParameterBlockRange
+{
+    public ParameterBlockRange(int start, int end, int separatorIndex, int index, bool startsOnNewLine, int leadingIndent)
+    {
+        Start = start;
+        End = end;
+        SeparatorIndex = separatorIndex;
+        Index = index;
+        StartsOnNewLine = startsOnNewLine;
+        LeadingIndent = leadingIndent;
+    }
+
+    public int Start { get; }
+    public int End { get; }
+    public int SeparatorIndex { get; } // Index of the comma inside the range, or -1
+    public int Index { get; }
+    public bool StartsOnNewLine { get; }
+    public int LeadingIndent { get; }
+
+    /// <summary>
+    /// The block text up to the separating comma, or all of it
+    /// </summary>
+    public ReadOnlySpan<char> Head(ReadOnlySpan<char> text) =>
+        text[Start..(SeparatorIndex < 0 ? End : SeparatorIndex)];
+
+    /// <summary>
+    /// The trailing comment taken over from after the separating comma, or empty
+    /// </summary>
+    public ReadOnlySpan<char> Tail(ReadOnlySpan<char> text) =>
+        SeparatorIndex < 0 ? ReadOnlySpan<char>.Empty : text[(SeparatorIndex + 1)..End];
+}
+
+/// <summary>
+/// Reads the parameter blocks of a parameter list one at a time without copying the text.
+/// Whitespace-only blocks are skipped.
+/// </summary>
+internal ref struct ParameterBlockReader
+{
+    private readonly ReadOnlySpan<char> _text;
+    private int _position;
+    private int _blockIndex;
+    private bool _nextBlockStartsOnNewLine;
+
+    public ParameterBlockReader(ReadOnlySpan<char> parameterListText)
+    {
+        _text = parameterListText;
+        _position = 0;
+        _blockIndex = 0;
+        _nextBlockStartsOnNewLine = false;
+    }
+
+    public bool TryReadNext(out ParameterBlockRange block)
+    {
+        while (_position < _text.Length)
+        {
+            if (ReadBlock(out block))
+                return true;
+        }
+
+        block = default;
+        return false;
+    }
+
+    /// <summary>
+    /// Reads the block at the current position; returns false if it is whitespace only
+    /// </summary>
+    private bool ReadBlock(out ParameterBlockRange block)
+    {
+        var text = _text;
+        var blockStart = _position;
+
         var inCStyleComment = false;
         var inCppStyleComment = false;
         var parenthesesDepth = 0;
         var angleBracketDepth = 0;
         var inString = false;
         var escapeNext = false;
-        
-        var currentLineStart = 0; // Track where current line starts
-        var blockStartsOnNewLine = false;
+
+        var blockStartsOnNewLine = _nextBlockStartsOnNewLine;
         var blockLeadingIndent = 0;
         var seenNonWhitespaceInBlock = false;
 
-        for (var i = 0; i < parameterListText.Length; i++)
+        for (var i = _position; i < text.Length; i++)
         {
-            var ch = parameterListText[i];
-            var nextCh = i + 1 < parameterListText.Length ? parameterListText[i + 1] : '\0';
+            var ch = text[i];
+            var nextCh = i + 1 < text.Length ? text[i + 1] : '\0';
 
             // Track newlines for line break detection
             if (ch == '\n')
             {
-                currentBlock.Append(ch);
-                
                 // C++ style comment ends at newline
                 if (inCppStyleComment)
                 {
                     inCppStyleComment = false;
                 }
-                
-                currentLineStart = i + 1;
-                
+
                 // If we haven't seen non-whitespace in this block yet, next content starts on new line
                 if (!seenNonWhitespaceInBlock)
                 {
@@ -58,7 +137,6 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             // Handle string literals (to ignore commas and quotes in strings)
             if (inString)
             {
-                currentBlock.Append(ch);
                 if (escapeNext)
                 {
                     escapeNext = false;
@@ -78,33 +156,25 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             if (ch == '"' && !inCStyleComment && !inCppStyleComment)
             {
                 inString = true;
-                currentBlock.Append(ch);
                 continue;
             }
 
-            // Handle C++ style comments
+            // Handle C++ style comments (they end at newline, handled above)
             if (inCppStyleComment)
-            {
-                currentBlock.Append(ch);
-                // C++ comment ends at newline (already handled above)
                 continue;
-            }
 
             // Detect C++ comment start
             if (!inCStyleComment && ch == '/' && nextCh == '/')
             {
                 inCppStyleComment = true;
-                currentBlock.Append(ch);
                 continue;
             }
 
             // Handle C-style comments
             if (inCStyleComment)
             {
-                currentBlock.Append(ch);
                 if (ch == '*' && nextCh == '/')
                 {
-                    currentBlock.Append(nextCh);
                     i++; // Skip the '/'
                     inCStyleComment = false;
                 }
@@ -115,7 +185,6 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             if (ch == '/' && nextCh == '*')
             {
                 inCStyleComment = true;
-                currentBlock.Append(ch);
                 continue;
             }
 
@@ -123,14 +192,12 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             if (ch == '(')
             {
                 parenthesesDepth++;
-                currentBlock.Append(ch);
                 continue;
             }
 
             if (ch == ')')
             {
                 parenthesesDepth--;
-                currentBlock.Append(ch);
                 continue;
             }
 
@@ -138,14 +205,12 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
             if (ch == '<')
             {
                 angleBracketDepth++;
-                currentBlock.Append(ch);
                 continue;
             }
 
             if (ch == '>')
             {
                 angleBracketDepth--;
-                currentBlock.Append(ch);
                 continue;
             }
 
@@ -156,7 +221,6 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
                 {
                     blockLeadingIndent++;
                 }
-                currentBlock.Append(ch);
                 continue;
             }
 
@@ -174,96 +238,74 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
                 // 1. Single-line comment (// ...) always belongs to previous parameter (terminated by linebreak)
                 // 2. Multi-line comment (/* ... */) followed by only whitespace and linebreak belongs to previous
                 // 3. Multi-line comment (/* ... */) followed by non-whitespace belongs to NEXT parameter
-                
-                var lookAheadIndex = i + 1;
-                var trailingContent = new StringBuilder();
+                var blockEnd = i; // Exclusive; past i when a trailing comment is taken over
                 var consumedNewlineInTrailing = false;
-                
+                var lookAheadIndex = i + 1;
+
                 // Skip initial whitespace after comma
-                while (lookAheadIndex < parameterListText.Length && 
-                       (parameterListText[lookAheadIndex] == ' ' || parameterListText[lookAheadIndex] == '\t'))
+                while (lookAheadIndex < text.Length && (text[lookAheadIndex] == ' ' || text[lookAheadIndex] == '\t'))
                 {
-                    trailingContent.Append(parameterListText[lookAheadIndex]);
                     lookAheadIndex++;
                 }
-                
-                if (lookAheadIndex < parameterListText.Length)
+
+                if (lookAheadIndex < text.Length)
                 {
-                    var lookAheadCh = parameterListText[lookAheadIndex];
-                    var nextLookAheadCh = lookAheadIndex + 1 < parameterListText.Length ? 
-                        parameterListText[lookAheadIndex + 1] : '\0';
-                    
+                    var lookAheadCh = text[lookAheadIndex];
+                    var nextLookAheadCh = lookAheadIndex + 1 < text.Length ? text[lookAheadIndex + 1] : '\0';
+
                     // Check for single-line comment
                     if (lookAheadCh == '/' && nextLookAheadCh == '/')
                     {
-                        trailingContent.Append(lookAheadCh);
-                        trailingContent.Append(nextLookAheadCh);
                         lookAheadIndex += 2;
-                        
+
                         // Include everything until newline
-                        while (lookAheadIndex < parameterListText.Length && parameterListText[lookAheadIndex] != '\n')
+                        while (lookAheadIndex < text.Length && text[lookAheadIndex] != '\n')
                         {
-                            trailingContent.Append(parameterListText[lookAheadIndex]);
                             lookAheadIndex++;
                         }
-                        
+
                         // Include the newline if present
-                        if (lookAheadIndex < parameterListText.Length)
+                        if (lookAheadIndex < text.Length)
                         {
-                            trailingContent.Append(parameterListText[lookAheadIndex]);
                             lookAheadIndex++;
                             consumedNewlineInTrailing = true;
                         }
-                        
+
                         // Single-line comment always belongs to previous parameter
-                        currentBlock.Append(trailingContent);
-                        i = lookAheadIndex - 1;
+                        blockEnd = lookAheadIndex;
                     }
                     // Check for multi-line comment
                     else if (lookAheadCh == '/' && nextLookAheadCh == '*')
                     {
-                        var commentContent = new StringBuilder();
-                        commentContent.Append(lookAheadCh);
-                        commentContent.Append(nextLookAheadCh);
                         lookAheadIndex += 2;
-                        
+
                         // Find the end of the comment
-                        while (lookAheadIndex < parameterListText.Length)
+                        while (lookAheadIndex < text.Length)
                         {
-                            var commentCh = parameterListText[lookAheadIndex];
-                            var nextCommentCh = lookAheadIndex + 1 < parameterListText.Length ? 
-                                parameterListText[lookAheadIndex + 1] : '\0';
-                            
-                            commentContent.Append(commentCh);
+                            var commentCh = text[lookAheadIndex];
+                            var nextCommentCh = lookAheadIndex + 1 < text.Length ? text[lookAheadIndex + 1] : '\0';
                             lookAheadIndex++;
-                            
+
                             if (commentCh == '*' && nextCommentCh == '/')
                             {
-                                commentContent.Append(nextCommentCh);
                                 lookAheadIndex++;
                                 break;
                             }
                         }
-                        
+
                         // Now check what follows the comment: whitespace+linebreak or non-whitespace?
                         var afterCommentIndex = lookAheadIndex;
                         var hasOnlyWhitespaceUntilLinebreak = true;
-                        
-                        while (afterCommentIndex < parameterListText.Length)
+
+                        while (afterCommentIndex < text.Length)
                         {
-                            var afterCh = parameterListText[afterCommentIndex];
-                            
+                            var afterCh = text[afterCommentIndex];
+
                             if (afterCh == '\n')
                             {
-                                // Multi-line comment followed by linebreak belongs to previous parameter
-                                trailingContent.Append(commentContent);
-                                // Include whitespace and linebreak
-                                for (int idx = lookAheadIndex; idx <= afterCommentIndex; idx++)
-                                {
-                                    trailingContent.Append(parameterListText[idx]);
-                                }
-                                currentBlock.Append(trailingContent);
-                                i = afterCommentIndex;
+                                // Multi-line comment followed by linebreak belongs to previous parameter,
+                                // with the whitespace and the linebreak
+                                blockEnd = afterCommentIndex + 1;
                                 consumedNewlineInTrailing = true;
                                 break;
                             }
@@ -271,57 +313,39 @@ public class ParameterBlockSplitter : IParameterBlockSplitter
                             {
                                 // Non-whitespace after comment - comment belongs to NEXT parameter
                                 hasOnlyWhitespaceUntilLinebreak = false;
-                                // Don't append anything to current block
                                 break;
                             }
-                            
+
                             afterCommentIndex++;
                         }
-                        
+
                         // If we reached end of string with only whitespace, treat as linebreak case
-                        if (afterCommentIndex >= parameterListText.Length && hasOnlyWhitespaceUntilLinebreak)
+                        if (afterCommentIndex >= text.Length && hasOnlyWhitespaceUntilLinebreak)
                         {
-                            trailingContent.Append(commentContent);
-                            currentBlock.Append(trailingContent);
-                            i = lookAheadIndex - 1;
+                            blockEnd = lookAheadIndex;
                         }
                     }
                 }
-                
-                // Create block from accumulated content
-                var blockText = currentBlock.ToString();
-                if (!string.IsNullOrWhiteSpace(blockText.Trim()))
-                {
-                    blocks.Add(new ParameterBlock(
-                        blockText,
-                        blockIndex++,
-                        blockStartsOnNewLine,
-                        blockLeadingIndent));
-                }
 
-                // Reset for next block
-                currentBlock.Clear();
-                blockStartsOnNewLine = consumedNewlineInTrailing;  // Next block starts on new line if we consumed one
-                blockLeadingIndent = 0;
-                seenNonWhitespaceInBlock = false;
-                continue;
+                var separatorIndex = blockEnd > i ? i : -1;
+                _position = Math.Max(blockEnd, i + 1);
+                _nextBlockStartsOnNewLine = consumedNewlineInTrailing; // Next block starts on new line if we consumed one
+                return TryCompleteBlock(blockStart, blockEnd, separatorIndex, blockStartsOnNewLine, blockLeadingIndent, out block);
             }
-
-            // Regular character
-            currentBlock.Append(ch);
         }
 
-        // Add final block if any content remains
-        var finalBlockText = currentBlock.ToString();
-        if (!string.IsNullOrWhiteSpace(finalBlockText))
-        {
-            blocks.Add(new ParameterBlock(
-                finalBlockText,
-                blockIndex,
-                blockStartsOnNewLine,
-                blockLeadingIndent));
-        }
+        // Final block: the rest of the text
+        _position = text.Length;
+        return TryCompleteBlock(blockStart, text.Length, -1, blockStartsOnNewLine, blockLeadingIndent, out block);
+    }
 
-        return blocks;
+    private bool TryCompleteBlock(int start, int end, int separatorIndex, bool startsOnNewLine, int leadingIndent, out ParameterBlockRange block)
+    {
+        block = new ParameterBlockRange(start, end, separatorIndex, _blockIndex, startsOnNewLine, leadingIndent);
+        if (block.Head(_text).IsWhiteSpace() && block.Tail(_text).IsWhiteSpace())
+            return false;
+
+        _blockIndex++;
+        return true;
     }
 }
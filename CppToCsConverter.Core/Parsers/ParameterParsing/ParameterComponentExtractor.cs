@@ -1,195 +1,202 @@
-using System.Text;
-using System.Text.RegularExpressions;
+using System.Buffers;
 using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Utils;
 
 namespace CppToCsConverter.Core.Parsers.ParameterParsing;
 
 /// <summary>
 /// Extracts components (type, name, default value, comments) from a parameter block.
+/// Works on the block text in place with pooled scratch buffers; only the objects of the resulting parameter
+/// are allocated, and its types and names come from the <see cref="StringPool"/>.
 /// </summary>
 public class ParameterComponentExtractor : IParameterComponentExtractor
 {
     public CppParameter ExtractComponents(ParameterBlock block)
     {
-        var rawText = block.RawText;
-        
-        // Step 1: Extract and remove comments, tracking their positions
-        var (textWithoutComments, prefixComments, suffixComments) = ExtractComments(rawText);
-        
-        // Step 2: Parse the remaining text for type, name, and default value
-        var (typeStr, nameStr, defaultValueStr) = ParseTypeNameDefault(textWithoutComments);
-        
-        // Step 3: Extract modifiers from the type string
-        var isConst = typeStr.Contains("const");
-        var isPointer = typeStr.Contains("*");
-        var isReference = typeStr.Contains("&") && !typeStr.Contains("&&");
-        
-        // Step 4: Extract base type by removing modifiers
-        var baseType = typeStr
-            .Replace("const", "")
-            .Replace("&", "")
-            .Replace("*", "")
-            .Trim();
-        
-        // Step 5: Generate canonical signature for matching
-        var canonicalSignature = GenerateCanonicalSignature(typeStr);
-        
-        // Step 6: Build CppParameter directly
+        return Extract(new BlockText(block.RawText, ReadOnlySpan<char>.Empty), block.StartsOnNewLine, block.LeadingIndent);
+    }
+
+    /// <summary>
+    /// Extracts the parameter of a block read by <see cref="ParameterBlockReader"/> from the parameter list text
+    /// </summary>
+    internal static CppParameter ExtractComponents(ReadOnlySpan<char> parameterListText, in ParameterBlockRange block)
+    {
+        return Extract(new BlockText(block.Head(parameterListText), block.Tail(parameterListText)), block.StartsOnNewLine, block.LeadingIndent);
+    }
+
+    private static CppParameter Extract(BlockText rawText, bool startsOnNewLine, int leadingIndent)
+    {
         var cppParam = new CppParameter
         {
-            Type = baseType,
-            Name = nameStr,
-            DefaultValue = defaultValueStr,  // Keep null if no default value
-            IsConst = isConst,
-            IsPointer = isPointer,
-            IsReference = isReference,
-            CanonicalSignature = canonicalSignature,
-            HasLineBreak = block.StartsOnNewLine,
-            OriginalIndent = block.LeadingIndent,
-            OriginalText = typeStr + (string.IsNullOrEmpty(nameStr) ? "" : " " + nameStr)
+            HasLineBreak = startsOnNewLine,
+            OriginalIndent = leadingIndent
         };
 
-        // Add positioned comments
-        cppParam.PositionedComments = new List<ParameterComment>(prefixComments);
-        cppParam.PositionedComments.AddRange(suffixComments);
+        // The cleaned text is at most as long as the block; type and canonical signature are built from
+        // tokens of it with at most one separating space each, so twice the length bounds every step
+        var cleanedBuffer = ArrayPool<char>.Shared.Rent(rawText.Length);
+        var scratchBuffer = ArrayPool<char>.Shared.Rent(rawText.Length * 2 + 1);
+        var tokenBuffer = ArrayPool<Range>.Shared.Rent(rawText.Length * 2 + 1);
+        try
+        {
+            // Step 1: Extract and remove comments, tracking their positions (prefix comments first)
+            var cleanedLength = ExtractComments(rawText, cleanedBuffer, cppParam);
+            foreach (var comment in cppParam.PositionedCommentsOrEmpty)
+            {
+                cppParam.InlineComments.Add(comment.CommentText); // Legacy InlineComments for backward compatibility
+            }
+
+            // Step 2: Parse the remaining text for type, name, and default value
+            var text = cleanedBuffer.AsSpan(0, cleanedLength).TrimEnd(", \t\n\r"); // Remove trailing comma and whitespace
+            var equalsIndex = FindDefaultValueSeparator(text);
+            if (equalsIndex >= 0)
+            {
+                cppParam.DefaultValue = StringPool.Intern(text[(equalsIndex + 1)..].Trim());
+                text = text[..equalsIndex].Trim();
+            }
+            else
+            {
+                cppParam.DefaultValue = null!; // Keep null if no default value
+            }
+
+            // Now we have: type + name (e.g., "const TAttId& attId" or "CAgrMT* pmtTable")
+            var typeLength = SplitTypeAndName(text, scratchBuffer, tokenBuffer, out var name);
+            cppParam.Name = name;
+            cppParam.OriginalText = name.Length == 0
+                ? StringPool.Intern(scratchBuffer.AsSpan(0, typeLength))
+                : StringPool.Intern(string.Concat(scratchBuffer.AsSpan(0, typeLength), " ", name));
+            var typeStr = cppParam.OriginalText.AsSpan(0, typeLength);
+
+            // Step 3: Extract modifiers from the type string
+            cppParam.IsConst = typeStr.Contains("const", StringComparison.Ordinal);
+            cppParam.IsPointer = typeStr.Contains('*');
+            cppParam.IsReference = typeStr.Contains('&') && !typeStr.Contains("&&", StringComparison.Ordinal);
 
-        // Legacy InlineComments for backward compatibility
-        cppParam.InlineComments = cppParam.PositionedComments.Select(pc => pc.CommentText).ToList();
+            // Step 4: Extract base type by removing modifiers
+            cppParam.Type = StringPool.Intern(RemoveModifiers(typeStr, scratchBuffer).Trim());
+
+            // Step 5: Generate canonical signature for matching
+            cppParam.CanonicalSignature = GenerateCanonicalSignature(typeStr, scratchBuffer, tokenBuffer);
+        }
+        finally
+        {
+            ArrayPool<Range>.Shared.Return(tokenBuffer);
+            ArrayPool<char>.Shared.Return(scratchBuffer);
+            ArrayPool<char>.Shared.Return(cleanedBuffer);
+        }
 
         return cppParam;
     }
 
-    private (string textWithoutComments, List<ParameterComment> prefixComments, List<ParameterComment> suffixComments) 
-        ExtractComments(string text)
+    /// <summary>
+    /// Copies the text without its comments to <paramref name="cleaned"/> and adds the comments to the positioned comments of
+    /// <paramref name="parameter"/>: block comments before any content as prefix comments, then the others as suffix comments
+    /// </summary>
+    /// <returns>Length of the cleaned text</returns>
+    private static int ExtractComments(BlockText text, char[] cleaned, CppParameter parameter)
     {
-        var prefixComments = new List<ParameterComment>();
-        var suffixComments = new List<ParameterComment>();
-        var cleaned = new StringBuilder();
-        
+        var cleanedLength = 0;
+        var prefixCount = 0;
+
         var inCStyleComment = false;
         var inCppStyleComment = false;
-        var currentComment = new StringBuilder();
+        var commentStart = 0;
         var hasSeenNonCommentContent = false;
-        
+
         for (var i = 0; i < text.Length; i++)
         {
             var ch = text[i];
             var nextCh = i + 1 < text.Length ? text[i + 1] : '\0';
-            
+
             // Handle C++ style comment
             if (inCppStyleComment)
             {
-                currentComment.Append(ch);
                 if (ch == '\n')
                 {
                     // End of C++ comment
-                    suffixComments.Add(new ParameterComment
+                    parameter.PositionedComments.Add(new ParameterComment
                     {
-                        CommentText = currentComment.ToString().Trim(),
+                        CommentText = text.ToTrimmedString(commentStart, i + 1),
                         Position = CommentPosition.Suffix
                     });
-                    currentComment.Clear();
                     inCppStyleComment = false;
                 }
                 continue;
             }
-            
+
             // Detect C++ comment start
             if (!inCStyleComment && ch == '/' && nextCh == '/')
             {
                 inCppStyleComment = true;
-                currentComment.Append(ch);
+                commentStart = i;
                 continue;
             }
-            
+
             // Handle C-style comment
             if (inCStyleComment)
             {
-                currentComment.Append(ch);
                 if (ch == '*' && nextCh == '/')
                 {
-                    currentComment.Append(nextCh);
                     i++; // Skip the '/'
-                    
+
                     // Classify as prefix or suffix based on whether we've seen content
                     var comment = new ParameterComment
                     {
-                        CommentText = currentComment.ToString().Trim(),
+                        CommentText = text.ToTrimmedString(commentStart, i + 1),
                         Position = hasSeenNonCommentContent ? CommentPosition.Suffix : CommentPosition.Prefix
                     };
-                    
+
                     if (hasSeenNonCommentContent)
-                        suffixComments.Add(comment);
+                        parameter.PositionedComments.Add(comment);
                     else
-                        prefixComments.Add(comment);
-                    
-                    currentComment.Clear();
+                        parameter.PositionedComments.Insert(prefixCount++, comment);
+
                     inCStyleComment = false;
                 }
                 continue;
             }
-            
+
             // Detect C-style comment start
             if (ch == '/' && nextCh == '*')
             {
                 inCStyleComment = true;
-                currentComment.Append(ch);
+                commentStart = i;
                 continue;
             }
-            
+
             // Regular content
             if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r' && ch != ',')
             {
                 hasSeenNonCommentContent = true;
             }
-            
-            cleaned.Append(ch);
+
+            cleaned[cleanedLength++] = ch;
         }
-        
+
         // If still in a C++ comment at end (no newline), add it
-        if (inCppStyleComment && currentComment.Length > 0)
+        if (inCppStyleComment)
         {
-            suffixComments.Add(new ParameterComment
+            parameter.PositionedComments.Add(new ParameterComment
             {
-                CommentText = currentComment.ToString().Trim(),
+                CommentText = text.ToTrimmedString(commentStart, text.Length),
                 Position = CommentPosition.Suffix
             });
         }
-        
-        return (cleaned.ToString(), prefixComments, suffixComments);
-    }
 
-    private (string type, string name, string? defaultValue) ParseTypeNameDefault(string text)
-    {
-        // Remove trailing comma and whitespace
-        text = text.TrimEnd(',', ' ', '\t', '\n', '\r');
-        
-        // Check for default value (=)
-        string? defaultValue = null;
-        var equalsIndex = FindDefaultValueSeparator(text);
-        if (equalsIndex >= 0)
-        {
-            defaultValue = text.Substring(equalsIndex + 1).Trim();
-            text = text.Substring(0, equalsIndex).Trim();
-        }
-        
-        // Now we have: type + name (e.g., "const TAttId& attId" or "CAgrMT* pmtTable")
-        var (type, name) = SplitTypeAndName(text);
-        
-        return (type, name, defaultValue);
+        return cleanedLength;
     }
 
-    private int FindDefaultValueSeparator(string text)
+    private static int FindDefaultValueSeparator(ReadOnlySpan<char> text)
     {
         // Find '=' that's not inside parentheses, brackets, or angle brackets
         var depth = 0;
         var angleDepth = 0;
         var bracketDepth = 0;
-        
+
         for (var i = 0; i < text.Length; i++)
         {
             var ch = text[i];
-            
+
             if (ch == '(') depth++;
             else if (ch == ')') depth--;
             else if (ch == '<') angleDepth++;
@@ -201,229 +208,275 @@ public class ParameterComponentExtractor : IParameterComponentExtractor
                 return i;
             }
         }
-        
+
         return -1;
     }
 
-    private (string type, string name) SplitTypeAndName(string text)
+    /// <summary>
+    /// Splits type and name; the type is written to <paramref name="typeBuffer"/>
+    /// </summary>
+    /// <returns>Length of the type</returns>
+    private static int SplitTypeAndName(ReadOnlySpan<char> text, char[] typeBuffer, Range[] tokenBuffer, out string name)
     {
         text = text.Trim();
-        
+        name = string.Empty;
+
         // If empty, return empty
-        if (string.IsNullOrWhiteSpace(text))
-            return (string.Empty, string.Empty);
-        
+        if (text.IsEmpty)
+            return 0;
+
         // Strategy: The parameter name is the last "word" that's not a modifier (* & const)
         // Exception: If text ends with * or &, there's no name (just type)
         // Work backwards to find the name
-        
-        var tokens = TokenizeParameter(text);
-        if (tokens.Count == 0)
-            return (text, string.Empty);
-        
-        // Check if the last token is a modifier - if so, there's no name
-        var lastToken = tokens[tokens.Count - 1];
-        if (lastToken == "*" || lastToken == "&" || lastToken == "const")
-        {
-            // No name, entire text is the type
-            return (text.Trim(), string.Empty);
-        }
-        
+        var tokenCount = TokenizeParameter(text, tokenBuffer);
+        var tokens = tokenBuffer.AsSpan(0, tokenCount);
+
+        // Check if the last token is a modifier - if so, there's no name; the entire text is the type
+        if (tokens.Length == 0 || IsModifier(text[tokens[^1]]))
+            return CopyTo(text, typeBuffer);
+
         // Find the parameter name (last non-modifier, non-bracket token)
-        string name = string.Empty;
         int nameIndex = -1;
-        
-        for (int i = tokens.Count - 1; i >= 0; i--)
+        for (int i = tokens.Length - 1; i >= 0; i--)
         {
-            var token = tokens[i];
-            // Skip array brackets attached to name
-            if (token.StartsWith("[") && token.EndsWith("]"))
-                continue;
-            
-            // Skip modifiers
-            if (token == "*" || token == "&" || token == "const")
+            var token = text[tokens[i]];
+
+            // Skip array brackets attached to name, and modifiers
+            if (IsArrayBrackets(token) || IsModifier(token))
                 continue;
-            
+
             // This is the name
-            name = token;
             nameIndex = i;
             break;
         }
-        
-        // Type is everything except the name
-        string type;
-        if (nameIndex >= 0)
+
+        // No name found, entire text is the type
+        if (nameIndex < 0)
+            return CopyTo(text, typeBuffer);
+
+        name = StringPool.Intern(text[tokens[nameIndex]]);
+
+        // Type is the other tokens except array brackets (they're part of name in C++),
+        // joined intelligently: no space before or after * or &
+        var typeLength = 0;
+        var previousToken = ReadOnlySpan<char>.Empty;
+        for (int i = 0; i < tokens.Length; i++)
         {
-            // Reconstruct type from tokens before the name + any modifiers after
-            var typeTokens = new List<string>();
-            for (int i = 0; i < tokens.Count; i++)
+            var token = text[tokens[i]];
+            if (i == nameIndex || IsArrayBrackets(token))
+                continue;
+
+            if (typeLength > 0 && !IsPointerOrReference(token) && !IsPointerOrReference(previousToken))
             {
-                if (i == nameIndex)
-                    continue; // Skip the name itself
-                    
-                // Skip array brackets (they're part of name in C++)
-                if (tokens[i].StartsWith("[") && tokens[i].EndsWith("]"))
-                    continue;
-                    
-                typeTokens.Add(tokens[i]);
+                typeBuffer[typeLength++] = ' ';
             }
-            
-            // Join tokens intelligently: no space before * or &
-            var typeBuilder = new StringBuilder();
-            for (int i = 0; i < typeTokens.Count; i++)
-            {
-                var token = typeTokens[i];
-                
-                // Add space before token unless:
-                // - It's the first token
-                // - It's a * or & (pointer/reference modifier)
-                // - Previous token was a * or &
-                if (i > 0 && token != "*" && token != "&" && 
-                    typeTokens[i-1] != "*" && typeTokens[i-1] != "&")
-                {
-                    typeBuilder.Append(' ');
-                }
-                
-                typeBuilder.Append(token);
-            }
-            
-            type = typeBuilder.ToString().Trim();
-        }
-        else
-        {
-            // No name found, entire text is the type
-            type = text.Trim();
-            name = string.Empty;
+
+            token.CopyTo(typeBuffer.AsSpan(typeLength));
+            typeLength += token.Length;
+            previousToken = token;
         }
-        
-        return (type, name);
+
+        var type = typeBuffer.AsSpan(0, typeLength).Trim();
+        return CopyTo(type, typeBuffer);
     }
 
-    private List<string> TokenizeParameter(string text)
+    /// <summary>
+    /// Splits a parameter into tokens: whitespace separates tokens, * and &amp; are tokens of their own,
+    /// template arguments and array brackets stay in one token
+    /// </summary>
+    /// <returns>Number of token ranges written to <paramref name="tokens"/></returns>
+    private static int TokenizeParameter(ReadOnlySpan<char> text, Range[] tokens)
     {
-        var tokens = new List<string>();
-        var current = new StringBuilder();
+        var tokenCount = 0;
+        var currentStart = -1; // Start of the token being read, or -1
         var inAngleBrackets = 0;
         var inArrayBrackets = false;
-        
+
         for (var i = 0; i < text.Length; i++)
         {
             var ch = text[i];
-            
+
             // Handle array brackets as single token
             if (ch == '[')
             {
-                if (current.Length > 0)
+                if (currentStart >= 0)
                 {
-                    tokens.Add(current.ToString());
-                    current.Clear();
+                    tokens[tokenCount++] = currentStart..i;
                 }
                 inArrayBrackets = true;
-                current.Append(ch);
+                currentStart = i;
                 continue;
             }
-            
+
             if (inArrayBrackets)
             {
-                current.Append(ch);
                 if (ch == ']')
                 {
-                    tokens.Add(current.ToString());
-                    current.Clear();
+                    tokens[tokenCount++] = currentStart..(i + 1);
+                    currentStart = -1;
                     inArrayBrackets = false;
                 }
                 continue;
             }
-            
-            // Track template depth
+
+            // Track template depth; inside templates, include everything
             if (ch == '<')
             {
                 inAngleBrackets++;
-                current.Append(ch);
-                continue;
             }
-            
-            if (ch == '>')
+            else if (ch == '>')
             {
                 inAngleBrackets--;
-                current.Append(ch);
-                continue;
-            }
-            
-            // Inside templates, include everything
-            if (inAngleBrackets > 0)
-            {
-                current.Append(ch);
-                continue;
             }
-            
-            // Whitespace splits tokens
-            if (char.IsWhiteSpace(ch))
+            else if (inAngleBrackets <= 0)
             {
-                if (current.Length > 0)
+                // Whitespace splits tokens; * and & are separate tokens
+                if (char.IsWhiteSpace(ch) || ch == '*' || ch == '&')
                 {
-                    tokens.Add(current.ToString());
-                    current.Clear();
+                    if (currentStart >= 0)
+                    {
+                        tokens[tokenCount++] = currentStart..i;
+                        currentStart = -1;
+                    }
+                    if (ch == '*' || ch == '&')
+                    {
+                        tokens[tokenCount++] = i..(i + 1);
+                    }
+                    continue;
                 }
-                continue;
             }
-            
-            // * and & are separate tokens
-            if (ch == '*' || ch == '&')
+
+            if (currentStart < 0)
             {
-                if (current.Length > 0)
-                {
-                    tokens.Add(current.ToString());
-                    current.Clear();
-                }
-                tokens.Add(ch.ToString());
-                continue;
+                currentStart = i;
             }
-            
-            current.Append(ch);
         }
-        
-        if (current.Length > 0)
+
+        if (currentStart >= 0)
         {
-            tokens.Add(current.ToString());
+            tokens[tokenCount++] = currentStart..text.Length;
         }
-        
-        return tokens;
+
+        return tokenCount;
     }
 
-    private string GenerateCanonicalSignature(string type)
+    /// <summary>
+    /// The type without "const", "&amp;" and "*", as by removing "const" first and then the characters
+    /// </summary>
+    private static ReadOnlySpan<char> RemoveModifiers(ReadOnlySpan<char> type, char[] buffer)
+    {
+        var length = 0;
+        for (var i = 0; i < type.Length; i++)
+        {
+            if (type[i..].StartsWith("const", StringComparison.Ordinal))
+            {
+                i += "const".Length - 1;
+                continue;
+            }
+            if (type[i] == '&' || type[i] == '*')
+                continue;
+
+            buffer[length++] = type[i];
+        }
+        return buffer.AsSpan(0, length);
+    }
+
+    private static string GenerateCanonicalSignature(ReadOnlySpan<char> type, char[] buffer, Range[] tokenBuffer)
     {
         // Normalize whitespace and const positioning for matching
         // Goal: "const TAttId&" matches "TAttId const &" matches "const TAttId  &"
-        
-        var tokens = TokenizeParameter(type);
-        var normalized = new List<string>();
-        
-        // Move const to the front
-        var hasConst = tokens.Contains("const");
+        var tokenCount = TokenizeParameter(type, tokenBuffer);
+        var tokens = tokenBuffer.AsSpan(0, tokenCount);
+
+        var hasConst = false;
+        var hasPointer = false;
+        var hasReference = false;
+        foreach (var range in tokens)
+        {
+            var token = type[range];
+            hasConst |= token.SequenceEqual("const");
+            hasPointer |= token.SequenceEqual("*");
+            hasReference |= token.SequenceEqual("&");
+        }
+
+        // Move const to the front, then the non-const, non-modifier tokens, then the modifiers in consistent order,
+        // joined with single spaces
+        var length = 0;
         if (hasConst)
         {
-            normalized.Add("const");
+            Append(buffer, ref length, "const");
+        }
+        foreach (var range in tokens)
+        {
+            var token = type[range];
+            if (!IsModifier(token))
+            {
+                Append(buffer, ref length, token);
+            }
+        }
+        if (hasPointer)
+        {
+            Append(buffer, ref length, "*");
+        }
+        if (hasReference)
+        {
+            Append(buffer, ref length, "&");
         }
-        
-        // Add non-const, non-modifier tokens
-        foreach (var token in tokens)
+
+        return StringPool.Intern(buffer.AsSpan(0, length));
+    }
+
+    private static void Append(char[] buffer, ref int length, ReadOnlySpan<char> token)
+    {
+        if (length > 0)
         {
-            if (token == "const")
-                continue; // Already added at front
-            if (token == "*" || token == "&")
-                continue; // Add these at the end
-                
-            normalized.Add(token);
+            buffer[length++] = ' ';
+        }
+        token.CopyTo(buffer.AsSpan(length));
+        length += token.Length;
+    }
+
+    private static int CopyTo(ReadOnlySpan<char> text, char[] buffer)
+    {
+        text.CopyTo(buffer);
+        return text.Length;
+    }
+
+    private static bool IsModifier(ReadOnlySpan<char> token) =>
+        IsPointerOrReference(token) || token.SequenceEqual("const");
+
+    private static bool IsPointerOrReference(ReadOnlySpan<char> token) =>
+        token.Length == 1 && (token[0] == '*' || token[0] == '&');
+
+    private static bool IsArrayBrackets(ReadOnlySpan<char> token) =>
+        token.Length > 0 && token[0] == '[' && token[^1] == ']';
+
+    /// <summary>
+    /// The text of a parameter block: one range of the parameter list, or two when the separating comma is left out
+    /// </summary>
+    private readonly ref struct BlockText
+    {
+        private readonly ReadOnlySpan<char> _head;
+        private readonly ReadOnlySpan<char> _tail;
+
+        public BlockText(ReadOnlySpan<char> head, ReadOnlySpan<char> tail)
+        {
+            _head = head;
+            _tail = tail;
+        }
+
+        public int Length => _head.Length + _tail.Length;
+
+        public char this[int index] => index < _head.Length ? _head[index] : _tail[index - _head.Length];
+
+        public string ToTrimmedString(int start, int end)
+        {
+            if (end <= _head.Length)
+                return new string(_head[start..end].Trim());
+            if (start >= _head.Length)
+                return new string(_tail[(start - _head.Length)..(end - _head.Length)].Trim());
+
+            return string.Concat(_head[start..], _tail[..(end - _head.Length)]).Trim();
         }
-        
-        // Add modifiers at the end in consistent order
-        if (tokens.Contains("*"))
-            normalized.Add("*");
-        if (tokens.Contains("&"))
-            normalized.Add("&");
-        
-        // Join with single space
-        return string.Join(" ", normalized);
     }
 }
@@ -0,0 +1,216 @@
+using System;
+using System.Collections.Generic;
+using System.Text.RegularExpressions;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// Per-line lookups for the declarations of one source file, built in a single forward pass:
+    /// the line declaring each "Class::Method", the comment block before each line and the
+    /// #region/#endregion markers around it. Each line is matched against the region and
+    /// method implementation patterns once, instead of once per method that scans past it.
+    /// </summary>
+    internal class SourceDeclarationMap
+    {
+        private readonly string[] _lines;
+        private readonly Regex _methodImplementationRegex;
+
+        // First line containing "Class::Method" and "(" for each qualified name
+        private readonly Dictionary<string, int> _declarationLines = new Dictionary<string, int>(StringComparer.Ordinal);
+
+        // Lines containing "::" and "(", in order; the only lines a qualified name can be declared on
+        private readonly List<int> _scopedLines = new List<int>();
+
+        // "#region ..." found by looking back from each line over blank and comment lines, or empty
+        private readonly string[] _regionStartBefore;
+
+        // "#endregion ..." found by looking ahead from each line over lines that are not method implementations, or empty
+        private readonly string[] _regionEndFrom;
+
+        private readonly int[] _openBraces;
+        private readonly int[] _closeBraces;
+
+        public SourceDeclarationMap(string[] lines, Regex pragmaRegionRegex, Regex methodImplementationRegex)
+        {
+            _lines = lines;
+            _methodImplementationRegex = methodImplementationRegex;
+            Comments = new CommentBlockMap(lines, CommentBlockStyle.Source);
+            _regionStartBefore = new string[lines.Length + 1];
+            _regionEndFrom = new string[lines.Length + 1];
+            _openBraces = new int[lines.Length];
+            _closeBraces = new int[lines.Length];
+
+            var regionMarkers = new string?[lines.Length];
+            var isMethodImplementation = new bool[lines.Length];
+
+            _regionStartBefore[0] = string.Empty;
+            for (int i = 0; i < lines.Length; i++)
+            {
+                var line = lines[i].Trim();
+                CountBraces(line, out _openBraces[i], out _closeBraces[i]);
+                if (line.Contains("::"))
+                {
+                    if (line.Contains("("))
+                    {
+                        _scopedLines.Add(i);
+                        IndexDeclarations(line, i);
+                    }
+                    isMethodImplementation[i] = _openBraces[i] > 0 && methodImplementationRegex.IsMatch(line);
+                }
+
+                if (line.StartsWith("#"))
+                {
+                    regionMarkers[i] = GetRegionMarker(pragmaRegionRegex.Match(line));
+                }
+
+                var regionStart = _regionStartBefore[i];
+                if (line.Length > 0)
+                {
+                    if (regionMarkers[i] != null && regionMarkers[i]!.StartsWith("#region"))
+                    {
+                        regionStart = regionMarkers[i]!;
+                    }
+                    else if (isMethodImplementation[i] || (!line.StartsWith("//") && !line.StartsWith("/*") && !line.EndsWith("*/")))
+                    {
+                        // A method implementation or code line ends the lookback
+                        regionStart = string.Empty;
+                    }
+                }
+                _regionStartBefore[i + 1] = regionStart;
+            }
+
+            _regionEndFrom[lines.Length] = string.Empty;
+            for (int i = lines.Length - 1; i >= 0; i--)
+            {
+                var regionEnd = _regionEndFrom[i + 1];
+                if (regionMarkers[i] != null && regionMarkers[i]!.StartsWith("#endregion"))
+                {
+                    regionEnd = regionMarkers[i]!;
+                }
+                else if (isMethodImplementation[i])
+                {
+                    // Another method follows, so the endregion does not belong to the method before it
+                    regionEnd = string.Empty;
+                }
+                _regionEndFrom[i] = regionEnd;
+            }
+        }
+
+        /// <summary>
+        /// Preceding comment blocks of the file's lines
+        /// </summary>
+        public CommentBlockMap Comments { get; }
+
+        /// <summary>
+        /// Returns the first line containing "Class::Method" followed by a parameter list opening on the same line, or -1
+        /// </summary>
+        public int FindDeclarationLine(string className, string methodName)
+        {
+            var qualifiedName = $"{className}::{methodName}";
+            if (_declarationLines.TryGetValue(qualifiedName, out var lineIndex))
+                return lineIndex;
+
+            // Names that are not plain identifiers, e.g. template classes, are matched as text. Local methods are
+            // looked up too and usually have no such line, so only the lines that can contain one are searched.
+            foreach (var i in _scopedLines)
+            {
+                if (_lines[i].Contains(qualifiedName))
+                    return i;
+            }
+            return -1;
+        }
+
+        /// <summary>
+        /// Returns the region a method declared on the given line starts, and the region it ends
+        /// if it is the last method before the "#endregion"
+        /// </summary>
+        public (string regionStart, string regionEnd) GetRegionMarkers(int lineIndex)
+        {
+            var regionStart = _regionStartBefore[lineIndex];
+            if (string.IsNullOrEmpty(regionStart))
+                return (string.Empty, string.Empty);
+
+            // Find the end of the method body
+            int methodEndIndex = lineIndex;
+            int braceCount = 0;
+            bool inMethodBody = false;
+            for (int i = lineIndex; i < _lines.Length; i++)
+            {
+                if (_openBraces[i] > 0)
+                {
+                    inMethodBody = true;
+                    braceCount += _openBraces[i];
+                }
+
+                if (inMethodBody && _closeBraces[i] > 0)
+                {
+                    braceCount -= _closeBraces[i];
+                    if (braceCount <= 0)
+                    {
+                        methodEndIndex = i;
+                        break;
+                    }
+                }
+            }
+
+            return (regionStart, _regionEndFrom[methodEndIndex + 1]);
+        }
+
+        private void IndexDeclarations(string line, int lineIndex)
+        {
+            for (int scope = line.IndexOf("::"); scope >= 0; scope = line.IndexOf("::", scope + 2))
+            {
+                int classStart = scope;
+                while (classStart > 0 && IsIdentifierChar(line[classStart - 1]))
+                {
+                    classStart--;
+                }
+
+                int nameEnd = scope + 2;
+                if (nameEnd < line.Length && line[nameEnd] == '~')
+                {
+                    nameEnd++;
+                }
+                while (nameEnd < line.Length && IsIdentifierChar(line[nameEnd]))
+                {
+                    nameEnd++;
+                }
+
+                _declarationLines.TryAdd(line.Substring(classStart, nameEnd - classStart), lineIndex);
+            }
+        }
+
+        private static string? GetRegionMarker(Match regionMatch)
+        {
+            if (!regionMatch.Success)
+                return null;
+
+            var description = regionMatch.Groups[2].Success ? regionMatch.Groups[2].Value.Trim() : string.Empty;
+            if (regionMatch.Groups[1].Value.Equals("region", StringComparison.OrdinalIgnoreCase))
+                return $"#region {description}".Trim();
+
+            if (regionMatch.Groups[1].Value.Equals("endregion", StringComparison.OrdinalIgnoreCase))
+                return $"#endregion{(string.IsNullOrEmpty(description) ? "" : " " + description)}";
+
+            return null;
+        }
+
+        private static void CountBraces(string line, out int openBraces, out int closeBraces)
+        {
+            openBraces = 0;
+            closeBraces = 0;
+            foreach (var c in line)
+            {
+                if (c == '{')
+                    openBraces++;
+                else if (c == '}')
+                    closeBraces++;
+            }
+        }
+
+        private static bool IsIdentifierChar(char c)
+        {
+            return char.IsLetterOrDigit(c) || c == '_';
+        }
+    }
+}
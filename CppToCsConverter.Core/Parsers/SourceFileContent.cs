@@ -0,0 +1,139 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using System.Security.Cryptography;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// The content of one input file, read once. The bytes are read into a pooled buffer, hashed and decoded
+    /// the same way as <see cref="File.ReadAllText(string)"/>. The line table is built once and the lines
+    /// are materialized at most once, so every parse stage shares the same split of the file and one line array.
+    /// </summary>
+    internal class SourceFileContent
+    {
+        private readonly int[] _lineStarts;
+        private readonly int[] _lineEnds; // Exclusive of the line break
+        private string[]? _lines;
+        private string[]? _nonEmptyLines;
+
+        private SourceFileContent(string filePath, string text, string hash)
+        {
+            FilePath = filePath;
+            Text = text;
+            Hash = hash;
+            (_lineStarts, _lineEnds) = CreateLineTable(text);
+        }
+
+        public string FilePath { get; }
+
+        public string Text { get; }
+
+        /// <summary>
+        /// SHA-256 of the file bytes as an uppercase hex string
+        /// </summary>
+        public string Hash { get; }
+
+        /// <summary>
+        /// Number of lines; "\r\n", "\r" and "\n" each end a line
+        /// </summary>
+        public int LineCount => _lineStarts.Length;
+
+        /// <summary>
+        /// All lines without line breaks, including empty lines
+        /// </summary>
+        public string[] Lines => _lines ??= CreateLines();
+
+        /// <summary>
+        /// The lines that are not empty, as split by the header parser
+        /// </summary>
+        public string[] NonEmptyLines => _nonEmptyLines ??= Array.FindAll(Lines, line => line.Length > 0);
+
+        public static SourceFileContent Read(string filePath)
+        {
+            using var stream = new FileStream(filePath, FileMode.Open, FileAccess.Read, FileShare.Read, bufferSize: 1, FileOptions.SequentialScan);
+            var length = checked((int)stream.Length);
+            var buffer = ArrayPool<byte>.Shared.Rent(Math.Max(length, 1));
+            try
+            {
+                int read = 0;
+                while (read < length)
+                {
+                    int count = stream.Read(buffer, read, length - read);
+                    if (count == 0)
+                        break;
+                    read += count;
+                }
+
+                return Decode(filePath, buffer, read);
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Reads the content of an input that is not on disk from a stream, decoded like a file.
+        /// The stream is read to its end and not disposed.
+        /// </summary>
+        public static async Task<SourceFileContent> ReadAsync(string filePath, Stream stream, CancellationToken cancellationToken = default)
+        {
+            using var buffer = new MemoryStream();
+            await stream.CopyToAsync(buffer, cancellationToken).ConfigureAwait(false);
+            return Decode(filePath, buffer.GetBuffer(), (int)buffer.Length);
+        }
+
+        /// <summary>
+        /// Creates the content of an input that is not on disk. The hash is computed over the UTF-8 encoding
+        /// of the text, so it matches the hash of the same text saved as a file without a byte order mark.
+        /// </summary>
+        public static SourceFileContent FromText(string filePath, string text)
+        {
+            var hash = Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(text)));
+            return new SourceFileContent(filePath, text, hash);
+        }
+
+        private static SourceFileContent Decode(string filePath, byte[] buffer, int length)
+        {
+            var hash = Convert.ToHexString(SHA256.HashData(buffer.AsSpan(0, length)));
+            using var reader = new StreamReader(new MemoryStream(buffer, 0, length, writable: false), Encoding.UTF8, detectEncodingFromByteOrderMarks: true);
+            return new SourceFileContent(filePath, reader.ReadToEnd(), hash);
+        }
+
+        private string[] CreateLines()
+        {
+            var lines = new string[_lineStarts.Length];
+            for (int i = 0; i < lines.Length; i++)
+            {
+                lines[i] = Text.Substring(_lineStarts[i], _lineEnds[i] - _lineStarts[i]);
+            }
+            return lines;
+        }
+
+        private static (int[] Starts, int[] Ends) CreateLineTable(string text)
+        {
+            var starts = new List<int>(text.Length / 32 + 16) { 0 };
+            var ends = new List<int>(starts.Capacity);
+            for (int i = 0; i < text.Length; i++)
+            {
+                var ch = text[i];
+                if (ch != '\r' && ch != '\n')
+                    continue;
+
+                ends.Add(i);
+                if (ch == '\r' && i + 1 < text.Length && text[i + 1] == '\n')
+                {
+                    i++;
+                }
+                starts.Add(i + 1);
+            }
+            ends.Add(text.Length);
+            return (starts.ToArray(), ends.ToArray());
+        }
+    }
+}
@@ -0,0 +1,161 @@
+using System;
+using System.Collections.Generic;
+using CppToCsConverter.Core.Parsers.Lexing;
+
+namespace CppToCsConverter.Core.Parsers
+{
+    /// <summary>
+    /// Position lookups for one source file, built once from its token stream.
+    /// Maps each "Class::Method" signature to its first occurrence and the body following it,
+    /// so ordering and containment queries do not rescan the file text per method.
+    /// </summary>
+    internal class SourcePositionIndex
+    {
+        private readonly CppTokenStream _tokens;
+        private readonly Dictionary<string, SignatureSpan> _signatures = new Dictionary<string, SignatureSpan>(StringComparer.Ordinal);
+
+        public SourcePositionIndex(CppTokenStream tokens)
+        {
+            _tokens = tokens;
+
+            // Index of the first opening brace at or after each token
+            var nextOpenBrace = new int[tokens.Count + 1];
+            nextOpenBrace[tokens.Count] = -1;
+            for (int i = tokens.Count - 1; i >= 0; i--)
+            {
+                nextOpenBrace[i] = tokens.IsPunctuation(i, '{') ? i : nextOpenBrace[i + 1];
+            }
+
+            for (int i = 1; i + 1 < tokens.Count; i++)
+            {
+                if (!tokens.IsScopeOperator(i) || tokens[i - 1].Kind != CppTokenKind.Identifier)
+                    continue;
+
+                int nameIndex = i + 1;
+                var prefix = string.Empty;
+                if (tokens.IsPunctuation(nameIndex, '~') && nameIndex + 1 < tokens.Count)
+                {
+                    prefix = "~";
+                    nameIndex++;
+                }
+                if (tokens[nameIndex].Kind != CppTokenKind.Identifier)
+                    continue;
+
+                var signature = $"{tokens.GetText(i - 1)}::{prefix}{tokens.GetText(nameIndex)}";
+                if (_signatures.ContainsKey(signature))
+                    continue;
+
+                var span = new SignatureSpan(tokens[i - 1].Start, -1, -1);
+                var openBrace = nextOpenBrace[nameIndex];
+                if (openBrace >= 0)
+                {
+                    var closeBrace = tokens.GetMatchingBrace(openBrace);
+                    if (closeBrace >= 0)
+                    {
+                        span = new SignatureSpan(span.Start, tokens[openBrace].Start, tokens[closeBrace].End);
+                    }
+                }
+                _signatures.Add(signature, span);
+            }
+        }
+
+        public CppTokenStream Tokens => _tokens;
+
+        /// <summary>
+        /// Returns the position of the first occurrence of "Class::Method" in code, or -1 if there is none
+        /// </summary>
+        public int GetSignaturePosition(string className, string methodName)
+        {
+            return _signatures.TryGetValue($"{className}::{methodName}", out var span) ? span.Start : -1;
+        }
+
+        /// <summary>
+        /// Returns the range from the first opening brace after the signature to its matching closing brace (exclusive)
+        /// </summary>
+        public bool TryGetBodyRange(string className, string methodName, out (int Start, int End) range)
+        {
+            if (_signatures.TryGetValue($"{className}::{methodName}", out var span) && span.BodyStart >= 0)
+            {
+                range = (span.BodyStart, span.BodyEnd);
+                return true;
+            }
+            range = default;
+            return false;
+        }
+
+        /// <summary>
+        /// Sorts and merges ranges so <see cref="IsInRanges"/> can use binary search
+        /// </summary>
+        public static List<(int Start, int End)> MergeRanges(List<(int Start, int End)> ranges)
+        {
+            ranges.Sort((a, b) => a.Start.CompareTo(b.Start));
+
+            var merged = new List<(int Start, int End)>(ranges.Count);
+            foreach (var range in ranges)
+            {
+                if (merged.Count > 0 && range.Start <= merged[merged.Count - 1].End)
+                {
+                    var last = merged[merged.Count - 1];
+                    merged[merged.Count - 1] = (last.Start, Math.Max(last.End, range.End));
+                }
+                else
+                {
+                    merged.Add(range);
+                }
+            }
+            return merged;
+        }
+
+        /// <summary>
+        /// Returns true if the position lies in one of the sorted, non-overlapping ranges
+        /// </summary>
+        public static bool IsInRanges(List<(int Start, int End)> mergedRanges, int position)
+        {
+            int low = 0;
+            int high = mergedRanges.Count - 1;
+            while (low <= high)
+            {
+                int mid = low + ((high - low) >> 1);
+                if (position < mergedRanges[mid].Start)
+                    high = mid - 1;
+                else if (position >= mergedRanges[mid].End)
+                    low = mid + 1;
+                else
+                    return true;
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Returns the number of values in the sorted list that are smaller than the position
+        /// </summary>
+        public static int CountBefore(List<int> sortedPositions, int position)
+        {
+            int low = 0;
+            int high = sortedPositions.Count;
+            while (low < high)
+            {
+                int mid = low + ((high - low) >> 1);
+                if (sortedPositions[mid] < position)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return low;
+        }
+
+        private readonly struct SignatureSpan
+        {
+            public SignatureSpan(int start, int bodyStart, int bodyEnd)
+            {
+                Start = start;
+                BodyStart = bodyStart;
+                BodyEnd = bodyEnd;
+            }
+
+            public int Start { get; }
+            public int BodyStart { get; }
+            public int BodyEnd { get; }
+        }
+    }
+}
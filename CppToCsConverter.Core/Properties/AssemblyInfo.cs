@@ -1,3 +1,4 @@
 using System.Runtime.CompilerServices;
 
-[assembly: InternalsVisibleTo("CppToCsConverter.Tests")]
\ No newline at end of file
+[assembly: InternalsVisibleTo("CppToCsConverter.Tests")]
+[assembly: InternalsVisibleTo("CppToCsConverter.Benchmarks")]
\ No newline at end of file
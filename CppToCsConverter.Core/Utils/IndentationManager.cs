@@ -1,4 +1,5 @@
 using System;
+using System.Buffers;
 using System.Linq;
 using System.Text;
 using CppToCsConverter.Core.Models;
@@ -34,28 +35,126 @@ namespace CppToCsConverter.Core.Utils
         /// <returns>Number of leading spaces in the first non-empty line</returns>
         public static int DetectOriginalIndentation(string textBlock)
         {
-            if (string.IsNullOrEmpty(textBlock))
-                return 0;
+            return DetectOriginalIndentation(textBlock.AsSpan());
+        }
 
-            var lines = textBlock.Split(new[] { '\r', '\n' }, StringSplitOptions.RemoveEmptyEntries);
-            var firstNonEmptyLine = lines.FirstOrDefault(line => !string.IsNullOrWhiteSpace(line));
-            
-            if (firstNonEmptyLine == null)
-                return 0;
+        /// <summary>
+        /// Number of leading columns of the first non-blank line of a text block, counting a tab as 4 columns
+        /// </summary>
+        public static int DetectOriginalIndentation(ReadOnlySpan<char> textBlock)
+        {
+            while (!textBlock.IsEmpty)
+            {
+                int lineEnd = textBlock.IndexOfAny('\r', '\n');
+                var line = lineEnd < 0 ? textBlock : textBlock.Slice(0, lineEnd);
+                if (!line.IsWhiteSpace())
+                    return CountLeadingColumns(line);
+
+                textBlock = lineEnd < 0 ? ReadOnlySpan<char>.Empty : textBlock.Slice(lineEnd + 1);
+            }
+            return 0;
+        }
 
-            // Count leading spaces before first printable character
-            int leadingSpaces = 0;
-            foreach (char c in firstNonEmptyLine)
+        /// <summary>
+        /// Turns the raw text between a method's braces into the stored method body in one pass over the source text:
+        /// tabs become four spaces, the smallest indentation of the non-blank lines is removed from every line,
+        /// blank lines become empty, lines are joined with "\n" and leading and trailing whitespace is trimmed.
+        /// Only the result is allocated.
+        /// </summary>
+        public static string NormalizeMethodBody(ReadOnlySpan<char> rawBody)
+        {
+            if (rawBody.IsWhiteSpace())
+                return string.Empty;
+
+            // First pass: smallest indentation of the non-blank lines, and the number of tabs for the buffer size
+            int minIndentation = int.MaxValue;
+            int tabCount = 0;
+            for (var lines = new LineEnumerator(rawBody); lines.MoveNext();)
             {
-                if (c == ' ')
-                    leadingSpaces++;
-                else if (c == '\t')
-                    leadingSpaces += 4; // Convert tabs to spaces (standard 4-space tab)
-                else
-                    break;
+                var line = lines.Current;
+                if (!line.IsWhiteSpace())
+                {
+                    minIndentation = Math.Min(minIndentation, CountLeadingColumns(line));
+                }
+                tabCount += line.Count('\t');
             }
 
-            return leadingSpaces;
+            // Second pass: write each line with tabs expanded, skipping the common indentation
+            var buffer = ArrayPool<char>.Shared.Rent(rawBody.Length + tabCount * (IndentUnit.Length - 1));
+            try
+            {
+                int length = 0;
+                bool firstLine = true;
+                for (var lines = new LineEnumerator(rawBody); lines.MoveNext();)
+                {
+                    if (!firstLine)
+                    {
+                        buffer[length++] = '\n';
+                    }
+                    firstLine = false;
+
+                    var line = lines.Current;
+                    if (line.IsWhiteSpace())
+                        continue;
+
+                    int skip = minIndentation;
+                    foreach (var c in line)
+                    {
+                        int width = c == '\t' ? IndentUnit.Length : 1;
+                        int skipped = Math.Min(skip, width);
+                        skip -= skipped;
+                        for (int i = skipped; i < width; i++)
+                        {
+                            buffer[length++] = c == '\t' ? ' ' : c;
+                        }
+                    }
+                }
+
+                return new string(buffer.AsSpan(0, length).Trim());
+            }
+            finally
+            {
+                ArrayPool<char>.Shared.Return(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Appends a stored method body to the output in one pass: every line gets the target indentation plus its
+        /// indentation beyond <paramref name="originalIndentation"/>, blank lines become empty and runs of them
+        /// collapse to one. Lines are separated by "\n" (a "\r" also ends a line); nothing follows the last line.
+        /// </summary>
+        /// <param name="targetIndentation">Indentation of the body's outermost statements, e.g. 8 spaces for a class method</param>
+        public static void AppendReindentedMethodBody(StringBuilder sb, ReadOnlySpan<char> methodBody, int originalIndentation, string targetIndentation)
+        {
+            bool firstLine = true;
+            bool previousLineEmpty = false;
+            while (true)
+            {
+                int lineEnd = methodBody.IndexOfAny('\r', '\n');
+                var line = lineEnd < 0 ? methodBody : methodBody.Slice(0, lineEnd);
+
+                bool isEmpty = line.IsWhiteSpace();
+                if (!isEmpty || !previousLineEmpty)
+                {
+                    if (!firstLine)
+                    {
+                        sb.Append('\n');
+                    }
+                    firstLine = false;
+
+                    if (!isEmpty)
+                    {
+                        var trimmedLine = line.TrimStart(" \t");
+                        var relativeIndentation = Math.Max(0, line.Length - trimmedLine.Length - originalIndentation);
+                        sb.Append(targetIndentation).Append(' ', relativeIndentation).Append(trimmedLine);
+                    }
+                }
+                previousLineEmpty = isEmpty;
+
+                if (lineEnd < 0)
+                    break;
+                methodBody = methodBody.Slice(lineEnd + 1);
+            }
         }
 
         /// <summary>
@@ -138,47 +237,65 @@ namespace CppToCsConverter.Core.Utils
             if (string.IsNullOrEmpty(methodBody))
                 return string.Empty;
 
-            var reindented = ReindentBlock(methodBody, originalIndentation, Levels.MethodBody);
-            return CleanupMultipleEmptyLines(reindented);
+            var sb = new StringBuilder(methodBody.Length + 64);
+            AppendReindentedMethodBody(sb, methodBody, originalIndentation, GetIndentationForLevel(Levels.MethodBody));
+            return sb.ToString();
+        }
+
+        private static int CountLeadingColumns(ReadOnlySpan<char> line)
+        {
+            int columns = 0;
+            foreach (char c in line)
+            {
+                if (c == ' ')
+                    columns++;
+                else if (c == '\t')
+                    columns += IndentUnit.Length; // Tabs count as 4 spaces
+                else
+                    break;
+            }
+            return columns;
         }
-        
+
         /// <summary>
-        /// Removes excessive consecutive empty lines, keeping only single empty lines for readability
+        /// Enumerates the lines of a text as split by "\r\n", "\n" and "\r", without allocating
         /// </summary>
-        /// <param name="text">Text to clean up</param>
-        /// <returns>Cleaned up text with single empty lines</returns>
-        private static string CleanupMultipleEmptyLines(string text)
+        private ref struct LineEnumerator
         {
-            if (string.IsNullOrEmpty(text))
-                return string.Empty;
-                
-            var lines = text.Split(new[] { '\r', '\n' }, StringSplitOptions.None);
-            var cleanedLines = new List<string>();
-            var previousLineEmpty = false;
-            
-            foreach (var line in lines)
+            private ReadOnlySpan<char> _remaining;
+            private bool _done;
+
+            public LineEnumerator(ReadOnlySpan<char> text)
             {
-                var isCurrentLineEmpty = string.IsNullOrWhiteSpace(line);
-                
-                if (isCurrentLineEmpty)
+                _remaining = text;
+                _done = false;
+                Current = default;
+            }
+
+            public ReadOnlySpan<char> Current { get; private set; }
+
+            public bool MoveNext()
+            {
+                if (_done)
+                    return false;
+
+                int lineEnd = _remaining.IndexOfAny('\r', '\n');
+                if (lineEnd < 0)
                 {
-                    // Only keep empty line if previous line wasn't empty
-                    if (!previousLineEmpty)
-                    {
-                        cleanedLines.Add(string.Empty); // Add truly empty line
-                    }
-                    // Skip multiple consecutive empty lines
+                    Current = _remaining;
+                    _done = true;
+                    return true;
                 }
-                else
+
+                Current = _remaining.Slice(0, lineEnd);
+                int next = lineEnd + 1;
+                if (_remaining[lineEnd] == '\r' && next < _remaining.Length && _remaining[next] == '\n')
                 {
-                    // Non-empty line, add it as is
-                    cleanedLines.Add(line);
+                    next++;
                 }
-                
-                previousLineEmpty = isCurrentLineEmpty;
+                _remaining = _remaining.Slice(next);
+                return true;
             }
-            
-            return string.Join("\n", cleanedLines);
         }
 
         /// <summary>
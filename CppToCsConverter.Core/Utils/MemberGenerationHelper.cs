@@ -38,7 +38,7 @@ namespace CppToCsConverter.Core.Utils
             }
 
             // Handle preceding comments
-            if (member.PrecedingComments.Any())
+            if (member.PrecedingCommentsOrEmpty.Count > 0)
             {
                 foreach (var comment in member.PrecedingComments)
                 {
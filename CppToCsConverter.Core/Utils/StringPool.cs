@@ -0,0 +1,59 @@
+using System;
+using System.Threading;
+
+namespace CppToCsConverter.Core.Utils
+{
+    /// <summary>
+    /// Shares one instance of the short strings that repeat throughout a parsed model: method, class and
+    /// file names, return and parameter types. A large code base has a few thousand distinct ones among
+    /// hundreds of thousands of occurrences.
+    /// The pool is a fixed-size table indexed by hash, where a new string replaces whatever was in its slot,
+    /// so it never grows and needs no locks; a string that lost its slot is merely not shared. Safe for concurrent use.
+    /// </summary>
+    internal static class StringPool
+    {
+        // Longer strings rarely repeat and are not worth hashing
+        public const int MaxLength = 128;
+
+        private const int Size = 1 << 16;
+
+        private static readonly string?[] _entries = new string?[Size];
+
+        /// <summary>
+        /// Returns the pooled string equal to <paramref name="value"/>, creating and pooling it if there is none
+        /// </summary>
+        public static string Intern(ReadOnlySpan<char> value)
+        {
+            if (value.IsEmpty)
+                return string.Empty;
+            if (value.Length > MaxLength)
+                return new string(value);
+
+            ref var slot = ref _entries[string.GetHashCode(value) & (Size - 1)];
+            var entry = Volatile.Read(ref slot);
+            if (entry != null && value.SequenceEqual(entry))
+                return entry;
+
+            entry = new string(value);
+            Volatile.Write(ref slot, entry);
+            return entry;
+        }
+
+        /// <summary>
+        /// Returns the pooled string equal to <paramref name="value"/>, pooling <paramref name="value"/> itself if there is none
+        /// </summary>
+        public static string Intern(string value)
+        {
+            if (value == null || value.Length == 0 || value.Length > MaxLength)
+                return value!;
+
+            ref var slot = ref _entries[string.GetHashCode(value.AsSpan()) & (Size - 1)];
+            var entry = Volatile.Read(ref slot);
+            if (entry != null && string.Equals(entry, value, StringComparison.Ordinal))
+                return entry;
+
+            Volatile.Write(ref slot, value);
+            return value;
+        }
+    }
+}
@@ -0,0 +1,178 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Frozen;
+using System.Collections.Generic;
+using System.Threading;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Core.Utils
+{
+    /// <summary>
+    /// Memoized normalizations of type, return type and value spellings, shared by the parsers, the index and the
+    /// generators. They run on every parameter, member, return type and initializer, while a large code base only
+    /// has a few thousand distinct spellings, so each result is computed once per spelling and then looked up.
+    /// The caches are process wide and safe for concurrent use. Each holds a bounded number of entries; once full,
+    /// new spellings are computed on every call. <see cref="GetStatistics"/> gives the hits and misses of each cache.
+    /// </summary>
+    internal static class TypeNormalizer
+    {
+        private static readonly FrozenDictionary<string, string> NullLiterals = new Dictionary<string, string>
+        {
+            { "nullptr", "null" },
+            { "NULL", "null" },
+        }.ToFrozenDictionary(StringComparer.OrdinalIgnoreCase);
+
+        private static readonly MemoCache ParameterTypes = new MemoCache("ParameterTypes", ComputeParameterType);
+        private static readonly MemoCache OutputTypes = new MemoCache("OutputTypes", type => type.Replace(" *", "*").Replace(" &", "&"));
+        private static readonly MemoCache Values = new MemoCache("Values", ComputeValue);
+        private static readonly MemoCache ReturnTypes = new MemoCache("ReturnTypes", ComputeReturnType);
+        internal static readonly MemoCache Types = new MemoCache("Types", null);
+
+        private static readonly MemoCache[] Caches = { ParameterTypes, OutputTypes, Values, ReturnTypes, Types };
+
+        /// <summary>
+        /// Parameter type for comparing signatures: without spaces, const, &amp; and *, in lower case
+        /// </summary>
+        public static string NormalizeParameterType(string type) => ParameterTypes.Get(type);
+
+        /// <summary>
+        /// Type for C# output, with no space before * or &amp; ("Type *" becomes "Type*")
+        /// </summary>
+        public static string NormalizePointerSpacingForOutput(string type) => string.IsNullOrEmpty(type) ? type : OutputTypes.Get(type);
+
+        /// <summary>
+        /// C# value of a C++ initializer: "default" if there is none, null for nullptr and NULL, otherwise the value itself
+        /// </summary>
+        public static string ConvertCppToCsValue(string cppValue) => string.IsNullOrWhiteSpace(cppValue) ? "default" : Values.Get(cppValue);
+
+        /// <summary>
+        /// Return type of a declaration from the text before the method name: without a leading virtual or static,
+        /// and "void" for a constructor or destructor
+        /// </summary>
+        public static string ReturnTypeFromDeclarationPrefix(string beforeMethodName) => ReturnTypes.Get(beforeMethodName);
+
+        /// <summary>
+        /// The part of a declaration before its parameter list with no space before the * or &amp; of the return type
+        /// ("CItem *GetItem" becomes "CItem* GetItem"). Not memoized, since the text includes the method name;
+        /// a prefix without * or &amp;, the usual case, is returned as it is without running the pattern.
+        /// </summary>
+        public static string NormalizeDeclarationPrefix(string beforeParams)
+        {
+            return beforeParams.AsSpan().IndexOfAny('*', '&') < 0 ? beforeParams : CppPatterns.SpacedPointerReturnType().Replace(beforeParams, "$1$2 $3");
+        }
+
+        /// <summary>
+        /// Hits and misses of each cache since the process started
+        /// </summary>
+        public static (string Name, long Hits, long Misses)[] GetStatistics()
+        {
+            var statistics = new (string Name, long Hits, long Misses)[Caches.Length];
+            for (int i = 0; i < Caches.Length; i++)
+            {
+                statistics[i] = (Caches[i].Name, Caches[i].Hits, Caches[i].Misses);
+            }
+            return statistics;
+        }
+
+        private static string ComputeParameterType(string type)
+        {
+            return type.Trim()
+                .Replace(" ", "")           // Remove spaces
+                .Replace("const", "")       // Remove const keyword
+                .Replace("&", "")           // Remove reference
+                .Replace("*", "")           // Remove pointer
+                .ToLowerInvariant();        // Case insensitive comparison
+        }
+
+        private static string ComputeValue(string cppValue)
+        {
+            // Numbers, booleans, string and character literals, constants and enum values are kept as they are
+            var trimmed = cppValue.Trim();
+            return NullLiterals.TryGetValue(trimmed, out var csValue) ? csValue : trimmed;
+        }
+
+        private static string ComputeReturnType(string beforeMethodName)
+        {
+            // Remove modifiers to get the return type
+            beforeMethodName = CppPatterns.LeadingMethodModifier().Replace(beforeMethodName, "");
+            beforeMethodName = CppPatterns.LeadingMethodModifier().Replace(beforeMethodName, ""); // Handle both virtual and static
+
+            beforeMethodName = beforeMethodName.Trim();
+
+            // If nothing left, it's a constructor/destructor (no return type)
+            if (string.IsNullOrWhiteSpace(beforeMethodName) || beforeMethodName.StartsWith("~"))
+                return "void";
+
+            return beforeMethodName;
+        }
+
+        /// <summary>
+        /// Results of one normalization by spelling. Entries are never replaced, so a spelling gets the same string instance
+        /// every time. Hits and misses are counted in per-thread stripes, so parallel parses do not contend on one counter.
+        /// </summary>
+        internal sealed class MemoCache
+        {
+            // Longer spellings rarely repeat
+            private const int MaxKeyLength = 256;
+            private const int Capacity = 1 << 16;
+
+            // One counter per 64-byte cache line
+            private const int Stripes = 32;
+            private const int StripeWidth = 8;
+
+            private readonly ConcurrentDictionary<string, string> _entries = new ConcurrentDictionary<string, string>(StringComparer.Ordinal);
+            private readonly Func<string, string>? _compute;
+            private readonly long[] _hits = new long[Stripes * StripeWidth];
+            private readonly long[] _misses = new long[Stripes * StripeWidth];
+            private int _count;
+
+            public MemoCache(string name, Func<string, string>? compute)
+            {
+                Name = name;
+                _compute = compute;
+            }
+
+            public string Name { get; }
+            public long Hits => Sum(_hits);
+            public long Misses => Sum(_misses);
+            public int Count => Volatile.Read(ref _count);
+
+            public string Get(string key) => Get(key, _compute!);
+
+            /// <summary>
+            /// The cached result for the key, computing and adding it on a miss
+            /// </summary>
+            public string Get(string key, Func<string, string> compute)
+            {
+                var stripe = (Environment.CurrentManagedThreadId & (Stripes - 1)) * StripeWidth;
+                if (_entries.TryGetValue(key, out var value))
+                {
+                    Interlocked.Increment(ref _hits[stripe]);
+                    return value;
+                }
+
+                Interlocked.Increment(ref _misses[stripe]);
+                value = compute(key);
+                if (key.Length <= MaxKeyLength && Volatile.Read(ref _count) < Capacity)
+                {
+                    // Only the call that adds the entry counts it; a concurrent miss returns the instance already added
+                    if (_entries.TryAdd(key, value))
+                        Interlocked.Increment(ref _count);
+                    else if (_entries.TryGetValue(key, out var added))
+                        value = added;
+                }
+                return value;
+            }
+
+            private static long Sum(long[] counters)
+            {
+                long sum = 0;
+                for (int i = 0; i < counters.Length; i += StripeWidth)
+                {
+                    sum += Volatile.Read(ref counters[i]);
+                }
+                return sum;
+            }
+        }
+    }
+}
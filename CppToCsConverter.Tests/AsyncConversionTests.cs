@@ -0,0 +1,253 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for asynchronous conversion: progress events, cancellation and the per-file time budget
+    /// </summary>
+    public class AsyncConversionTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+
+        public AsyncConversionTests()
+        {
+            _tree = new TempSourceTree("TaskKit");
+
+            _tree.WriteFile("CTask.h", @"#pragma once
+
+class CTask
+{
+public:
+    void Run();
+    int GetState();
+
+private:
+    int m_nState;
+};
+");
+            _tree.WriteFile("CTask.cpp", @"#include ""CTask.h""
+
+void CTask::Run()
+{
+    m_nState = 1;
+}
+
+int CTask::GetState()
+{
+    return m_nState;
+}
+");
+            _tree.WriteFile("CQueue.h", @"#pragma once
+
+class CQueue
+{
+public:
+    bool IsEmpty();
+};
+");
+            _tree.WriteFile("CQueue.cpp", @"#include ""CQueue.h""
+
+bool CQueue::IsEmpty()
+{
+    return true;
+}
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public async Task ConvertDirectoryAsync_ReportsStagesFilesAndUnits()
+        {
+            // Arrange
+            var progress = new RecordingProgress();
+            var converter = new CppToCsStructuralConverter(new MockLogger());
+
+            // Act
+            await converter.ConvertDirectoryAsync(_tree.SourceDirectory, _tree.GetPath("Output"), progress);
+
+            // Assert
+            var events = progress.Events;
+            Assert.Equal(new[] { "Parse", "Link", "Generate" }, events.Where(e => e.Kind == ConversionProgressKind.StageStarted).Select(e => e.Stage).ToArray());
+            Assert.Equal(3, events.Count(e => e.Kind == ConversionProgressKind.StageCompleted));
+            var parsed = events.Where(e => e.Kind == ConversionProgressKind.FileParsed).ToList();
+            Assert.Equal(4, parsed.Count);
+            Assert.Equal(new[] { 1, 2, 3, 4 }, parsed.Select(e => e.Completed).ToArray());
+            Assert.All(parsed, e => Assert.Equal(4, e.Total));
+            Assert.Equal(new[] { "CQueue", "CTask" }, events.Where(e => e.Kind == ConversionProgressKind.UnitGenerated).Select(e => e.Name!).OrderBy(n => n, StringComparer.Ordinal).ToArray());
+            Assert.Empty(converter.LastMetrics!.Quarantined);
+        }
+
+        [Fact]
+        public async Task ConvertDirectoryAsync_Cancelled_ThrowsOperationCanceled()
+        {
+            // Arrange - cancel as soon as the first file is parsed
+            using var cancellation = new CancellationTokenSource();
+            var progress = new RecordingProgress(e =>
+            {
+                if (e.Kind == ConversionProgressKind.FileParsed)
+                    cancellation.Cancel();
+            });
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+            var outputDir = _tree.GetPath("Output");
+
+            // Act & Assert
+            await Assert.ThrowsAnyAsync<OperationCanceledException>(() => converter.ConvertDirectoryAsync(_tree.SourceDirectory, outputDir, progress, cancellation.Token));
+            Assert.DoesNotContain(progress.Events, e => e.Stage == "Generate");
+            Assert.False(File.Exists(Path.Combine(outputDir, "CTask.cs")));
+        }
+
+        [Fact]
+        public async Task ConvertDirectoryAsync_FileTimeBudgetExceeded_QuarantinesAndCompletes()
+        {
+            // Arrange - a large header cannot be parsed within a budget of one tick
+            WriteLargeHeader();
+            var progress = new RecordingProgress();
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { FileTimeBudget = TimeSpan.FromTicks(1) };
+
+            // Act
+            await converter.ConvertDirectoryAsync(_tree.SourceDirectory, _tree.GetPath("Output"), progress);
+
+            // Assert
+            var quarantined = converter.LastMetrics!.Quarantined;
+            Assert.Contains(quarantined, q => q.Stage == "Parse" && q.Name == Path.Combine(_tree.SourceDirectory, "CLarge.h"));
+            Assert.All(quarantined, q => Assert.Contains(q.Stage, new[] { "Parse", "Generate" }));
+            Assert.Equal(quarantined.Count, progress.Events.Count(e => e.Kind == ConversionProgressKind.Quarantined));
+            Assert.Equal(5, converter.LastMetrics.Files.Count);
+        }
+
+        [Fact]
+        public void ConvertDirectory_GenerousFileTimeBudget_OutputUnchanged()
+        {
+            // Arrange
+            var expectedDir = _tree.GetPath("Expected");
+            var outputDir = _tree.GetPath("Output");
+            new CppToCsStructuralConverter(new MockLogger()).ConvertDirectory(_tree.SourceDirectory, expectedDir);
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { FileTimeBudget = TimeSpan.FromMinutes(1) };
+
+            // Act
+            converter.ConvertDirectory(_tree.SourceDirectory, outputDir);
+
+            // Assert
+            AssertSameFiles(expectedDir, outputDir);
+            Assert.Empty(converter.LastMetrics!.Quarantined);
+        }
+
+        [Fact]
+        public void ConvertDirectory_IncrementalAfterQuarantine_RetriesQuarantinedFiles()
+        {
+            // Arrange
+            WriteLargeHeader();
+            var expectedDir = _tree.GetPath("Expected");
+            var outputDir = _tree.GetPath("Output");
+            new CppToCsStructuralConverter(new MockLogger()).ConvertDirectory(_tree.SourceDirectory, expectedDir);
+            new CppToCsStructuralConverter(new MockLogger()) { Incremental = true, FileTimeBudget = TimeSpan.FromTicks(1) }.ConvertDirectory(_tree.SourceDirectory, outputDir);
+
+            // Act
+            new CppToCsStructuralConverter(new MockLogger()) { Incremental = true }.ConvertDirectory(_tree.SourceDirectory, outputDir);
+
+            // Assert
+            AssertSameFiles(expectedDir, outputDir);
+        }
+
+        [Fact]
+        public async Task ConvertDirectory_QuarantinedParse_IsNotAddedToParseCache()
+        {
+            // Arrange
+            WriteLargeHeader();
+            var cacheDir = _tree.GetPath("Cache");
+            var outputDir = _tree.GetPath("Output");
+            var budgeted = new CppToCsStructuralConverter(new MockLogger()) { ParseCacheDirectory = cacheDir, FileTimeBudget = TimeSpan.FromTicks(1) };
+            budgeted.ConvertDirectory(_tree.SourceDirectory, outputDir);
+            Assert.Contains(budgeted.LastMetrics!.Quarantined, q => q.Name == Path.Combine(_tree.SourceDirectory, "CLarge.h"));
+
+            // Act - give the abandoned parse time to finish, then convert without a budget
+            await Task.Delay(TimeSpan.FromSeconds(1));
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { ParseCacheDirectory = cacheDir };
+            converter.ConvertDirectory(_tree.SourceDirectory, outputDir);
+
+            // Assert
+            var large = converter.LastMetrics!.Files.Single(f => f.Path == Path.Combine(_tree.SourceDirectory, "CLarge.h"));
+            Assert.False(large.FromCache);
+            Assert.True(large.Classes > 0);
+        }
+
+        [Fact]
+        public async Task GenerateFiles_QuarantinedUnit_HasEndedWhenEnumerationEnds()
+        {
+            // Arrange
+            WriteLargeHeader();
+            var headerFile = Path.Combine(_tree.SourceDirectory, "CLarge.h");
+            var logger = new MockLogger();
+            var converter = new CppToCsStructuralConverter(logger);
+            var model = converter.LinkParsedFiles(new[] { headerFile }, new[] { new CppHeaderParser(logger).ParseHeaderFile(headerFile) }, Array.Empty<string>(), Array.Empty<CppSourceFile?>());
+            converter.FileTimeBudget = TimeSpan.FromTicks(1);
+
+            // Act
+            var units = new List<string>();
+            await foreach (var (unitName, _) in converter.GenerateFilesAsync(model, _tree.GetPath("Output"), _tree.SourceDirectory, 1))
+            {
+                units.Add(unitName);
+            }
+            var warningCount = logger.WarningMessages.Count;
+            await Task.Delay(TimeSpan.FromMilliseconds(500));
+
+            // Assert - the generation of the quarantined unit logged its missing implementations before the enumeration ended
+            Assert.Empty(units);
+            Assert.Contains(logger.WarningMessages, m => m.Contains("exceeded the file time budget"));
+            Assert.True(warningCount > 1);
+            Assert.Equal(warningCount, logger.WarningMessages.Count);
+        }
+
+        private void WriteLargeHeader()
+        {
+            var methods = string.Concat(Enumerable.Range(0, 5000).Select(i => $"    int GetValue{i}(int nIndex, const char* pszName);\n"));
+            _tree.WriteFile("CLarge.h", "#pragma once\n\nclass CLarge\n{\npublic:\n" + methods + "};\n");
+        }
+
+        private static void AssertSameFiles(string expectedDir, string actualDir)
+        {
+            var expectedFiles = Directory.GetFiles(expectedDir, "*.cs").Select(f => Path.GetFileName(f)).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            var actualFiles = Directory.GetFiles(actualDir, "*.cs").Select(f => Path.GetFileName(f)).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            Assert.Equal(expectedFiles, actualFiles);
+            foreach (var file in expectedFiles)
+            {
+                Assert.Equal(File.ReadAllText(Path.Combine(expectedDir, file)), File.ReadAllText(Path.Combine(actualDir, file)));
+            }
+        }
+
+        /// <summary>
+        /// Records events as they are reported, unlike <see cref="Progress{T}"/> which posts them
+        /// </summary>
+        private class RecordingProgress : IProgress<ConversionProgress>
+        {
+            private readonly Action<ConversionProgress>? _onReport;
+
+            public RecordingProgress(Action<ConversionProgress>? onReport = null)
+            {
+                _onReport = onReport;
+            }
+
+            public List<ConversionProgress> Events { get; } = new List<ConversionProgress>();
+
+            public void Report(ConversionProgress value)
+            {
+                Events.Add(value);
+                _onReport?.Invoke(value);
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+using System.Text.RegularExpressions;
+using Xunit;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the per-file maps of comment blocks and region markers before declarations
+    /// </summary>
+    public class CommentBlockMapTests
+    {
+        [Fact]
+        public void GetPrecedingComments_SourceStyle_KeepsBlocksSeparatedByBlankLines()
+        {
+            // Arrange
+            var lines = new[]
+            {
+                "int x;",
+                "  // First",
+                "",
+                "  /* Second",
+                "     continued */",
+                "",
+                "void CSample::Run()"
+            };
+            var map = new CommentBlockMap(lines, CommentBlockStyle.Source);
+
+            // Act
+            var (comments, indentation) = map.GetPrecedingComments(6);
+
+            // Assert
+            Assert.Equal(new[] { "  // First", "", "  /* Second", "     continued */" }, comments.ToArray());
+            Assert.Equal(2, indentation);
+            Assert.Empty(map.GetPrecedingComments(1).comments);
+        }
+
+        [Fact]
+        public void GetPrecedingComments_HeaderStyle_StopsAtPostfixCommentAndRemovesIndentation()
+        {
+            // Arrange
+            var lines = new[]
+            {
+                "    int m_value; /* value */",
+                "    // Gets the value",
+                "    //   in full",
+                "    int GetValue();"
+            };
+            var map = new CommentBlockMap(lines, CommentBlockStyle.Header);
+
+            // Act
+            var (comments, indentation) = map.GetPrecedingComments(3);
+
+            // Assert
+            Assert.Equal(new[] { "// Gets the value", "//   in full" }, comments.ToArray());
+            Assert.Equal(4, indentation);
+        }
+
+        [Fact]
+        public void GetRegionMarkers_EndRegionOnlyBelongsToLastMethodInRegion()
+        {
+            // Arrange
+            var lines = new[]
+            {
+                "#pragma region Accessors",
+                "// Gets",
+                "int CSample::Get() {",
+                "    return 1; }",
+                "#pragma region Setters",
+                "void CSample::Set(int v) {",
+                "}",
+                "void CSample::Reset() {",
+                "}",
+                "#pragma endregion Setters"
+            };
+            var map = new SourceDeclarationMap(lines,
+                new Regex(@"^\s*#(?:pragma\s+)?(region|endregion)(?:\s+(.*))?$"),
+                new Regex(@"(?:(\w+(?:\s*\*|\s*&)?)\s+)?(\w+)\s*::\s*([~]?\w+)\s*\(([^)]*)\)(?:\s*(const))?\s*\{"));
+
+            // Act
+            var getLine = map.FindDeclarationLine("CSample", "Get");
+            var setLine = map.FindDeclarationLine("CSample", "Set");
+
+            // Assert
+            Assert.Equal(2, getLine);
+            Assert.Equal(("#region Accessors", ""), map.GetRegionMarkers(getLine));
+            Assert.Equal(("#region Setters", ""), map.GetRegionMarkers(setLine));
+            Assert.Equal(("", ""), map.GetRegionMarkers(map.FindDeclarationLine("CSample", "Reset")));
+            Assert.Equal(-1, map.FindDeclarationLine("CSample", "Missing"));
+        }
+    }
+}
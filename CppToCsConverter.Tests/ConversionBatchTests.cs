@@ -0,0 +1,170 @@
+using System;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for batch mode: job argument rules, job files and running several jobs in one process
+    /// </summary>
+    public class ConversionBatchTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+
+        public ConversionBatchTests()
+        {
+            _tree = new TempSourceTree();
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void Parse_SourceOnly_UsesDefaultOutputDirectory()
+        {
+            // Act
+            var job = ConversionJob.Parse(new[] { "src" });
+
+            // Assert
+            Assert.Equal(Path.Combine("src", ConversionJob.DefaultOutputDirectoryName), job.OutputDirectory);
+            Assert.Null(job.Files);
+        }
+
+        [Fact]
+        public void Parse_SecondArgument_IsFileListOrOutputDirectory()
+        {
+            // Act
+            var withFiles = ConversionJob.Parse(new[] { "src", "A.h, A.cpp" });
+            var withOutput = ConversionJob.Parse(new[] { "src", "out" });
+            var withBoth = ConversionJob.Parse(new[] { "src", "B.h", "out" });
+
+            // Assert
+            Assert.Equal(new[] { "A.h", "A.cpp" }, withFiles.Files!);
+            Assert.Equal(Path.Combine("src", ConversionJob.DefaultOutputDirectoryName), withFiles.OutputDirectory);
+            Assert.Null(withOutput.Files);
+            Assert.Equal("out", withOutput.OutputDirectory);
+            Assert.Equal(new[] { "B.h" }, withBoth.Files!);
+            Assert.Equal("out", withBoth.OutputDirectory);
+        }
+
+        [Fact]
+        public void LoadJobFile_QuotesAndComments_ParsesEachJobLine()
+        {
+            // Arrange
+            var jobFile = _tree.GetPath("jobs.txt");
+            File.WriteAllText(jobFile, "# Components\n\nCore out/Core\n  \"My Lib\" \"Lib A.h,Lib A.cpp\" \"out/My Lib\"\n");
+
+            // Act
+            var jobs = ConversionJob.LoadJobFile(jobFile);
+
+            // Assert
+            Assert.Equal(2, jobs.Count);
+            Assert.Equal("Core", jobs[0].SourceDirectory);
+            Assert.Equal("out/Core", jobs[0].OutputDirectory);
+            Assert.Equal("My Lib", jobs[1].SourceDirectory);
+            Assert.Equal(new[] { "Lib A.h", "Lib A.cpp" }, jobs[1].Files!);
+            Assert.Equal("out/My Lib", jobs[1].OutputDirectory);
+        }
+
+        [Fact]
+        public void LoadJobFile_UnterminatedQuote_ThrowsWithLineNumber()
+        {
+            // Arrange
+            var jobFile = _tree.GetPath("jobs.txt");
+            File.WriteAllText(jobFile, "Core\n\"Broken out\n");
+
+            // Act & Assert
+            var ex = Assert.Throws<FormatException>(() => ConversionJob.LoadJobFile(jobFile));
+            Assert.Contains("(2)", ex.Message);
+        }
+
+        [Fact]
+        public void Run_SeveralJobs_ConvertsEachIntoItsOutputAndReportsFailuresSeparately()
+        {
+            // Arrange
+            var first = CreateProject("First", "IFirst");
+            var second = CreateProject("Second", "ISecond");
+            var jobs = new[]
+            {
+                new ConversionJob { SourceDirectory = first, OutputDirectory = _tree.GetPath("Out", "First") },
+                new ConversionJob { SourceDirectory = _tree.GetPath("Missing"), OutputDirectory = _tree.GetPath("Out", "Missing") },
+                new ConversionJob { SourceDirectory = second, OutputDirectory = _tree.GetPath("Out", "Second") }
+            };
+            var logger = new MockLogger();
+            var batch = new ConversionBatch(logger) { MaxConcurrentJobs = 1, MaxDegreeOfParallelism = 1 };
+
+            // Act
+            var results = batch.Run(jobs);
+
+            // Assert
+            Assert.Equal(jobs, results.Select(r => r.Job).ToArray());
+            Assert.True(results[0].Succeeded);
+            Assert.False(results[1].Succeeded);
+            Assert.IsType<DirectoryNotFoundException>(results[1].Error);
+            Assert.True(results[2].Succeeded);
+            Assert.True(File.Exists(_tree.GetPath("Out", "First", "IFirst.cs")));
+            Assert.True(File.Exists(_tree.GetPath("Out", "Second", "ISecond.cs")));
+            Assert.Contains(logger.ErrorMessages, m => m.StartsWith("[Missing] "));
+        }
+
+        [Theory]
+        [InlineData(8, 2, 4, 500)]
+        [InlineData(8, 20, 1, 125)]
+        [InlineData(4, 1, 8, 1000)]
+        public void CreateJobConverter_SharesWorkersAndMemoryAmongConcurrentJobs(int maxConcurrentJobs, int jobCount, int expectedParallelism, long expectedBudget)
+        {
+            // Arrange
+            var batch = new ConversionBatch(new MockLogger()) { MaxConcurrentJobs = maxConcurrentJobs, MaxDegreeOfParallelism = 8, MemoryBudgetBytes = 1000 };
+            var job = new ConversionJob { SourceDirectory = _tree.SourceDirectory, OutputDirectory = _tree.GetPath("Out") };
+
+            // Act - the concurrent job count is what Run derives from the cap and the number of jobs
+            var converter = batch.CreateJobConverter(job, new MockLogger(), Math.Min(maxConcurrentJobs, jobCount));
+
+            // Assert
+            Assert.Equal(expectedParallelism, converter.MaxDegreeOfParallelism);
+            Assert.Equal(expectedBudget, converter.MemoryBudgetBytes);
+        }
+
+        [Fact]
+        public void Run_WithParseCache_GivesEachJobItsOwnCacheDirectory()
+        {
+            // Arrange
+            var first = CreateProject("First", "IFirst");
+            var second = CreateProject("Second", "ISecond");
+            var cacheDir = _tree.GetPath("Cache");
+            var batch = new ConversionBatch(new MockLogger()) { MaxConcurrentJobs = 1, MaxDegreeOfParallelism = 1, ParseCacheDirectory = cacheDir };
+
+            // Act
+            batch.Run(new[]
+            {
+                new ConversionJob { SourceDirectory = first, OutputDirectory = _tree.GetPath("Out", "First") },
+                new ConversionJob { SourceDirectory = second, OutputDirectory = _tree.GetPath("Out", "Second") }
+            });
+
+            // Assert
+            var jobCaches = Directory.GetDirectories(cacheDir).Select(Path.GetFileName).OrderBy(d => d, StringComparer.Ordinal).ToArray();
+            Assert.Equal(2, jobCaches.Length);
+            Assert.StartsWith("First-", jobCaches[0]);
+            Assert.StartsWith("Second-", jobCaches[1]);
+            Assert.Single(Directory.GetFiles(Path.Combine(cacheDir, jobCaches[0]!), "IFirst.h.*"));
+        }
+
+        private string CreateProject(string name, string interfaceName)
+        {
+            _tree.WriteFile(Path.Combine(name, interfaceName + ".h"), $@"#pragma once
+
+class __declspec(dllexport) {interfaceName}
+{{
+public:
+    virtual int GetValue() const = 0;
+}};
+");
+            return Path.Combine(_tree.SourceDirectory, name);
+        }
+    }
+}
@@ -0,0 +1,135 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the metrics report and the logger routing of the converter's output
+    /// </summary>
+    public class ConversionMetricsTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly string _outputDir;
+
+        public ConversionMetricsTests()
+        {
+            _tree = new TempSourceTree();
+            _outputDir = _tree.GetPath("Output");
+
+            _tree.WriteFile("CAlpha.h", @"#pragma once
+
+#define ALPHA_MAX 10
+
+class CAlpha
+{
+public:
+    int GetValue();
+    void SetValue(int value);
+};
+");
+            _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+#pragma region Accessors
+int CAlpha::GetValue()
+{
+    return 1;
+}
+
+void CAlpha::SetValue(int value)
+{
+}
+#pragma endregion
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void ConvertDirectory_RecordsStagesFilesAndUnits()
+        {
+            // Arrange
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+
+            // Act
+            converter.ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            var metrics = converter.LastMetrics;
+            Assert.NotNull(metrics);
+            Assert.Equal(new[] { "Parse", "Link", "Generate" }, metrics!.Stages.Select(s => s.Name).ToArray());
+
+            var header = metrics.Files.Single(f => f.Kind == "header");
+            Assert.Equal("CAlpha.h", Path.GetFileName(header.Path));
+            Assert.Equal(1, header.Classes);
+            Assert.Equal(2, header.Methods);
+            Assert.Equal(1, header.Defines);
+
+            var source = metrics.Files.Single(f => f.Kind == "source");
+            Assert.Equal(2, source.Methods);
+            Assert.Equal(2, source.Regions); // region and endregion markers
+            Assert.True(source.AllocatedBytes > 0);
+
+            Assert.Equal("CAlpha", Assert.Single(metrics.Units).Name);
+            Assert.True(metrics.TotalMilliseconds > 0);
+        }
+
+        [Fact]
+        public void ConvertDirectory_Incremental_RecordsHashStageAndOnlyParsedFiles()
+        {
+            // Arrange
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { Incremental = true, MaxDegreeOfParallelism = 1 };
+            converter.ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Act
+            converter.ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            var metrics = converter.LastMetrics!;
+            Assert.Equal("Hash", Assert.Single(metrics.Stages).Name);
+            Assert.Empty(metrics.Files);
+        }
+
+        [Fact]
+        public void Save_WritesStagesAndFilesAsJson()
+        {
+            // Arrange
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+            converter.ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            var path = _tree.GetPath("metrics.json");
+
+            // Act
+            converter.LastMetrics!.Save(path);
+
+            // Assert
+            using var document = JsonDocument.Parse(File.ReadAllText(path));
+            Assert.Equal(3, document.RootElement.GetProperty("Stages").GetArrayLength());
+            Assert.Equal(2, document.RootElement.GetProperty("Files").GetArrayLength());
+            Assert.Equal(4, document.RootElement.GetProperty("TotalMethods").GetInt32()); // declarations and implementations
+        }
+
+        [Fact]
+        public void ConvertDirectory_RoutesPerFileMessagesToDebug()
+        {
+            // Arrange
+            var logger = new MockLogger();
+            var converter = new CppToCsStructuralConverter(logger) { MaxDegreeOfParallelism = 1 };
+
+            // Act
+            converter.ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.Contains(logger.DebugMessages, m => m == "Parsing header: CAlpha.h");
+            Assert.DoesNotContain(logger.InfoMessages, m => m.StartsWith("Parsing"));
+            Assert.Contains(logger.InfoMessages, m => m.StartsWith("Conversion completed"));
+            Assert.Empty(logger.ErrorMessages);
+        }
+    }
+}
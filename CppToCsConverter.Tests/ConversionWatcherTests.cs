@@ -0,0 +1,149 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Logging;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for watch mode: the resident converter reconverts only what a file change affects
+    /// </summary>
+    public class ConversionWatcherTests : IDisposable
+    {
+        private static readonly TimeSpan Timeout = TimeSpan.FromSeconds(10);
+
+        private readonly TempSourceTree _tree;
+        private readonly string _outputDir;
+
+        public ConversionWatcherTests()
+        {
+            _tree = new TempSourceTree();
+            _outputDir = _tree.GetPath("Output");
+
+            _tree.WriteFile("CAlpha.h", @"#pragma once
+
+class CAlpha
+{
+public:
+    int GetValue();
+};
+");
+            _tree.WriteFile("CAlpha.cpp", CreateAlphaSource(1));
+            _tree.WriteFile("CBeta.h", @"#pragma once
+
+class CBeta
+{
+public:
+    bool IsReady() { return true; }
+};
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void Start_ConvertsTheTree()
+        {
+            // Arrange
+            using var watcher = CreateWatcher();
+
+            // Act
+            watcher.Start();
+
+            // Assert
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CAlpha.cs")));
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CBeta.cs")));
+        }
+
+        [Fact]
+        public async Task ChangedSource_ReparsesOnlyTheAffectedUnit()
+        {
+            // Arrange
+            using var watcher = CreateWatcher();
+            watcher.Start();
+            var converted = WaitForConversion(watcher);
+
+            // Act
+            _tree.WriteFile("CAlpha.cpp", CreateAlphaSource(2));
+            var metrics = await converted.WaitAsync(Timeout);
+
+            // Assert
+            Assert.Contains("return 2;", File.ReadAllText(Path.Combine(_outputDir, "CAlpha.cs")));
+            Assert.Equal(new[] { "CAlpha.cpp", "CAlpha.h" }, metrics.Files.Select(f => Path.GetFileName(f.Path)).OrderBy(f => f, StringComparer.Ordinal).ToArray());
+            Assert.Equal("CAlpha", Assert.Single(metrics.Units).Name);
+        }
+
+        [Fact]
+        public async Task CreatedHeader_IsConverted()
+        {
+            // Arrange
+            using var watcher = CreateWatcher();
+            watcher.Start();
+            var converted = WaitForConversion(watcher);
+
+            // Act
+            _tree.WriteFile("CGamma.h", @"#pragma once
+
+class CGamma
+{
+public:
+    int Count() { return 0; }
+};
+");
+            await converted.WaitAsync(Timeout);
+
+            // Assert
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CGamma.cs")));
+        }
+
+        [Fact]
+        public async Task FolderMovedOutOfTree_RemovesItsOutputs()
+        {
+            // Arrange
+            var folder = Path.Combine(_tree.SourceDirectory, "Gamma");
+            _tree.WriteFile(Path.Combine("Gamma", "CGamma.h"), "#pragma once\n\nclass CGamma\n{\npublic:\n    int Count() { return 0; }\n};\n");
+            using var watcher = CreateWatcher();
+            watcher.Start();
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CGamma.cs")));
+            var converted = WaitForConversion(watcher);
+
+            // Act - moving the folder raises an event for the folder only
+            Directory.Move(folder, _tree.GetPath("Gamma"));
+            await converted.WaitAsync(Timeout);
+
+            // Assert
+            Assert.False(File.Exists(Path.Combine(_outputDir, "CGamma.cs")));
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CAlpha.cs")));
+        }
+
+        private ConversionWatcher CreateWatcher()
+        {
+            var converter = new CppToCsStructuralConverter(new ConsoleLogger(LogVerbosity.Quiet));
+            return new ConversionWatcher(converter, _tree.SourceDirectory, _outputDir);
+        }
+
+        private static Task<ConversionMetrics> WaitForConversion(ConversionWatcher watcher)
+        {
+            var completion = new TaskCompletionSource<ConversionMetrics>(TaskCreationOptions.RunContinuationsAsynchronously);
+            watcher.Converted += (sender, metrics) => completion.TrySetResult(metrics);
+            return completion.Task;
+        }
+
+        private static string CreateAlphaSource(int value)
+        {
+            return $@"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{{
+    return {value};
+}}
+";
+        }
+    }
+}
@@ -0,0 +1,86 @@
+using System.Collections.Generic;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Models;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the index used to link header declarations with source implementations
+    /// </summary>
+    public class ImplementationIndexTests
+    {
+        [Fact]
+        public void FindImplementation_WithOverloads_MatchesNormalizedParameterTypes()
+        {
+            // Arrange
+            var intOverload = CreateMethod("CSample", "SetValue", "int");
+            var stringOverload = CreateMethod("CSample", "SetValue", "const CString&");
+            var index = CreateIndex(new Dictionary<string, List<CppMethod>>
+            {
+                ["CSample"] = new List<CppMethod> { intOverload, stringOverload }
+            });
+
+            // Act
+            var found = index.FindImplementation("CSample", CreateMethod("CSample", "SetValue", "CString"));
+
+            // Assert
+            Assert.Same(stringOverload, found);
+            Assert.Null(index.FindImplementation("CSample", CreateMethod("CSample", "SetValue", "double")));
+            Assert.Null(index.FindImplementation("COther", CreateMethod("COther", "SetValue", "int")));
+        }
+
+        [Fact]
+        public void FindImplementation_TemplateArgumentsWithCommas_DoNotMatchSeparateParameters()
+        {
+            // Arrange
+            var index = CreateIndex(new Dictionary<string, List<CppMethod>>
+            {
+                ["CSample"] = new List<CppMethod> { CreateMethod("CSample", "Load", "map<a", "b>") }
+            });
+
+            // Act
+            var found = index.FindImplementation("CSample", CreateMethod("CSample", "Load", "map<a,b>"));
+
+            // Assert
+            Assert.Null(found);
+        }
+
+        [Fact]
+        public void GetMethodsForClass_ReturnsMethodsInSourceFileOrder()
+        {
+            // Arrange
+            var first = CreateMethod("CSample", "First");
+            var second = CreateMethod("CSample", "Second");
+            var other = CreateMethod("COther", "Other");
+            var index = CreateIndex(new Dictionary<string, List<CppMethod>>
+            {
+                ["CSample"] = new List<CppMethod> { first, other },
+                ["CSampleMore"] = new List<CppMethod> { second }
+            });
+
+            // Act
+            var methods = index.GetMethodsForClass("CSample");
+
+            // Assert
+            Assert.Equal(new[] { first, second }, methods.ToArray());
+            Assert.Empty(index.GetMethodsForClass("CMissing"));
+        }
+
+        private static ImplementationIndex CreateIndex(Dictionary<string, List<CppMethod>> parsedSources)
+        {
+            return new ImplementationIndex(parsedSources, new Dictionary<string, List<CppClass>>());
+        }
+
+        private static CppMethod CreateMethod(string className, string name, params string[] parameterTypes)
+        {
+            return new CppMethod
+            {
+                ClassName = className,
+                Name = name,
+                Parameters = parameterTypes.Select((type, i) => new CppParameter { Type = type, Name = $"p{i}" }).ToList()
+            };
+        }
+    }
+}
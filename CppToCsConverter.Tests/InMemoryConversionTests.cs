@@ -0,0 +1,215 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CppToCsConverter.Core;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for in-memory conversion: content in, generated files out, with the same output as a conversion to disk
+    /// </summary>
+    public class InMemoryConversionTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly Dictionary<string, string> _inputs;
+
+        public InMemoryConversionTests()
+        {
+            _tree = new TempSourceTree("ShapeKit");
+
+            _inputs = new Dictionary<string, string>
+            {
+                [Path.Combine(_tree.SourceDirectory, "IShape.h")] = @"#pragma once
+
+#define SHAPE_MAX 10 // Upper bound
+
+class __declspec(dllexport) IShape
+{
+public:
+    virtual double Area() const = 0;
+    static IShape* Create(int nSides);
+};
+",
+                [Path.Combine(_tree.SourceDirectory, "CShape.h")] = @"#pragma once
+#include ""IShape.h""
+
+class CShape : public IShape
+{
+public:
+    CShape(int nSides);
+    double Area() const;
+    void Reset();
+
+private:
+    int m_nSides;
+};
+",
+                [Path.Combine(_tree.SourceDirectory, "CShape.cpp")] = @"#include ""CShape.h""
+
+CShape::CShape(int nSides)
+    : m_nSides(nSides)
+{
+}
+
+double CShape::Area() const
+{
+    return m_nSides;
+}
+
+IShape* IShape::Create(int nSides)
+{
+    return new CShape(nSides);
+}
+",
+                [Path.Combine(_tree.SourceDirectory, "CShapeExtra.cpp")] = @"#include ""CShape.h""
+
+void CShape::Reset()
+{
+    m_nSides = 0;
+}
+"
+            };
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public async Task ConvertInMemoryAsync_Text_ReturnsSameFilesAsConversionToDisk()
+        {
+            // Arrange
+            var outputDir = WriteInputsAndConvertToDisk();
+            var api = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+
+            // Act
+            var generatedFiles = await ToListAsync(api.ConvertInMemoryAsync(_inputs));
+
+            // Assert
+            Assert.Contains(generatedFiles, f => f.FilePath == "ShapeDefines.cs");
+            Assert.Contains(generatedFiles, f => f.FilePath == "CShapeExtra.cs");
+            AssertSameAsDisk(outputDir, generatedFiles);
+        }
+
+        [Fact]
+        public async Task ConvertInMemoryAsync_Streams_ReturnsSameFilesAsConversionToDisk()
+        {
+            // Arrange
+            var outputDir = WriteInputsAndConvertToDisk();
+            var api = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+            var streams = _inputs.Select(input => new KeyValuePair<string, Stream>(input.Key, new MemoryStream(Encoding.UTF8.GetBytes(input.Value)))).ToList();
+
+            // Act
+            var generatedFiles = await ToListAsync(api.ConvertInMemoryAsync(streams));
+
+            // Assert
+            AssertSameAsDisk(outputDir, generatedFiles);
+            Assert.All(streams, stream => Assert.True(stream.Value.CanRead));
+        }
+
+        [Fact]
+        public async Task ConvertInMemoryAsync_DoesNotWriteFiles()
+        {
+            // Arrange
+            var api = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+
+            // Act
+            var generatedFiles = await ToListAsync(api.ConvertInMemoryAsync(_inputs));
+
+            // Assert
+            Assert.NotEmpty(generatedFiles);
+            Assert.Empty(Directory.GetFileSystemEntries(_tree.SourceDirectory));
+            Assert.Contains(generatedFiles, f => f.FilePath == "CShape.cs" && f.Content.Contains("namespace U4.BatchNet.SK.Compatibility"));
+        }
+
+        [Fact]
+        public async Task ConvertInMemoryAsync_StoppedEarly_CanConvertAgain()
+        {
+            // Arrange
+            var api = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 2 };
+
+            // Act
+            GeneratedFile? first = null;
+            await foreach (var generatedFile in api.ConvertInMemoryAsync(_inputs))
+            {
+                first = generatedFile;
+                break;
+            }
+            var allFiles = await ToListAsync(api.ConvertInMemoryAsync(_inputs));
+
+            // Assert
+            Assert.Equal(allFiles[0].FilePath, first!.FilePath);
+            Assert.Equal(allFiles[0].Content, first.Content);
+        }
+
+        [Fact]
+        public async Task ConvertInMemoryAsync_Cancelled_Throws()
+        {
+            // Arrange
+            var api = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+            using var cancellation = new CancellationTokenSource();
+            cancellation.Cancel();
+
+            // Act & Assert
+            await Assert.ThrowsAnyAsync<OperationCanceledException>(() => ToListAsync(api.ConvertInMemoryAsync(_inputs, cancellation.Token)));
+        }
+
+        private string WriteInputsAndConvertToDisk()
+        {
+            var outputDir = _tree.GetPath("Output");
+            var diskSourceDir = _tree.GetPath("Disk", "ShapeKit");
+            Directory.CreateDirectory(diskSourceDir);
+            foreach (var input in _inputs)
+            {
+                File.WriteAllText(Path.Combine(diskSourceDir, Path.GetFileName(input.Key)), input.Value);
+            }
+
+            var converter = new CppToCsConverterApi(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+            converter.ConvertFiles(
+                _inputs.Keys.Where(k => k.EndsWith(".h")).Select(k => Path.Combine(diskSourceDir, Path.GetFileName(k))).ToArray(),
+                _inputs.Keys.Where(k => k.EndsWith(".cpp")).Select(k => Path.Combine(diskSourceDir, Path.GetFileName(k))).ToArray(),
+                outputDir);
+            return outputDir;
+        }
+
+        private static void AssertSameAsDisk(string outputDir, List<GeneratedFile> generatedFiles)
+        {
+            // Later files of the same name replace earlier ones, as on disk
+            var lastByName = new Dictionary<string, string>();
+            foreach (var generatedFile in generatedFiles)
+            {
+                lastByName[generatedFile.FilePath] = generatedFile.Content;
+            }
+
+            var diskFiles = Directory.GetFiles(outputDir, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            Assert.Equal(diskFiles, lastByName.Keys.OrderBy(f => f, StringComparer.Ordinal).ToArray());
+            foreach (var file in diskFiles)
+            {
+                Assert.Equal(NormalizeNewLines(File.ReadAllText(Path.Combine(outputDir, file!))), NormalizeNewLines(lastByName[file!]));
+            }
+        }
+
+        private static string NormalizeNewLines(string text)
+        {
+            return text.Replace("\r\n", "\n");
+        }
+
+        private static async Task<List<GeneratedFile>> ToListAsync(IAsyncEnumerable<GeneratedFile> generatedFiles)
+        {
+            var list = new List<GeneratedFile>();
+            await foreach (var generatedFile in generatedFiles)
+            {
+                list.Add(generatedFile);
+            }
+            return list;
+        }
+    }
+}
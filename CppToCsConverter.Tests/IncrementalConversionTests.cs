@@ -0,0 +1,176 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for incremental conversion driven by the content-hash manifest in the output directory
+    /// </summary>
+    public class IncrementalConversionTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly string _outputDir;
+
+        public IncrementalConversionTests()
+        {
+            _tree = new TempSourceTree("SourceIC");
+            _outputDir = _tree.GetPath("Output");
+
+            _tree.WriteFile("CAlpha.h", @"#pragma once
+
+class CAlpha
+{
+public:
+    int GetValue();
+    void SetValue(int nValue);
+
+private:
+    int m_nValue;
+};
+");
+            _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{
+    return m_nValue;
+}
+");
+            _tree.WriteFile("CAlphaSetters.cpp", @"#include ""CAlpha.h""
+
+void CAlpha::SetValue(int nValue)
+{
+    m_nValue = nValue;
+}
+");
+            _tree.WriteFile("CBeta.h", @"#pragma once
+
+class CBeta
+{
+public:
+    bool IsReady();
+};
+");
+            _tree.WriteFile("CBeta.cpp", @"#include ""CBeta.h""
+
+bool CBeta::IsReady()
+{
+    return true;
+}
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void ConvertDirectory_Incremental_WritesManifest()
+        {
+            // Act
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.True(File.Exists(Path.Combine(_outputDir, IncrementalManifest.ManifestFileName)));
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CAlpha.cs")));
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CAlphaSetters.cs")));
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CBeta.cs")));
+        }
+
+        [Fact]
+        public void ConvertDirectory_IncrementalWithoutChanges_DoesNotRewriteFiles()
+        {
+            // Arrange
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            var marker = new DateTime(2001, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            foreach (var file in Directory.GetFiles(_outputDir, "*.cs"))
+                File.SetLastWriteTimeUtc(file, marker);
+
+            // Act
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.All(Directory.GetFiles(_outputDir, "*.cs"), file => Assert.Equal(marker, File.GetLastWriteTimeUtc(file)));
+        }
+
+        [Fact]
+        public void ConvertDirectory_IncrementalAfterSourceChange_RegeneratesOnlyAffectedUnit()
+        {
+            // Arrange
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            var marker = new DateTime(2001, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            foreach (var file in Directory.GetFiles(_outputDir, "*.cs"))
+                File.SetLastWriteTimeUtc(file, marker);
+
+            _tree.WriteFile("CAlphaSetters.cpp", @"#include ""CAlpha.h""
+
+void CAlpha::SetValue(int nValue)
+{
+    m_nValue = nValue * 2;
+}
+");
+
+            // Act
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert - the unrelated unit is untouched, the changed one matches a full conversion
+            Assert.Equal(marker, File.GetLastWriteTimeUtc(Path.Combine(_outputDir, "CBeta.cs")));
+            Assert.Contains("m_nValue = nValue * 2;", File.ReadAllText(Path.Combine(_outputDir, "CAlphaSetters.cs")));
+            AssertMatchesFullConversion();
+        }
+
+        [Fact]
+        public void ConvertDirectory_IncrementalAfterHeaderRemoved_RemovesItsOutput()
+        {
+            // Arrange
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            File.Delete(Path.Combine(_tree.SourceDirectory, "CBeta.h"));
+            File.Delete(Path.Combine(_tree.SourceDirectory, "CBeta.cpp"));
+
+            // Act
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.False(File.Exists(Path.Combine(_outputDir, "CBeta.cs")));
+            AssertMatchesFullConversion();
+        }
+
+        [Fact]
+        public void ConvertDirectory_IncrementalAfterOutputDeleted_RegeneratesIt()
+        {
+            // Arrange
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            File.Delete(Path.Combine(_outputDir, "CBeta.cs"));
+
+            // Act
+            CreateConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.True(File.Exists(Path.Combine(_outputDir, "CBeta.cs")));
+            AssertMatchesFullConversion();
+        }
+
+        private static CppToCsStructuralConverter CreateConverter()
+        {
+            return new CppToCsStructuralConverter { Incremental = true };
+        }
+
+        private void AssertMatchesFullConversion()
+        {
+            var fullOutputDir = _tree.GetPath("FullOutput");
+            new CppToCsStructuralConverter().ConvertDirectory(_tree.SourceDirectory, fullOutputDir);
+
+            var expected = Directory.GetFiles(fullOutputDir, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToList();
+            var actual = Directory.GetFiles(_outputDir, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToList();
+            Assert.Equal(expected, actual);
+            foreach (var file in expected)
+            {
+                Assert.Equal(File.ReadAllText(Path.Combine(fullOutputDir, file!)), File.ReadAllText(Path.Combine(_outputDir, file!)));
+            }
+        }
+    }
+}
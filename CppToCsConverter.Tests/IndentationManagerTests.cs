@@ -1,4 +1,5 @@
 using System.Collections.Generic;
+using System.Text;
 using Xunit;
 using CppToCsConverter.Core.Utils;
 
@@ -306,5 +307,49 @@ namespace CppToCsConverter.Tests
             // Assert
             Assert.Equal(expected, result);
         }
+
+        [Theory]
+        [InlineData("\r\n    int x = 0;\r\n    if (x)\r\n        x++;\r\n", "int x = 0;\nif (x)\n    x++;")]
+        [InlineData("\n\tint x = 0;\n\t\n\tif (x)\n\t\tx++;\n", "int x = 0;\n\nif (x)\n    x++;")]
+        [InlineData("\n  \t return 1;\n      // note\n", "return 1;\n// note")]
+        [InlineData(" \r\n\t \n", "")]
+        [InlineData(" return 0; ", "return 0;")]
+        public void NormalizeMethodBody_RawBody_ExpandsTabsAndRemovesCommonIndentation(string rawBody, string expected)
+        {
+            // Act
+            var result = IndentationManager.NormalizeMethodBody(rawBody);
+
+            // Assert
+            Assert.Equal(expected, result);
+        }
+
+        [Fact]
+        public void AppendReindentedMethodBody_CollapsesEmptyLinesAndUsesTargetIndentation()
+        {
+            // Arrange
+            var sb = new StringBuilder("{\n");
+            var methodBody = "    int x = 0;\n\n   \n    if (x)\n        x++;";
+
+            // Act
+            IndentationManager.AppendReindentedMethodBody(sb, methodBody, 4, "            ");
+
+            // Assert
+            var expected = "{\n            int x = 0;\n\n            if (x)\n                x++;";
+            Assert.Equal(expected, sb.ToString());
+        }
+
+        [Fact]
+        public void AppendReindentedMethodBody_MethodBodyTarget_MatchesReindentMethodBody()
+        {
+            // Arrange
+            var methodBody = "if (x)\r\n{\r\n\r\n\tdoSomething();\r\n}\n\n\nreturn;";
+            var sb = new StringBuilder();
+
+            // Act
+            IndentationManager.AppendReindentedMethodBody(sb, methodBody, 0, IndentationManager.GetIndentationForLevel(IndentationManager.Levels.MethodBody));
+
+            // Assert
+            Assert.Equal(IndentationManager.ReindentMethodBody(methodBody, 0), sb.ToString());
+        }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,164 @@
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+
+namespace CppToCsConverter.Tests.Lexing;
+
+/// <summary>
+/// Tests for the shared C++ lexer and the parser behavior that depends on it
+/// </summary>
+public class CppLexerTests
+{
+    private readonly CppLexer _lexer = new CppLexer();
+
+    [Fact]
+    public void Tokenize_ScopeOperator_IsSingleToken()
+    {
+        var tokens = _lexer.Tokenize("void CFoo::Bar();");
+
+        var scopeIndex = Enumerable.Range(0, tokens.Count).Single(tokens.IsScopeOperator);
+        Assert.Equal("::", tokens.GetText(scopeIndex));
+        Assert.Equal("CFoo", tokens.GetText(scopeIndex - 1));
+        Assert.Equal("Bar", tokens.GetText(scopeIndex + 1));
+    }
+
+    [Fact]
+    public void Tokenize_BracesInCommentsAndLiterals_AreNotPunctuation()
+    {
+        var text = "{ // }\n  /* { */ s = \"}\"; c = '{'; r = R\"x(})x\"; }";
+
+        var tokens = _lexer.Tokenize(text);
+
+        var braces = Enumerable.Range(0, tokens.Count)
+            .Where(i => tokens.IsPunctuation(i, '{') || tokens.IsPunctuation(i, '}'))
+            .ToList();
+        Assert.Equal(2, braces.Count);
+        Assert.Equal(braces[1], tokens.GetMatchingBrace(braces[0]));
+        Assert.Equal(braces[0], tokens.GetMatchingBrace(braces[1]));
+        Assert.Equal(0, tokens[braces[0]].Depth);
+        Assert.Equal(0, tokens[braces[1]].Depth);
+    }
+
+    [Fact]
+    public void Tokenize_Parentheses_AreMatchedAndBoundariesFound()
+    {
+        var tokens = _lexer.Tokenize("f(g(\")\")), h(); x(");
+
+        var parentheses = Enumerable.Range(0, tokens.Count)
+            .Where(i => tokens.IsPunctuation(i, '(') || tokens.IsPunctuation(i, ')'))
+            .ToList();
+        Assert.Equal(7, parentheses.Count);
+        Assert.Equal(parentheses[3], tokens.GetMatchingParenthesis(parentheses[0]));
+        Assert.Equal(parentheses[2], tokens.GetMatchingParenthesis(parentheses[1]));
+        Assert.Equal(-1, tokens.GetMatchingParenthesis(parentheses[6]));
+        Assert.Equal(parentheses[2], tokens.FindNextCloseParenthesis(0));
+        Assert.Equal(tokens.Count, tokens.FindNextCloseParenthesis(parentheses[6]));
+
+        var semicolon = Enumerable.Range(0, tokens.Count).Single(i => tokens.IsPunctuation(i, ';'));
+        Assert.Equal(semicolon, tokens.FindNextStatementBoundary(0));
+        Assert.Equal(tokens.Count, tokens.FindNextStatementBoundary(semicolon + 1));
+    }
+
+    [Fact]
+    public void Tokenize_PreprocessorDirective_IsSingleTokenWithContinuation()
+    {
+        var tokens = _lexer.Tokenize("#define MAX(a, b) \\\n    ((a) > (b))\nint x;");
+
+        Assert.Equal(CppTokenKind.Preprocessor, tokens[0].Kind);
+        Assert.EndsWith("((a) > (b))", tokens.GetText(0));
+        Assert.True(tokens.IsIdentifier(1, "int"));
+        Assert.Equal(2, tokens[1].Line);
+    }
+
+    [Fact]
+    public void Tokenize_LineTable_MatchesLineSplit()
+    {
+        var text = "a\r\nb\rc\n\nd";
+
+        var tokens = _lexer.Tokenize(text);
+
+        Assert.Equal(text.Split(new[] { "\r\n", "\r", "\n" }, System.StringSplitOptions.None).Length, tokens.LineCount);
+        Assert.Equal(4, tokens.GetLineIndex(text.IndexOf('d')));
+        Assert.Equal(text.IndexOf('c'), tokens.GetLineStart(2));
+    }
+
+    [Fact]
+    public void CountCodeBraces_IgnoresBracesInCommentsAndStrings()
+    {
+        var (open, close) = CppLexer.CountCodeBraces("if (x) { Log(\"}\"); } // {");
+
+        Assert.Equal(1, open);
+        Assert.Equal(1, close);
+    }
+
+    [Fact]
+    public void ParseSourceFile_BracesInStringLiteral_ExtractsCompleteBody()
+    {
+        // Arrange
+        var sourceContent = @"
+void CSample::Write()
+{
+    Print(""}"");
+    Print(""done"");
+}
+
+int CSample::GetValue() const
+{
+    return 1; // }
+}";
+
+        var tempFile = Path.GetTempFileName();
+        File.WriteAllText(tempFile, sourceContent);
+
+        try
+        {
+            // Act
+            var (methods, _) = new CppSourceParser().ParseSourceFile(tempFile);
+
+            // Assert
+            Assert.Equal(2, methods.Count);
+            Assert.Contains("Print(\"done\");", methods[0].ImplementationBody);
+            Assert.Equal("GetValue", methods[1].Name);
+            Assert.True(methods[1].IsConst);
+            Assert.Equal("int", methods[1].ReturnType);
+        }
+        finally
+        {
+            File.Delete(tempFile);
+        }
+    }
+
+    [Fact]
+    public void ParseSourceFile_ConstructorWithInitializerList_IsFound()
+    {
+        // Arrange
+        var sourceContent = @"
+CSample::CSample(int nValue)
+    : m_nValue(nValue),
+      m_aItems{ 1, 2 }
+{
+    Init();
+}";
+
+        var tempFile = Path.GetTempFileName();
+        File.WriteAllText(tempFile, sourceContent);
+
+        try
+        {
+            // Act
+            var (methods, _) = new CppSourceParser().ParseSourceFile(tempFile);
+
+            // Assert
+            var constructor = Assert.Single(methods);
+            Assert.True(constructor.IsConstructor);
+            Assert.Single(constructor.Parameters);
+            Assert.Equal("Init();", constructor.ImplementationBody.Trim());
+        }
+        finally
+        {
+            File.Delete(tempFile);
+        }
+    }
+}
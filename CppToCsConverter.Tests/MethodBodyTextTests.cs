@@ -0,0 +1,79 @@
+using System;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Utils;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for method bodies kept as raw source text until they are read
+    /// </summary>
+    public class MethodBodyTextTests
+    {
+        [Fact]
+        public void ToString_RawBody_IsNormalizedBody()
+        {
+            // Arrange
+            var raw = "\r\n        int x = 1;\r\n        if (x)\r\n        {\r\n            x++;\r\n        }\r\n    ";
+            var body = MethodBodyText.FromRaw(("{" + raw + "}").AsMemory(1, raw.Length));
+
+            // Act
+            var text = body.ToString();
+
+            // Assert
+            Assert.Equal(IndentationManager.NormalizeMethodBody(raw), text);
+            Assert.False(body.IsEmpty);
+            Assert.True(MethodBodyText.FromRaw(" \r\n\t ".AsMemory()).IsEmpty);
+        }
+
+        [Theory]
+        [InlineData(false)]
+        [InlineData(true)]
+        public void CompactMethodBodies_KeepsBodyText(bool mostlyBodies)
+        {
+            // Arrange - a long comment inside a body makes the bodies most of the file, outside the bodies a small part
+            var comment = "    // " + new string('-', 2000) + "\r\n";
+            var filePath = Path.GetTempFileName();
+            File.WriteAllText(filePath, (mostlyBodies ? string.Empty : comment) + @"struct Point
+{
+    int x;
+};
+
+Point::Point()
+{
+    x = 0;
+}
+
+void CWidget::Draw()
+{
+" + (mostlyBodies ? comment : string.Empty) + @"    if (m_bVisible)
+    {
+        Paint();
+    }
+}
+");
+
+            try
+            {
+                var sourceFile = new CppSourceParser(new MockLogger()).ParseSourceFileComplete(filePath);
+                var methods = sourceFile.Methods.Concat(sourceFile.Structs.SelectMany(s => s.Methods)).ToList();
+                var bodies = methods.Select(m => (m.ImplementationBody, m.InlineImplementation)).ToList();
+
+                // Act
+                CppSourceParser.CompactMethodBodies(sourceFile);
+
+                // Assert
+                Assert.Equal(bodies, methods.Select(m => (m.ImplementationBody, m.InlineImplementation)).ToList());
+                Assert.Equal(mostlyBodies, methods.Any(m => m.ImplementationBodyText.RawLength > 0));
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+    }
+}
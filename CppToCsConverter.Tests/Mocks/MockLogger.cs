@@ -8,6 +8,7 @@ namespace CppToCsConverter.Tests.Mocks
         public List<string> ErrorMessages { get; } = new List<string>();
         public List<string> WarningMessages { get; } = new List<string>();
         public List<string> InfoMessages { get; } = new List<string>();
+        public List<string> DebugMessages { get; } = new List<string>();
 
         public void LogError(string message)
         {
@@ -23,5 +24,10 @@ namespace CppToCsConverter.Tests.Mocks
         {
             InfoMessages.Add(message);
         }
+
+        public void LogDebug(string message)
+        {
+            DebugMessages.Add(message);
+        }
     }
 }
\ No newline at end of file
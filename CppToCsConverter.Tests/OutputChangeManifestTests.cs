@@ -0,0 +1,112 @@
+using System;
+using System.Buffers;
+using System.IO;
+using System.Text;
+using Xunit;
+using CppToCsConverter.Core.Core;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for write-if-changed output and the change manifest written after every run
+    /// </summary>
+    public class OutputChangeManifestTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly string _outputDir;
+
+        public OutputChangeManifestTests()
+        {
+            _tree = new TempSourceTree();
+            _outputDir = _tree.GetPath("Output");
+
+            _tree.WriteFile("CAlpha.h", @"#pragma once
+
+class CAlpha
+{
+public:
+    int GetValue();
+};
+");
+            _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{
+    return 1;
+}
+");
+            _tree.WriteFile("CBeta.h", @"#pragma once
+
+class CBeta
+{
+public:
+    bool IsReady();
+};
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void ConvertDirectory_FirstRun_ListsAllFilesAsAdded()
+        {
+            // Act
+            new CppToCsStructuralConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            var changes = OutputChangeManifest.Load(_outputDir);
+            Assert.NotNull(changes);
+            Assert.Equal(new[] { "CAlpha.cs", "CBeta.cs" }, changes!.Added.ToArray());
+            Assert.Empty(changes.Changed);
+            Assert.Empty(changes.Unchanged);
+        }
+
+        [Fact]
+        public void ConvertDirectory_SecondRun_DoesNotRewriteUnchangedFiles()
+        {
+            // Arrange
+            new CppToCsStructuralConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+            var marker = new DateTime(2001, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            foreach (var file in Directory.GetFiles(_outputDir, "*.cs"))
+                File.SetLastWriteTimeUtc(file, marker);
+
+            _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{
+    return 2;
+}
+");
+
+            // Act
+            new CppToCsStructuralConverter().ConvertDirectory(_tree.SourceDirectory, _outputDir);
+
+            // Assert
+            Assert.Equal(marker, File.GetLastWriteTimeUtc(Path.Combine(_outputDir, "CBeta.cs")));
+            Assert.NotEqual(marker, File.GetLastWriteTimeUtc(Path.Combine(_outputDir, "CAlpha.cs")));
+            var changes = OutputChangeManifest.Load(_outputDir)!;
+            Assert.Equal(new[] { "CAlpha.cs" }, changes.Changed.ToArray());
+            Assert.Equal(new[] { "CBeta.cs" }, changes.Unchanged.ToArray());
+            Assert.Empty(changes.Added);
+        }
+
+        [Fact]
+        public void EncodeWithNormalizedNewLines_ConvertsLineBreaksToEnvironmentNewLine()
+        {
+            // Arrange
+            var content = "a\r\nb\nc\rdé\n";
+
+            // Act
+            var buffer = OutputFileWriter.EncodeWithNormalizedNewLines(content, out var length);
+            var encoded = Encoding.UTF8.GetString(buffer, 0, length);
+            ArrayPool<byte>.Shared.Return(buffer);
+
+            // Assert
+            var newLine = Environment.NewLine;
+            Assert.Equal($"a{newLine}b{newLine}c\rdé{newLine}", encoded);
+        }
+    }
+}
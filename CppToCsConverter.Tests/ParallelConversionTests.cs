@@ -0,0 +1,132 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests that the parallel conversion pipeline produces exactly the same files as a sequential run
+    /// </summary>
+    public class ParallelConversionTests
+    {
+        [Fact]
+        public void ConvertDirectory_ParallelAndSequential_ProduceIdenticalOutput()
+        {
+            // Arrange
+            var tempDir = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            var sourceDir = Path.Combine(tempDir, "SourceXY");
+            Directory.CreateDirectory(sourceDir);
+
+            try
+            {
+                File.WriteAllText(Path.Combine(sourceDir, "ISample.h"), @"#pragma once
+
+#define SAMPLE_MAX 10
+#define SAMPLE_NAME _T(""Sample"")
+
+class __declspec(dllexport) ISample
+{
+public:
+    virtual bool Run(int nCount) = 0;
+
+    static ISample* GetInstance();
+};
+");
+                File.WriteAllText(Path.Combine(sourceDir, "ISample.cpp"), @"#include ""ISample.h""
+
+ISample* ISample::GetInstance()
+{
+    return new CSample0();
+}
+");
+
+                // Enough classes to keep several workers busy, one of them split into partial files
+                for (int i = 0; i < 12; i++)
+                {
+                    File.WriteAllText(Path.Combine(sourceDir, $"CSample{i}.h"), $@"#pragma once
+#include ""ISample.h""
+
+class CSample{i} : public ISample
+{{
+public:
+    CSample{i}();
+    bool Run(int nCount);
+    int Compute(int nValue);
+
+private:
+    int m_nValue;
+}};
+");
+                    File.WriteAllText(Path.Combine(sourceDir, $"CSample{i}.cpp"), $@"#include ""CSample{i}.h""
+
+#define LOCAL_LIMIT_{i} {i}
+
+CSample{i}::CSample{i}()
+{{
+    m_nValue = {i};
+}}
+
+// Runs the sample
+bool CSample{i}::Run(int nCount)
+{{
+    for (int j = 0; j < nCount; j++)
+    {{
+        m_nValue += j;
+    }}
+    return m_nValue > LOCAL_LIMIT_{i};
+}}
+" + (i == 3 ? "" : $@"
+int CSample{i}::Compute(int nValue)
+{{
+    return nValue * {i};
+}}
+"));
+                }
+                File.WriteAllText(Path.Combine(sourceDir, "CSample3Compute.cpp"), @"#include ""CSample3.h""
+
+int CSample3::Compute(int nValue)
+{
+    return nValue * 3;
+}
+");
+
+                var sequentialOutput = Path.Combine(tempDir, "Sequential");
+                var parallelOutput = Path.Combine(tempDir, "Parallel");
+
+                // Act
+                new CppToCsStructuralConverter { MaxDegreeOfParallelism = 1 }.ConvertDirectory(sourceDir, sequentialOutput);
+                new CppToCsStructuralConverter { MaxDegreeOfParallelism = 8 }.ConvertDirectory(sourceDir, parallelOutput);
+
+                // Assert
+                var sequentialFiles = ReadOutputFiles(sequentialOutput);
+                var parallelFiles = ReadOutputFiles(parallelOutput);
+
+                Assert.Contains("SampleDefines.cs", sequentialFiles.Keys);
+                Assert.Contains("CSample3Compute.cs", sequentialFiles.Keys);
+                Assert.Equal(sequentialFiles.Keys, parallelFiles.Keys);
+                foreach (var file in sequentialFiles)
+                {
+                    Assert.True(file.Value.SequenceEqual(parallelFiles[file.Key]), $"{file.Key} differs between sequential and parallel conversion");
+                }
+            }
+            finally
+            {
+                if (Directory.Exists(tempDir))
+                    Directory.Delete(tempDir, true);
+            }
+        }
+
+        private static SortedDictionary<string, byte[]> ReadOutputFiles(string directory)
+        {
+            var files = new SortedDictionary<string, byte[]>(StringComparer.Ordinal);
+            foreach (var file in Directory.GetFiles(directory, "*.cs"))
+            {
+                files[Path.GetFileName(file)] = File.ReadAllBytes(file);
+            }
+            return files;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Text;
+using Xunit;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests that a large source file parsed in parallel chunks gives exactly the methods of a serial parse
+    /// </summary>
+    public class ParallelSourceParsingTests : IDisposable
+    {
+        private readonly string _tempFile;
+
+        public ParallelSourceParsingTests()
+        {
+            _tempFile = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName() + ".cpp");
+            File.WriteAllText(_tempFile, GenerateSource(40));
+        }
+
+        public void Dispose()
+        {
+            if (File.Exists(_tempFile))
+                File.Delete(_tempFile);
+        }
+
+        [Theory]
+        [InlineData(2)]
+        [InlineData(4)]
+        [InlineData(16)]
+        public void ParseSourceFileComplete_ParallelChunks_MatchSerialParse(int maxDegreeOfParallelism)
+        {
+            // Arrange
+            var serial = new CppSourceParser(new MockLogger()).ParseSourceFileComplete(_tempFile);
+            var parser = new CppSourceParser(new MockLogger()) { MaxDegreeOfParallelism = maxDegreeOfParallelism, ParallelParseMinLines = 1 };
+
+            // Act
+            var parallel = parser.ParseSourceFileComplete(_tempFile);
+
+            // Assert
+            Assert.Equal(40 * 4 + 7, serial.Methods.Count);
+            Assert.Equal(serial.Methods.Select(Describe).ToArray(), parallel.Methods.Select(Describe).ToArray());
+            Assert.Equal(serial.Regions.Select(r => $"{r.OrderIndex} {r.Text}").ToArray(), parallel.Regions.Select(r => $"{r.OrderIndex} {r.Text}").ToArray());
+        }
+
+        [Fact]
+        public void ParseSourceFileComplete_BelowLineThreshold_ParsesSerially()
+        {
+            // Arrange
+            var parser = new CppSourceParser(new MockLogger()) { MaxDegreeOfParallelism = 4 };
+
+            // Act
+            var sourceFile = parser.ParseSourceFileComplete(_tempFile);
+
+            // Assert
+            Assert.Equal(new CppSourceParser(new MockLogger()).ParseSourceFileComplete(_tempFile).Methods.Select(Describe).ToArray(), sourceFile.Methods.Select(Describe).ToArray());
+        }
+
+        [Fact]
+        public void SplitAtTopLevelBraces_EndsChunksAfterTopLevelClosingBraces()
+        {
+            // Arrange
+            var tokens = new CppLexer().Tokenize(File.ReadAllText(_tempFile));
+
+            // Act
+            var chunks = CppSourceParser.SplitAtTopLevelBraces(tokens, tokens.Count / 8);
+
+            // Assert - the chunks cover the tokens in order and each but the last ends at brace depth 0
+            Assert.True(chunks.Count > 4);
+            Assert.Equal(0, chunks[0].Start);
+            Assert.Equal(tokens.Count, chunks[^1].End);
+            for (int k = 0; k + 1 < chunks.Count; k++)
+            {
+                Assert.Equal(chunks[k].End, chunks[k + 1].Start);
+                Assert.True(tokens.IsPunctuation(chunks[k].End - 1, '}'));
+                Assert.Equal(0, BraceDepth(tokens, chunks[k].End));
+            }
+        }
+
+        private static int BraceDepth(CppTokenStream tokens, int end)
+        {
+            int depth = 0;
+            for (int i = 0; i < end; i++)
+            {
+                if (tokens.IsPunctuation(i, '{'))
+                    depth++;
+                else if (tokens.IsPunctuation(i, '}') && depth > 0)
+                    depth--;
+            }
+            return depth;
+        }
+
+        private static string Describe(CppMethod method)
+        {
+            var parameters = string.Join(", ", method.Parameters.Select(p => $"{p.Type} {p.Name} = {p.DefaultValue}"));
+            var comments = string.Join("|", method.SourceComments ?? Enumerable.Empty<string>());
+            return $"{method.OrderIndex} {method.ClassName}::{method.Name}({parameters}) {method.ReturnType} local={method.IsLocalMethod} " +
+                $"[{comments}] {method.SourceCommentIndentation} [{method.SourceRegionStart}] [{method.SourceRegionEnd}] {{{method.ImplementationBody}}}";
+        }
+
+        /// <summary>
+        /// A source file with regions, comments, overloaded local methods, brace initializers, lambdas, scoped calls
+        /// inside bodies and unbalanced braces, so chunk boundaries fall in places the serial scan skips over
+        /// </summary>
+        private static string GenerateSource(int classCount)
+        {
+            var source = new StringBuilder("#include \"CLarge.h\"\n\n");
+            source.Append("int Clamp(int nValue)\n{\n    return nValue < 0 ? 0 : nValue;\n}\n\n");
+            source.Append("int Clamp(int nValue, int nMax)\n{\n    return nValue > nMax ? nMax : Clamp(nValue);\n}\n\n");
+            for (int i = 0; i < classCount; i++)
+            {
+                source.Append($"#region Sample {i}\n\n");
+                source.Append($"// Creates sample {i}\nCSample{i}::CSample{i}()\n    : m_aLimits{{ {i}, {i + 1} }}, m_nValue({i})\n{{\n    if (CHelper::IsValid(m_nValue)) {{\n        m_nValue = Clamp({i});\n    }}\n}}\n\n");
+                source.Append($"/* Runs sample {i} */\nbool CSample{i}::Run(int nCount, const CString& sName = _T(\"x\"))\n{{\n    if (CHelper::IsValid(nCount)) {{\n        return true;\n    }}\n    return false;\n}}\n\n");
+                source.Append($"CSample{i}::~CSample{i}()\n{{\n}}\n\n");
+                source.Append($"int CSample{i}::Compute(int nValue) const\n{{\n    auto fn = [&](int n) {{ return n * {i}; }};\n    return fn(nValue);\n}}\n\n");
+                source.Append("#endregion\n\n");
+                if (i == classCount / 2)
+                {
+                    // Braces split by the preprocessor do not balance
+                    source.Append($"void CSample{i}::Check()\n{{\n#ifdef LEGACY\n    if (m_nValue) {{\n#else\n    if (m_nValue > 0) {{\n#endif\n        CHelper::Log(m_nValue);\n    }}\n}}\n\n");
+                }
+                if (i % 10 == 0)
+                {
+                    source.Append($"// Local helper {i}\nvoid Trace{i}(const char* pszText)\n{{\n    CLog::Write(pszText);\n}}\n\n");
+                }
+            }
+            return source.ToString();
+        }
+    }
+}
@@ -0,0 +1,87 @@
+using System;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Core.Parsers.ParameterParsing;
+
+namespace CppToCsConverter.Tests.ParameterParsing;
+
+/// <summary>
+/// Tests for CppParameterParser: the in-place parse of the default parser and the cache of parsed parameter lists.
+/// </summary>
+public class CppParameterParserTests
+{
+    private const string ParameterList = "\n        const TAttId& attId, // The attribute\n        /* in */ CAgrMT* pmtTable,\n        std::map<int, agrint> values = {},\n        agrint nIndex = Max(1, 2) /* optional */";
+
+    [Fact]
+    public void ParseParameters_DefaultParser_MatchesBlockSplitterAndComponentExtractor()
+    {
+        // Arrange
+        var blockParser = new CppParameterParser(new ParameterBlockSplitter(), new ParameterComponentExtractor());
+
+        // Act
+        var expected = blockParser.ParseParameters(ParameterList);
+        var result = new CppParameterParser().ParseParameters(ParameterList);
+
+        // Assert
+        Assert.Equal(4, result.Count);
+        Assert.Equal(expected.Select(Describe).ToArray(), result.Select(Describe).ToArray());
+    }
+
+    [Fact]
+    public void ParseParameters_SameTextTwice_ReturnsEqualNewParameters()
+    {
+        // Arrange
+        var parser = new CppParameterParser();
+        var first = parser.ParseParameters(ParameterList);
+
+        // Act
+        first[0].Name = "changed";
+        first[1].PositionedComments[0].CommentText = "changed";
+        first[3].InlineComments.Clear();
+        var second = parser.ParseParameters(ParameterList);
+
+        // Assert
+        Assert.Equal(4, second.Count);
+        Assert.NotSame(first[0], second[0]);
+        Assert.Equal("attId", second[0].Name);
+        Assert.Equal("/* in */", second[1].PositionedComments[0].CommentText);
+        Assert.Equal(CommentPosition.Prefix, second[1].PositionedComments[0].Position);
+        Assert.Equal(new[] { "/* optional */" }, second[3].InlineComments.ToArray());
+        Assert.Equal("Max(1, 2)", second[3].DefaultValue);
+    }
+
+    [Fact]
+    public void ParseParameters_TrailingCommentAfterComma_BelongsToPreviousParameter()
+    {
+        // Act
+        var result = new CppParameterParser().ParseParameters(ParameterList);
+
+        // Assert
+        Assert.Equal("TAttId", result[0].Type);
+        Assert.Equal("const TAttId &", result[0].CanonicalSignature);
+        Assert.Equal(new[] { "// The attribute" }, result[0].InlineComments.ToArray());
+        Assert.True(result[2].HasLineBreak);
+        Assert.Equal(8, result[2].OriginalIndent);
+        Assert.Equal("CAgrMT* pmtTable", result[1].OriginalText);
+    }
+
+    [Fact]
+    public void ParseParameters_DifferentLists_SharePooledStringsAndAllocateNoEmptyCommentLists()
+    {
+        // Act
+        var first = new CppParameterParser().ParseParameters("const TAttId& attId, agrint nIndex");
+        var second = new CppParameterParser().ParseParameters("agrint nCount, const TAttId &attId");
+
+        // Assert
+        Assert.Same(first[0].Type, second[1].Type);
+        Assert.Same(first[0].Name, second[1].Name);
+        Assert.Same(first[0].CanonicalSignature, second[1].CanonicalSignature);
+        Assert.Same(Array.Empty<string>(), first[0].InlineCommentsOrEmpty);
+        Assert.Same(Array.Empty<ParameterComment>(), second[1].PositionedCommentsOrEmpty);
+    }
+
+    private static string Describe(CppParameter p) =>
+        $"{p.Type}|{p.Name}|{p.DefaultValue}|{p.IsConst}{p.IsPointer}{p.IsReference}|{p.OriginalText}|{p.CanonicalSignature}|{p.HasLineBreak}{p.OriginalIndent}|" +
+        string.Join("~", p.PositionedComments.Select(c => c.Position + ":" + c.CommentText));
+}
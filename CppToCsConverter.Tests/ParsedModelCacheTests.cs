@@ -0,0 +1,240 @@
+using System;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Models;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the persistent parse cache: cached runs must load unchanged inputs and produce the same output as parsing
+    /// </summary>
+    public class ParsedModelCacheTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly string _cacheDir;
+
+        public ParsedModelCacheTests()
+        {
+            _tree = new TempSourceTree();
+            _cacheDir = _tree.GetPath("Cache");
+
+            _tree.WriteFile("IShape.h", @"#pragma once
+
+#define SHAPE_MAX 10 // Upper bound
+
+class __declspec(dllexport) IShape
+{
+public:
+    virtual double Area() const = 0;
+    static IShape* Create(int nSides /* sides */, const char* pszName = ""shape"");
+};
+");
+            _tree.WriteFile("CShape.h", @"#pragma once
+#include ""IShape.h""
+
+// A polygon
+class CShape : public IShape
+{
+public:
+    CShape(int nSides);
+    double Area() const;
+    int GetSides() { return m_nSides; }
+
+private:
+#pragma region Fields
+    int m_nSides; // Number of sides
+    static int s_aCounts[4];
+#pragma endregion
+};
+");
+            _tree.WriteFile("CShape.cpp", @"#include ""CShape.h""
+
+#define SHAPE_SCALE 2
+
+int CShape::s_aCounts[4] = { 0, 0, 0, 0 };
+
+struct Corner
+{
+    int x;
+    int y;
+};
+
+static int Twice(int nValue)
+{
+    return nValue * SHAPE_SCALE;
+}
+
+#pragma region Construction
+// Creates a shape
+CShape::CShape(int nSides)
+    : m_nSides(nSides)
+{
+}
+#pragma endregion
+
+double CShape::Area() const
+{
+    return Twice(m_nSides);
+}
+
+IShape* IShape::Create(int nSides, const char* pszName)
+{
+    return new CShape(nSides);
+}
+");
+            _tree.WriteFile("CShapeExtra.cpp", @"#include ""CShape.h""
+
+void CShape::Reset()
+{
+    m_nSides = 0;
+}
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void ConvertDirectory_WarmCache_LoadsEveryInputAndProducesIdenticalOutput()
+        {
+            // Arrange
+            var uncachedOutput = _tree.GetPath("Uncached");
+            var cachedOutput = _tree.GetPath("Cached");
+            CreateConverter(null).ConvertDirectory(_tree.SourceDirectory, uncachedOutput);
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Cold"));
+
+            // Act
+            var converter = CreateConverter(_cacheDir);
+            converter.ConvertDirectory(_tree.SourceDirectory, cachedOutput);
+
+            // Assert
+            var metrics = converter.LastMetrics!;
+            Assert.Equal(4, metrics.Files.Count);
+            Assert.All(metrics.Files, file => Assert.True(file.FromCache, file.Path));
+            AssertSameFiles(uncachedOutput, cachedOutput);
+        }
+
+        [Fact]
+        public void ConvertDirectory_ChangedInput_IsReparsedAndItsOldEntryRemoved()
+        {
+            // Arrange
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("First"));
+            var oldEntries = Directory.GetFiles(_cacheDir, "CShapeExtra.cpp.*");
+            _tree.WriteFile("CShapeExtra.cpp", @"#include ""CShape.h""
+
+void CShape::Reset()
+{
+    m_nSides = 3;
+}
+");
+
+            // Act
+            var converter = CreateConverter(_cacheDir);
+            converter.ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Second"));
+
+            // Assert
+            var parsed = Assert.Single(converter.LastMetrics!.Files, f => !f.FromCache);
+            Assert.Equal("CShapeExtra.cpp", Path.GetFileName(parsed.Path));
+            Assert.False(File.Exists(Assert.Single(oldEntries)));
+            Assert.Single(Directory.GetFiles(_cacheDir, "CShapeExtra.cpp.*"));
+            Assert.Contains("m_nSides = 3;", File.ReadAllText(_tree.GetPath("Second", "CShape.cs")));
+        }
+
+        [Fact]
+        public void LoadHeader_AfterConversion_ReturnsParsedClasses()
+        {
+            // Arrange
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Output"));
+            var cache = new ParsedModelCache(_cacheDir, new MockLogger());
+
+            // Act
+            var classes = cache.LoadHeader(Path.Combine(_tree.SourceDirectory, "CShape.h"));
+            var sourceFile = cache.LoadSource(Path.Combine(_tree.SourceDirectory, "CShape.cpp"));
+
+            // Assert
+            var cppClass = Assert.Single(classes!);
+            Assert.Equal("CShape", cppClass.Name);
+            Assert.Equal(new[] { "IShape" }, cppClass.BaseClasses.ToArray());
+            Assert.Equal("// Number of sides", cppClass.Members.Single(m => m.Name == "m_nSides").PostfixComment);
+            Assert.Contains(cppClass.Methods, m => m.Name == "GetSides" && m.HasInlineImplementation);
+            Assert.Contains(sourceFile!.Methods, m => m.ClassName == "IShape" && m.Name == "Create" && m.Parameters.Count == 2);
+            Assert.Contains(sourceFile.Structs, s => s.Name == "Corner");
+        }
+
+        [Fact]
+        public void LoadSource_EmptyCommentAndInitializerLists_AreNotAllocated()
+        {
+            // Arrange
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Output"));
+            var cache = new ParsedModelCache(_cacheDir, new MockLogger());
+
+            // Act
+            var sourceFile = cache.LoadSource(Path.Combine(_tree.SourceDirectory, "CShape.cpp"));
+
+            // Assert
+            var constructor = sourceFile!.Methods.Single(m => m.Name == "CShape");
+            var area = sourceFile.Methods.Single(m => m.Name == "Area");
+            Assert.Equal(new[] { "// Creates a shape" }, constructor.SourceComments.ToArray());
+            Assert.Same(Array.Empty<string>(), area.SourceCommentsOrEmpty);
+            Assert.Same(Array.Empty<string>(), area.HeaderCommentsOrEmpty);
+            Assert.Same(Array.Empty<CppMemberInitializer>(), area.MemberInitializerListOrEmpty);
+            Assert.Same(Array.Empty<ParameterComment>(), constructor.Parameters.Single().PositionedCommentsOrEmpty);
+        }
+
+        [Fact]
+        public void LoadHeader_ChangedContent_ReturnsNull()
+        {
+            // Arrange
+            var headerPath = Path.Combine(_tree.SourceDirectory, "CShape.h");
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Output"));
+            File.AppendAllText(headerPath, "// changed\n");
+
+            // Act
+            var classes = new ParsedModelCache(_cacheDir, new MockLogger()).LoadHeader(headerPath);
+
+            // Assert
+            Assert.Null(classes);
+        }
+
+        [Fact]
+        public void ConvertDirectory_CorruptEntry_IsReparsedWithWarning()
+        {
+            // Arrange
+            CreateConverter(_cacheDir).ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("First"));
+            var entry = Assert.Single(Directory.GetFiles(_cacheDir, "CShape.h.*"));
+            var bytes = File.ReadAllBytes(entry);
+            File.WriteAllBytes(entry, bytes.AsSpan(0, bytes.Length / 2).ToArray());
+            var logger = new MockLogger();
+
+            // Act
+            var converter = new CppToCsStructuralConverter(logger) { MaxDegreeOfParallelism = 1, ParseCacheDirectory = _cacheDir };
+            converter.ConvertDirectory(_tree.SourceDirectory, _tree.GetPath("Second"));
+
+            // Assert
+            Assert.Contains(logger.WarningMessages, m => m.Contains("unreadable parse cache entry"));
+            Assert.False(converter.LastMetrics!.Files.Single(f => Path.GetFileName(f.Path) == "CShape.h").FromCache);
+            Assert.Equal(bytes, File.ReadAllBytes(entry));
+        }
+
+        private static CppToCsStructuralConverter CreateConverter(string? cacheDirectory)
+        {
+            return new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1, ParseCacheDirectory = cacheDirectory };
+        }
+
+        private static void AssertSameFiles(string expectedDirectory, string actualDirectory)
+        {
+            var expectedFiles = Directory.GetFiles(expectedDirectory, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            var actualFiles = Directory.GetFiles(actualDirectory, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            Assert.Equal(expectedFiles, actualFiles);
+            foreach (var file in expectedFiles)
+            {
+                Assert.Equal(File.ReadAllText(Path.Combine(expectedDirectory, file!)), File.ReadAllText(Path.Combine(actualDirectory, file!)));
+            }
+        }
+    }
+}
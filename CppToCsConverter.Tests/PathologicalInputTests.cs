@@ -0,0 +1,120 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Text;
+using System.Text.RegularExpressions;
+using Xunit;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Malformed inputs that used to make the parser regexes backtrack for minutes must parse within a time budget
+    /// </summary>
+    public class PathologicalInputTests
+    {
+        private static readonly TimeSpan Budget = TimeSpan.FromSeconds(5);
+
+        [Fact]
+        public void ParseHeaderFile_UnclosedParameterList_ParsesWithinBudget()
+        {
+            // Arrange: 100,000 nested calls without a closing parenthesis; every "a(" used to rescan to the end of the line
+            var header = "#pragma once\n\nclass CBad\n{\npublic:\n    void F(" + string.Concat(Enumerable.Repeat("a(", 100_000)) + ";\n    int Get();\n};\n";
+            var filePath = WriteTempFile(header, ".h");
+
+            try
+            {
+                // Act
+                var stopwatch = Stopwatch.StartNew();
+                var classes = new CppHeaderParser(new MockLogger()).ParseHeaderFile(filePath);
+                stopwatch.Stop();
+
+                // Assert
+                Assert.True(stopwatch.Elapsed < Budget, $"Parsing took {stopwatch.Elapsed}");
+                var cppClass = Assert.Single(classes);
+                Assert.Contains(cppClass.Methods, m => m.Name == "Get");
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+
+        [Fact]
+        public void ParseHeaderFile_LongInlineBody_ParsesWithinBudget()
+        {
+            // Arrange: a single-line inline method with a very long body and unbalanced parentheses
+            var body = new StringBuilder();
+            for (int i = 0; i < 20_000; i++)
+            {
+                body.Append("x = f(g(h(");
+            }
+            var header = "#pragma once\n\nclass CBad\n{\npublic:\n    int Get() { " + body + " }\n    int Set(int value);\n};\n";
+            var filePath = WriteTempFile(header, ".h");
+
+            try
+            {
+                // Act
+                var stopwatch = Stopwatch.StartNew();
+                var classes = new CppHeaderParser(new MockLogger()).ParseHeaderFile(filePath);
+                stopwatch.Stop();
+
+                // Assert
+                Assert.True(stopwatch.Elapsed < Budget, $"Parsing took {stopwatch.Elapsed}");
+                Assert.Contains(Assert.Single(classes).Methods, m => m.Name == "Set");
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+
+        [Fact]
+        public void ParseSourceFile_UnclosedQualifiedCalls_ParsesWithinBudget()
+        {
+            // Arrange: "A::B(" repeated on a line inside a block; every occurrence used to rescan to the end of the line
+            var source = "#include \"CBad.h\"\n\nint CBad::Get()\n{\n    " + string.Concat(Enumerable.Repeat("A::B(", 50_000)) + " {\n    return 1;\n}\n";
+            var filePath = WriteTempFile(source, ".cpp");
+
+            try
+            {
+                // Act
+                var stopwatch = Stopwatch.StartNew();
+                var sourceFile = new CppSourceParser(new MockLogger()).ParseSourceFileComplete(filePath);
+                stopwatch.Stop();
+
+                // Assert
+                Assert.True(stopwatch.Elapsed < Budget, $"Parsing took {stopwatch.Elapsed}");
+                Assert.Contains(sourceFile.Methods, m => m.ClassName == "CBad" && m.Name == "Get");
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+
+        [Fact]
+        public void CppPatterns_AllHaveMatchTimeout()
+        {
+            // Act
+            var patterns = typeof(CppPatterns).GetMethods(BindingFlags.Public | BindingFlags.Static)
+                .Where(m => m.ReturnType == typeof(Regex))
+                .Select(m => (Regex)m.Invoke(null, null)!)
+                .ToList();
+
+            // Assert
+            Assert.NotEmpty(patterns);
+            Assert.All(patterns, regex => Assert.Equal(TimeSpan.FromMilliseconds(CppPatterns.MatchTimeoutMilliseconds), regex.MatchTimeout));
+        }
+
+        private static string WriteTempFile(string content, string extension)
+        {
+            var filePath = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName() + extension);
+            File.WriteAllText(filePath, content);
+            return filePath;
+        }
+    }
+}
@@ -0,0 +1,184 @@
+using System;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for converting specific files with their dependencies: only the inputs the listed files need are parsed,
+    /// and their output matches a conversion of the whole tree
+    /// </summary>
+    public class SelectiveConversionTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+
+        public SelectiveConversionTests()
+        {
+            _tree = new TempSourceTree("SelectKit");
+
+            // CAlpha uses the defines of the public interface IBeta, whose factory in Factories.cpp creates CBeta.
+            // CAlphaMore.cpp implements more of CAlpha. IDelta's defines class is named by every file; CGamma is unrelated.
+            _tree.WriteFile("CAlpha.h", @"#pragma once
+#include ""Public/IBeta.h""
+
+class CAlpha
+{
+public:
+    int GetValue();
+    void Reset();
+
+private:
+    int m_nValue;
+};
+");
+            _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{
+    return m_nValue + BETA_MAX;
+}
+");
+            _tree.WriteFile("CAlphaMore.cpp", @"#include ""CAlpha.h""
+
+void CAlpha::Reset()
+{
+    m_nValue = 0;
+}
+");
+            _tree.WriteFile(Path.Combine("Public", "IBeta.h"), @"#pragma once
+
+#define BETA_MAX 10
+
+class __declspec(dllexport) IBeta
+{
+public:
+    virtual void Run() = 0;
+    static IBeta* Create();
+};
+");
+            _tree.WriteFile("CBeta.h", @"#pragma once
+#include <IBeta.h>
+
+class CBeta : public IBeta
+{
+public:
+    void Run();
+};
+");
+            _tree.WriteFile("Factories.cpp", @"#include ""CBeta.h""
+
+IBeta* IBeta::Create()
+{
+    return new CBeta();
+}
+
+void CBeta::Run()
+{
+}
+");
+            _tree.WriteFile("IDelta.h", @"#pragma once
+
+#define DELTA_MIN 1
+
+class __declspec(dllexport) IDelta
+{
+public:
+    virtual void Stop() = 0;
+};
+");
+            _tree.WriteFile("CGamma.h", @"#pragma once
+
+class CGamma
+{
+public:
+    bool IsReady();
+};
+");
+            _tree.WriteFile("CGamma.cpp", @"#include ""CGamma.h""
+
+bool CGamma::IsReady()
+{
+    return true;
+}
+");
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Fact]
+        public void ConvertSpecificFiles_WithDependencies_MatchesConversionOfWholeTree()
+        {
+            // Arrange
+            var fullDir = _tree.GetPath("Full");
+            new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1 }.ConvertDirectory(_tree.SourceDirectory, fullDir);
+
+            // Act
+            var outputDir = Convert("CAlpha.h");
+
+            // Assert - CAlpha's files only, with the implementations from both sources and all defines classes
+            var files = Directory.GetFiles(outputDir, "*.cs").Select(f => Path.GetFileName(f)).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            Assert.Equal(new[] { "CAlpha.cs", "CAlphaMore.cs" }, files);
+            foreach (var file in files)
+            {
+                Assert.Equal(File.ReadAllText(Path.Combine(fullDir, file)), File.ReadAllText(Path.Combine(outputDir, file)));
+            }
+            Assert.Contains("BetaDefines;", File.ReadAllText(Path.Combine(outputDir, "CAlpha.cs")));
+            Assert.Contains("DeltaDefines;", File.ReadAllText(Path.Combine(outputDir, "CAlpha.cs")));
+        }
+
+        [Fact]
+        public void ConvertSpecificFiles_WithDependencies_ParsesOnlyNeededInputs()
+        {
+            // Arrange
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1, ResolveDependencies = true };
+
+            // Act
+            converter.ConvertSpecificFiles(_tree.SourceDirectory, new[] { "CAlpha.cpp" }, _tree.GetPath("Output"));
+
+            // Assert - the unit's header and sources and the headers with defines, not CBeta, CGamma or the factory
+            var parsedFiles = converter.LastMetrics!.Files.Select(f => Path.GetFileName(f.Path)).OrderBy(f => f, StringComparer.Ordinal).ToArray();
+            Assert.Equal(new[] { "CAlpha.cpp", "CAlpha.h", "CAlphaMore.cpp", "IBeta.h", "IDelta.h" }, parsedFiles);
+            Assert.Contains(converter.LastMetrics.Stages, s => s.Name == "Scan");
+        }
+
+        [Fact]
+        public void ConvertSpecificFiles_WithDependencies_ResolvesInterfaceFactory()
+        {
+            // Act
+            var outputDir = Convert(Path.Combine("Public", "IBeta.h"));
+
+            // Assert - the factory is implemented in a source of another name
+            Assert.Contains("[Create(typeof(CBeta))]", File.ReadAllText(Path.Combine(outputDir, "IBeta.cs")));
+            Assert.False(File.Exists(Path.Combine(outputDir, "CBeta.cs")));
+        }
+
+        [Fact]
+        public void ConvertSpecificFiles_WithoutDependencies_ConvertsListedFilesAlone()
+        {
+            // Arrange
+            var outputDir = _tree.GetPath("Alone");
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1 };
+
+            // Act
+            converter.ConvertSpecificFiles(_tree.SourceDirectory, new[] { "CAlpha.h" }, outputDir);
+
+            // Assert
+            Assert.Equal(1, converter.LastMetrics!.Files.Count);
+            Assert.DoesNotContain("BetaDefines", File.ReadAllText(Path.Combine(outputDir, "CAlpha.cs")));
+        }
+
+        private string Convert(string fileName)
+        {
+            var outputDir = _tree.GetPath("Output");
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1, ResolveDependencies = true };
+            converter.ConvertSpecificFiles(_tree.SourceDirectory, new[] { fileName }, outputDir);
+            return outputDir;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+using System;
+using System.IO;
+using System.Security.Cryptography;
+using System.Text;
+using Xunit;
+using CppToCsConverter.Core.Parsers;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the single-read file content shared by the parse stages
+    /// </summary>
+    public class SourceFileContentTests
+    {
+        [Fact]
+        public void Read_SplitsLinesLikeTheParsers()
+        {
+            // Arrange
+            var text = "// top\r\n\r\nclass A\n{\r};\n";
+            var filePath = Path.GetTempFileName();
+
+            try
+            {
+                File.WriteAllText(filePath, text, new UTF8Encoding(encoderShouldEmitUTF8Identifier: true));
+
+                // Act
+                var content = SourceFileContent.Read(filePath);
+
+                // Assert
+                Assert.Equal(text, content.Text);
+                Assert.Equal(text.Split(new[] { "\r\n", "\r", "\n" }, StringSplitOptions.None), content.Lines);
+                Assert.Equal(text.Split(new[] { '\r', '\n' }, StringSplitOptions.RemoveEmptyEntries), content.NonEmptyLines);
+                Assert.Same(content.Lines, content.Lines);
+                Assert.Equal(Convert.ToHexString(SHA256.HashData(File.ReadAllBytes(filePath))), content.Hash);
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+
+        [Fact]
+        public void Take_ReturnsContentReadByGetOnce()
+        {
+            // Arrange
+            var filePath = Path.GetTempFileName();
+
+            try
+            {
+                File.WriteAllText(filePath, "int x;");
+                var store = new FileContentStore();
+                var hashed = store.Get(filePath);
+                File.WriteAllText(filePath, "int y;");
+
+                // Act
+                var taken = store.Take(filePath);
+                var reread = store.Take(filePath);
+
+                // Assert
+                Assert.Same(hashed, taken);
+                Assert.Equal("int y;", reread.Text);
+            }
+            finally
+            {
+                File.Delete(filePath);
+            }
+        }
+    }
+}
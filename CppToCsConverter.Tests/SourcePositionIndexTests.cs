@@ -0,0 +1,87 @@
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the per-file position index used to order methods and exclude method bodies
+    /// </summary>
+    public class SourcePositionIndexTests
+    {
+        [Fact]
+        public void GetSignaturePosition_IgnoresOccurrencesInComments()
+        {
+            // Arrange
+            var content = "// See CSample::Run\nvoid CSample::Run()\n{\n}\n";
+            var index = new SourcePositionIndex(new CppLexer().Tokenize(content));
+
+            // Act
+            var position = index.GetSignaturePosition("CSample", "Run");
+
+            // Assert
+            Assert.Equal(content.IndexOf("CSample::Run()"), position);
+            Assert.Equal(-1, index.GetSignaturePosition("CSample", "Stop"));
+        }
+
+        [Fact]
+        public void TryGetBodyRange_ReturnsRangeOfMatchingBraces()
+        {
+            // Arrange
+            var content = "void CSample::Run()\n{\n    if (x) { y(); }\n}\nint z;";
+            var index = new SourcePositionIndex(new CppLexer().Tokenize(content));
+
+            // Act
+            var found = index.TryGetBodyRange("CSample", "Run", out var range);
+
+            // Assert
+            Assert.True(found);
+            Assert.Equal(content.IndexOf('{'), range.Start);
+            Assert.Equal(content.LastIndexOf('}') + 1, range.End);
+        }
+
+        [Fact]
+        public void IsInRanges_WithOverlappingRanges_UsesMergedRanges()
+        {
+            // Arrange
+            var ranges = SourcePositionIndex.MergeRanges(new List<(int Start, int End)> { (50, 60), (10, 40), (20, 30) });
+
+            // Assert
+            Assert.Equal(2, ranges.Count);
+            Assert.True(SourcePositionIndex.IsInRanges(ranges, 10));
+            Assert.True(SourcePositionIndex.IsInRanges(ranges, 35));
+            Assert.False(SourcePositionIndex.IsInRanges(ranges, 40));
+            Assert.True(SourcePositionIndex.IsInRanges(ranges, 59));
+            Assert.False(SourcePositionIndex.IsInRanges(ranges, 60));
+            Assert.Equal(1, SourcePositionIndex.CountBefore(new List<int> { 5, 10, 10, 20 }, 10));
+        }
+
+        [Fact]
+        public void ParseSourceFile_WithCrLfLineEndings_RegionPositionsMatchFile()
+        {
+            // Arrange
+            var sourceContent = "void CSample::First()\r\n{\r\n}\r\n\r\n#region Second\r\n\r\nvoid CSample::Second()\r\n{\r\n}\r\n\r\n#endregion\r\n";
+
+            var tempFile = Path.GetTempFileName();
+            File.WriteAllText(tempFile, sourceContent);
+
+            try
+            {
+                // Act
+                var sourceFile = new CppSourceParser().ParseSourceFileComplete(tempFile);
+
+                // Assert
+                Assert.Equal(sourceContent.IndexOf("#region"), sourceFile.Regions[0].OrderIndex);
+                Assert.Equal(sourceContent.IndexOf("#endregion"), sourceFile.Regions[1].OrderIndex);
+                Assert.Equal(sourceContent.IndexOf("CSample::Second"), sourceFile.Methods.Single(m => m.Name == "Second").OrderIndex);
+            }
+            finally
+            {
+                File.Delete(tempFile);
+            }
+        }
+    }
+}
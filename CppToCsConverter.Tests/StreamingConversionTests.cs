@@ -0,0 +1,233 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Parsers;
+using CppToCsConverter.Core.Parsers.Lexing;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for streaming conversion with a memory budget: groups of related files converted batch by batch
+    /// must give the same output as converting all files at once
+    /// </summary>
+    public class StreamingConversionTests : IDisposable
+    {
+        private readonly TempSourceTree _tree;
+        private readonly string[] _headerFiles;
+        private readonly string[] _sourceFiles;
+
+        public StreamingConversionTests()
+        {
+            _tree = new TempSourceTree("StreamKit");
+
+            // CAlpha.cpp implements a method of CDelta, so CAlpha.h and IBeta.h form one group.
+            // IBeta.h's public interface writes BetaDefines.cs, as does the earlier header BetaDefines.h.
+            _headerFiles = new[]
+            {
+                _tree.WriteFile("CAlpha.h", @"#pragma once
+
+class CAlpha
+{
+public:
+    int GetValue();
+
+private:
+    int m_nValue;
+};
+"),
+                _tree.WriteFile("BetaDefines.h", @"#pragma once
+
+class CBetaHolder
+{
+public:
+    void Hold();
+};
+"),
+                _tree.WriteFile("IBeta.h", @"#pragma once
+
+#define BETA_MAX 10
+
+class __declspec(dllexport) IBeta
+{
+public:
+    virtual void Run() = 0;
+    static IBeta* Create();
+};
+
+class CDelta : public IBeta
+{
+public:
+    void Run();
+};
+"),
+                _tree.WriteFile("CGamma.h", @"#pragma once
+
+class CGamma
+{
+public:
+    bool IsReady();
+};
+")
+            };
+            _sourceFiles = new[]
+            {
+                _tree.WriteFile("CAlpha.cpp", @"#include ""CAlpha.h""
+
+int CAlpha::GetValue()
+{
+    return m_nValue;
+}
+
+void CDelta::Run()
+{
+    m_nValue = 1;
+}
+"),
+                _tree.WriteFile("CDelta.cpp", @"#include ""IBeta.h""
+
+IBeta* IBeta::Create()
+{
+    return new CDelta();
+}
+"),
+                _tree.WriteFile("BetaDefines.cpp", @"#include ""BetaDefines.h""
+
+void CBetaHolder::Hold()
+{
+}
+"),
+                _tree.WriteFile("CGamma.cpp", @"#include ""CGamma.h""
+
+struct Pending
+{
+    int nCount;
+};
+
+bool CGamma::IsReady()
+{
+    return true;
+}
+"),
+                _tree.WriteFile("LocalOnly.cpp", @"struct Helper
+{
+    int nValue;
+};
+
+void CGamma::Reset()
+{
+}
+")
+            };
+        }
+
+        public void Dispose()
+        {
+            _tree.Dispose();
+        }
+
+        [Theory]
+        [InlineData(1L)]
+        [InlineData(64L * 1024)]
+        [InlineData(1024L * 1024 * 1024)]
+        public void ConvertFiles_WithMemoryBudget_MatchesConversionOfAllFilesAtOnce(long memoryBudgetBytes)
+        {
+            // Arrange
+            var expectedDir = Convert(null);
+
+            // Act
+            var actualDir = Convert(memoryBudgetBytes);
+
+            // Assert
+            AssertSameOutput(expectedDir, actualDir);
+        }
+
+        [Fact]
+        public void ConvertFiles_WithMemoryBudget_KeepsSharedFileOfTheLaterUnit()
+        {
+            // Act - each group is a batch of its own, and IBeta's group is converted before BetaDefines'
+            var outputDir = Convert(1);
+
+            // Assert - IBeta.h comes after BetaDefines.h, so its defines class is the BetaDefines.cs left behind
+            var content = File.ReadAllText(Path.Combine(outputDir, "BetaDefines.cs"));
+            Assert.Contains("BETA_MAX", content);
+            Assert.DoesNotContain("CBetaHolder", content);
+        }
+
+        [Fact]
+        public void ConvertFiles_WithMemoryBudget_ParsesEveryInputOnce()
+        {
+            // Arrange
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1, MemoryBudgetBytes = 1 };
+
+            // Act
+            converter.ConvertFiles(_headerFiles, _sourceFiles, _tree.GetPath("Output"), _tree.SourceDirectory);
+
+            // Assert
+            var metrics = converter.LastMetrics!;
+            Assert.Equal(_headerFiles.Length + _sourceFiles.Length, metrics.Files.Count);
+            Assert.Contains(metrics.Stages, s => s.Name == "Scan");
+        }
+
+        [Fact]
+        public void ScanDeclaredClassNames_FindsEveryClassTheHeaderParserFinds()
+        {
+            // Arrange - a typedef struct with and without a name, and a class mentioned in a block comment
+            var headerFiles = _headerFiles.Append(_tree.WriteFile("Records.h", @"#pragma once
+
+/*
+ * class CNote describes nothing
+ */
+typedef struct
+{
+    int nId;
+} RECORD;
+
+typedef struct
+{
+    int nFlags;
+};
+
+struct __declspec(dllexport) SPoint
+{
+    int x;
+};
+")).ToArray();
+            var parser = new CppHeaderParser(new MockLogger());
+            var lexer = new CppLexer();
+
+            foreach (var headerFile in headerFiles)
+            {
+                // Act
+                var scanned = CppToCsStructuralConverter.ScanDeclaredClassNames(headerFile, new FileContentStore(), lexer);
+
+                // Assert
+                var parsed = parser.ParseHeaderFile(headerFile).Select(c => c.Name).ToList();
+                Assert.NotEmpty(parsed);
+                Assert.All(parsed, name => Assert.Contains(name, scanned));
+            }
+        }
+
+        private string Convert(long? memoryBudgetBytes)
+        {
+            var outputDir = _tree.GetPath(memoryBudgetBytes.HasValue ? $"Output{memoryBudgetBytes}" : "Output");
+            var converter = new CppToCsStructuralConverter(new MockLogger()) { MaxDegreeOfParallelism = 1, MemoryBudgetBytes = memoryBudgetBytes };
+            converter.ConvertFiles(_headerFiles, _sourceFiles, outputDir, _tree.SourceDirectory);
+            return outputDir;
+        }
+
+        private static void AssertSameOutput(string expectedDir, string actualDir)
+        {
+            var expected = Directory.GetFiles(expectedDir, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToList();
+            var actual = Directory.GetFiles(actualDir, "*.cs").Select(Path.GetFileName).OrderBy(f => f, StringComparer.Ordinal).ToList();
+            Assert.Equal(expected, actual);
+            foreach (var file in expected)
+            {
+                Assert.Equal(File.ReadAllText(Path.Combine(expectedDir, file!)), File.ReadAllText(Path.Combine(actualDir, file!)));
+            }
+        }
+    }
+}
@@ -0,0 +1,47 @@
+using System;
+using Xunit;
+using CppToCsConverter.Core.Utils;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the string pool that shares repeated names and types of the parsed model
+    /// </summary>
+    public class StringPoolTests
+    {
+        [Fact]
+        public void Intern_EqualTextFromDifferentSources_ReturnsSameInstance()
+        {
+            // Act
+            var fromSpan = StringPool.Intern("(CPoolSample)".AsSpan(1, 11));
+            var fromString = StringPool.Intern(new string("CPoolSample".AsSpan()));
+
+            // Assert
+            Assert.Equal("CPoolSample", fromSpan);
+            Assert.Same(fromSpan, fromString);
+        }
+
+        [Fact]
+        public void Intern_EmptyText_ReturnsEmptyString()
+        {
+            // Act & Assert
+            Assert.Same(string.Empty, StringPool.Intern(ReadOnlySpan<char>.Empty));
+            Assert.Same(string.Empty, StringPool.Intern(string.Empty));
+        }
+
+        [Fact]
+        public void Intern_TextLongerThanMaxLength_IsNotPooled()
+        {
+            // Arrange
+            var text = new string('x', StringPool.MaxLength + 1);
+
+            // Act
+            var first = StringPool.Intern(text.AsSpan());
+            var second = StringPool.Intern(text.AsSpan());
+
+            // Assert
+            Assert.Equal(text, first);
+            Assert.NotSame(first, second);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+using System.Collections.Generic;
+using System.Linq;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Models;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the index of types built by the link stage
+    /// </summary>
+    public class SymbolIndexTests
+    {
+        [Fact]
+        public void GetFactoryCreatedClass_ResolvesClassConstructedByStaticFactory()
+        {
+            // Arrange
+            var direct = CreateInterface("ISample", "Create");
+            var viaPointer = CreateInterface("IOther", "GetInstance");
+            var noFactory = CreateInterface("IPlain", null);
+            var create = CreateMethod("ISample", "Create");
+            create.ImplementationBody = "{\n    return new CSample(nValue);\n}";
+            var getInstance = CreateMethod("IOther", "GetInstance");
+            getInstance.ImplementationBody = "{\n    IOther* pOther = new COther();\n    return pOther;\n}";
+            var index = CreateIndex(
+                new Dictionary<string, List<CppClass>> { ["ISample"] = new List<CppClass> { direct, viaPointer, noFactory } },
+                new Dictionary<string, List<CppMethod>> { ["Factories"] = new List<CppMethod> { create, getInstance } });
+
+            // Act & Assert
+            Assert.Equal("CSample", index.GetFactoryCreatedClass(direct));
+            Assert.Equal("COther", index.GetFactoryCreatedClass(viaPointer));
+            Assert.Null(index.GetFactoryCreatedClass(noFactory));
+        }
+
+        [Fact]
+        public void DefinesClasses_ListsPublicInterfacesWithDefinesOnce()
+        {
+            // Arrange
+            var first = CreateInterface("ISample", null);
+            first.HeaderDefines.Add(new CppDefine { Name = "MAX", Value = "1" });
+            var again = CreateInterface("ISample", null);
+            again.HeaderDefines.Add(new CppDefine { Name = "MIN", Value = "0" });
+            var internalInterface = CreateInterface("IHidden", null);
+            internalInterface.IsPublicExport = false;
+            internalInterface.HeaderDefines.Add(new CppDefine { Name = "SIZE", Value = "2" });
+
+            // Act
+            var index = CreateIndex(
+                new Dictionary<string, List<CppClass>>
+                {
+                    ["ISample"] = new List<CppClass> { first, internalInterface },
+                    ["ISampleCopy"] = new List<CppClass> { again }
+                },
+                new Dictionary<string, List<CppMethod>>());
+
+            // Assert
+            Assert.Equal(new[] { "SampleDefines" }, index.DefinesClasses.ToArray());
+            var redeclaration = Assert.Single(index.Redeclarations);
+            Assert.Equal(("ISample", "ISample", "ISampleCopy"), redeclaration);
+        }
+
+        private static SymbolIndex CreateIndex(Dictionary<string, List<CppClass>> headerFileClasses, Dictionary<string, List<CppMethod>> parsedSources)
+        {
+            return new SymbolIndex(headerFileClasses, new ImplementationIndex(parsedSources, headerFileClasses));
+        }
+
+        private static CppClass CreateInterface(string name, string? factoryName)
+        {
+            var cppInterface = new CppClass { Name = name, IsInterface = true, IsPublicExport = true };
+            if (factoryName != null)
+            {
+                cppInterface.Methods.Add(new CppMethod { ClassName = name, Name = factoryName, IsStatic = true, AccessSpecifier = AccessSpecifier.Public });
+            }
+            return cppInterface;
+        }
+
+        private static CppMethod CreateMethod(string className, string name)
+        {
+            return new CppMethod { ClassName = className, Name = name };
+        }
+    }
+}
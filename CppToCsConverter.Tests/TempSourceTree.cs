@@ -0,0 +1,51 @@
+using System;
+using System.IO;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// A source folder in a new temporary directory, for tests that convert files on disk.
+    /// Outputs, caches and other files of a test go next to it; the whole directory is deleted on dispose.
+    /// </summary>
+    public sealed class TempSourceTree : IDisposable
+    {
+        public TempSourceTree(string sourceFolderName = "Source")
+        {
+            Root = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            SourceDirectory = Path.Combine(Root, sourceFolderName);
+            Directory.CreateDirectory(SourceDirectory);
+        }
+
+        /// <summary>
+        /// The temporary directory holding the source folder
+        /// </summary>
+        public string Root { get; }
+
+        public string SourceDirectory { get; }
+
+        /// <summary>
+        /// Path of a file or folder in the temporary directory, next to the source folder
+        /// </summary>
+        public string GetPath(params string[] parts)
+        {
+            return Path.Combine(Root, Path.Combine(parts));
+        }
+
+        /// <summary>
+        /// Writes a file to the source folder, creating its subfolders, and returns its path
+        /// </summary>
+        public string WriteFile(string relativePath, string content)
+        {
+            var path = Path.Combine(SourceDirectory, relativePath);
+            Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+            File.WriteAllText(path, content);
+            return path;
+        }
+
+        public void Dispose()
+        {
+            if (Directory.Exists(Root))
+                Directory.Delete(Root, true);
+        }
+    }
+}
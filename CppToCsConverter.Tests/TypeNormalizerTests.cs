@@ -0,0 +1,148 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Threading.Tasks;
+using Xunit;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Generators;
+using CppToCsConverter.Core.Utils;
+using CppToCsConverter.Tests.Mocks;
+
+namespace CppToCsConverter.Tests
+{
+    /// <summary>
+    /// Tests for the memoized type and value normalizations
+    /// </summary>
+    public class TypeNormalizerTests
+    {
+        [Theory]
+        [InlineData(" const CString& ", "cstring")]
+        [InlineData("const char *", "char")]
+        [InlineData("CAgrMT * *", "cagrmt")]
+        [InlineData("unsigned int", "unsignedint")]
+        public void NormalizeParameterType_RemovesSpacesModifiersAndCase(string type, string expected)
+        {
+            // Act & Assert - the second lookup is answered from the cache with the same result
+            Assert.Equal(expected, TypeNormalizer.NormalizeParameterType(type));
+            Assert.Same(TypeNormalizer.NormalizeParameterType(type), TypeNormalizer.NormalizeParameterType(type));
+        }
+
+        [Fact]
+        public void NormalizePointerSpacingForOutput_RemovesSpaceBeforePointerAndReference()
+        {
+            // Act & Assert
+            Assert.Equal("CItem*", TypeNormalizer.NormalizePointerSpacingForOutput("CItem *"));
+            Assert.Equal("const CString&", TypeNormalizer.NormalizePointerSpacingForOutput("const CString &"));
+            Assert.Equal(string.Empty, TypeNormalizer.NormalizePointerSpacingForOutput(string.Empty));
+        }
+
+        [Fact]
+        public void ConvertCppToCsValue_MapsNullAndKeepsOtherValues()
+        {
+            // Act & Assert
+            Assert.Equal("default", TypeNormalizer.ConvertCppToCsValue("  "));
+            Assert.Equal("null", TypeNormalizer.ConvertCppToCsValue(" NULL"));
+            Assert.Equal("null", TypeNormalizer.ConvertCppToCsValue("nullptr"));
+            Assert.Equal("3.5", TypeNormalizer.ConvertCppToCsValue(" 3.5 "));
+            Assert.Equal("\"text\"", TypeNormalizer.ConvertCppToCsValue("\"text\""));
+            Assert.Equal("MAX_COUNT", TypeNormalizer.ConvertCppToCsValue("MAX_COUNT"));
+        }
+
+        [Fact]
+        public void ReturnTypeFromDeclarationPrefix_RemovesModifiers()
+        {
+            // Act & Assert
+            Assert.Equal("CString", TypeNormalizer.ReturnTypeFromDeclarationPrefix("virtual static CString"));
+            Assert.Equal("CItem *", TypeNormalizer.ReturnTypeFromDeclarationPrefix("static CItem *"));
+            Assert.Equal("void", TypeNormalizer.ReturnTypeFromDeclarationPrefix("static ~"));
+            Assert.Equal("void", TypeNormalizer.ReturnTypeFromDeclarationPrefix(string.Empty));
+        }
+
+        [Fact]
+        public void NormalizeDeclarationPrefix_WithoutPointer_ReturnsSameInstance()
+        {
+            // Arrange
+            var prefix = "    virtual CString GetName";
+
+            // Act & Assert
+            Assert.Same(prefix, TypeNormalizer.NormalizeDeclarationPrefix(prefix));
+            Assert.Equal("    virtual CItem* GetItem", TypeNormalizer.NormalizeDeclarationPrefix("    virtual CItem *GetItem"));
+        }
+
+        [Fact]
+        public void NormalizeParameterType_ParallelLookups_CountHitsAndAgree()
+        {
+            // Arrange
+            var types = Enumerable.Range(0, 50).Select(i => $"const CParallelType{i} &").ToArray();
+            var before = TypeNormalizer.GetStatistics().Single(s => s.Name == "ParameterTypes");
+
+            // Act
+            var results = new string[200][];
+            Parallel.For(0, results.Length, i => results[i] = types.Select(TypeNormalizer.NormalizeParameterType).ToArray());
+
+            // Assert - 50 misses at most, all other lookups hit, and every thread sees the same results
+            var after = TypeNormalizer.GetStatistics().Single(s => s.Name == "ParameterTypes");
+            Assert.True(after.Hits + after.Misses - before.Hits - before.Misses >= 200 * 50);
+            Assert.True(after.Hits - before.Hits >= 200 * 50 - 50 * Environment.ProcessorCount);
+            Assert.All(results, r => Assert.Equal(results[0], r));
+            Assert.Equal("cparalleltype7", results[0][7]);
+        }
+
+        [Fact]
+        public void MemoCache_ConcurrentMissesOnSameKeys_CountEachEntryOnce()
+        {
+            // Arrange
+            var cache = new TypeNormalizer.MemoCache("Test", key => key + "!");
+            var keys = Enumerable.Range(0, 10).Select(i => $"Key{i}").ToArray();
+
+            // Act
+            var results = new string[500][];
+            Parallel.For(0, results.Length, i => results[i] = keys.Select(cache.Get).ToArray());
+
+            // Assert - racing threads all get the instance that was added
+            Assert.Equal(keys.Length, cache.Count);
+            Assert.All(results, r => Assert.All(r.Zip(results[0]), p => Assert.Same(p.Second, p.First)));
+        }
+
+        [Fact]
+        public void ConvertType_CustomMappingAfterConversion_TakesEffect()
+        {
+            // Arrange
+            var converter = new TypeConverter();
+            Assert.Equal("CustomHandle", converter.ConvertType("CustomHandle"));
+
+            // Act
+            converter.AddCustomTypeMapping("CustomHandle", "IntPtr");
+
+            // Assert - the mapping applies to this converter only
+            Assert.Equal("IntPtr", converter.ConvertType("const CustomHandle*"));
+            Assert.Equal("CustomHandle", new TypeConverter().ConvertType("CustomHandle"));
+        }
+
+        [Fact]
+        public void ConvertDirectory_ReportsNormalizationCacheLookups()
+        {
+            // Arrange
+            var sourceDir = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName(), "NormKit");
+            Directory.CreateDirectory(sourceDir);
+            File.WriteAllText(Path.Combine(sourceDir, "CNorm.h"), "#pragma once\n\nclass CNorm\n{\npublic:\n    void Set(const CString& sName);\n    CItem *GetItem(int nIndex);\n};\n");
+            File.WriteAllText(Path.Combine(sourceDir, "CNorm.cpp"), "#include \"CNorm.h\"\n\nvoid CNorm::Set(const CString& sName)\n{\n}\n\nCItem* CNorm::GetItem(int nIndex)\n{\n    return NULL;\n}\n");
+            var converter = new CppToCsStructuralConverter(new MockLogger());
+
+            try
+            {
+                // Act
+                converter.ConvertDirectory(sourceDir, Path.Combine(sourceDir, "Output"));
+
+                // Assert
+                var caches = converter.LastMetrics!.NormalizationCaches;
+                Assert.Contains(caches, c => c.Name == "ParameterTypes" && c.Hits + c.Misses > 0);
+                Assert.Contains(caches, c => c.Name == "OutputTypes" && c.Hits + c.Misses > 0);
+            }
+            finally
+            {
+                Directory.Delete(Path.GetDirectoryName(sourceDir)!, true);
+            }
+        }
+    }
+}
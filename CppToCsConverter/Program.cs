@@ -1,8 +1,12 @@
 using System;
 using System.IO;
 using System.Collections.Generic;
+using System.Globalization;
 using System.Linq;
+using System.Threading;
 using CppToCsConverter.Core;
+using CppToCsConverter.Core.Core;
+using CppToCsConverter.Core.Logging;
 
 namespace CppToCsConverter
 {
@@ -13,55 +17,169 @@ namespace CppToCsConverter
             Console.WriteLine("C++ to C# Structural Converter");
             Console.WriteLine("==============================");
 
+            // Extract options; the remaining arguments are positional
+            int? maxParallelism = null;
+            bool incremental = false;
+            bool watch = false;
+            var verbosity = LogVerbosity.Normal;
+            string? metricsPath = null;
+            string? parseCacheDirectory = null;
+            string? batchFile = null;
+            int? maxConcurrentJobs = null;
+            long? memoryBudgetBytes = null;
+            bool withDependencies = false;
+            TimeSpan? fileTimeBudget = null;
+            var positionalArgs = new List<string>();
+            for (int i = 0; i < args.Length; i++)
+            {
+                if (args[i] == "--max-parallelism")
+                {
+                    if (i + 1 >= args.Length || !int.TryParse(args[i + 1], out var value) || value < 1)
+                    {
+                        Console.WriteLine("Error: --max-parallelism requires a positive integer value.");
+                        return;
+                    }
+                    maxParallelism = value;
+                    i++;
+                }
+                else if (args[i] == "--incremental")
+                {
+                    incremental = true;
+                }
+                else if (args[i] == "--watch")
+                {
+                    watch = true;
+                }
+                else if (args[i] == "--verbosity")
+                {
+                    if (i + 1 >= args.Length || !Enum.TryParse(args[i + 1], true, out verbosity) || !Enum.IsDefined(verbosity))
+                    {
+                        Console.WriteLine("Error: --verbosity requires one of: quiet, normal, detailed.");
+                        return;
+                    }
+                    i++;
+                }
+                else if (args[i] == "--metrics")
+                {
+                    if (i + 1 >= args.Length)
+                    {
+                        Console.WriteLine("Error: --metrics requires an output file path.");
+                        return;
+                    }
+                    metricsPath = args[i + 1];
+                    i++;
+                }
+                else if (args[i] == "--parse-cache")
+                {
+                    if (i + 1 >= args.Length)
+                    {
+                        Console.WriteLine("Error: --parse-cache requires a directory path.");
+                        return;
+                    }
+                    parseCacheDirectory = args[i + 1];
+                    i++;
+                }
+                else if (args[i] == "--batch")
+                {
+                    if (i + 1 >= args.Length)
+                    {
+                        Console.WriteLine("Error: --batch requires a job file path.");
+                        return;
+                    }
+                    batchFile = args[i + 1];
+                    i++;
+                }
+                else if (args[i] == "--max-concurrent-jobs")
+                {
+                    if (i + 1 >= args.Length || !int.TryParse(args[i + 1], out var value) || value < 1)
+                    {
+                        Console.WriteLine("Error: --max-concurrent-jobs requires a positive integer value.");
+                        return;
+                    }
+                    maxConcurrentJobs = value;
+                    i++;
+                }
+                else if (args[i] == "--memory-budget")
+                {
+                    if (i + 1 >= args.Length || !long.TryParse(args[i + 1], out var value) || value < 1)
+                    {
+                        Console.WriteLine("Error: --memory-budget requires a positive number of megabytes.");
+                        return;
+                    }
+                    memoryBudgetBytes = value * 1024 * 1024;
+                    i++;
+                }
+                else if (args[i] == "--with-dependencies")
+                {
+                    withDependencies = true;
+                }
+                else if (args[i] == "--file-time-budget")
+                {
+                    if (i + 1 >= args.Length || !double.TryParse(args[i + 1], NumberStyles.Float, CultureInfo.InvariantCulture, out var value) || value <= 0)
+                    {
+                        Console.WriteLine("Error: --file-time-budget requires a positive number of seconds.");
+                        return;
+                    }
+                    fileTimeBudget = TimeSpan.FromSeconds(value);
+                    i++;
+                }
+                else
+                {
+                    positionalArgs.Add(args[i]);
+                }
+            }
+            args = positionalArgs.ToArray();
+
+            if (batchFile != null)
+            {
+                if (args.Length > 0 || watch)
+                {
+                    Console.WriteLine("Error: --batch takes its jobs from the job file and cannot be combined with a source directory or --watch.");
+                    return;
+                }
+                RunBatch(batchFile, maxConcurrentJobs, maxParallelism, incremental, parseCacheDirectory, memoryBudgetBytes, withDependencies, fileTimeBudget, verbosity, metricsPath);
+                return;
+            }
+
             if (args.Length < 1)
             {
                 Console.WriteLine("Usage:");
-                Console.WriteLine("  CppToCsConverter <source_directory> [output_directory]");
-                Console.WriteLine("  CppToCsConverter <source_directory> <file1,file2,...> [output_directory]");
+                Console.WriteLine("  CppToCsConverter [options] <source_directory> [output_directory]");
+                Console.WriteLine("  CppToCsConverter [options] <source_directory> <file1,file2,...> [output_directory]");
+                Console.WriteLine("  CppToCsConverter [options] --batch <job_file>");
+                Console.WriteLine();
+                Console.WriteLine("Options:");
+                Console.WriteLine("  --max-parallelism <n>   Maximum number of files processed concurrently (default: processor count, 1 = sequential)");
+                Console.WriteLine("  --incremental           Only regenerate output affected by inputs changed since the last incremental run");
+                Console.WriteLine("  --watch                 Stay running and reconvert changed files until Ctrl+C (directories only)");
+                Console.WriteLine("  --verbosity <level>     quiet, normal (default) or detailed console output");
+                Console.WriteLine("  --metrics <file.json>   Write per-stage and per-file timings, allocations and element counts");
+                Console.WriteLine("  --parse-cache <dir>     Keep parse results in <dir> and load unchanged inputs from it instead of parsing them");
+                Console.WriteLine("  --batch <job_file>      Run the jobs in <job_file> in one process, one \"<source_directory> [files] [output_directory]\" per line");
+                Console.WriteLine("  --max-concurrent-jobs <n>  Maximum number of batch jobs converted at the same time (default: processor count)");
+                Console.WriteLine("  --memory-budget <MB>    Convert groups of related files in batches that fit about <MB> megabytes instead of all at once");
+                Console.WriteLine("  --with-dependencies     With a file list, also parse the sources and headers the listed files need from the whole tree");
+                Console.WriteLine("  --file-time-budget <s>  Leave out and report any input file or header unit that takes longer than <s> seconds");
                 Console.WriteLine();
                 Console.WriteLine("Examples:");
                 Console.WriteLine("  CppToCsConverter C:\\Source\\CppProject");
                 Console.WriteLine("  CppToCsConverter C:\\Source\\CppProject C:\\Output\\CsProject");
                 Console.WriteLine("  CppToCsConverter C:\\Source\\CppProject filea.h,filea.cpp,fileb.cpp");
                 Console.WriteLine("  CppToCsConverter C:\\Source\\CppProject filea.h,filea.cpp,fileb.cpp C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --max-parallelism 4 C:\\Source\\CppProject C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --metrics metrics.json C:\\Source\\CppProject C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --parse-cache C:\\Cache\\CppProject C:\\Source\\CppProject C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --batch components.txt --max-concurrent-jobs 4");
+                Console.WriteLine("  CppToCsConverter --memory-budget 512 C:\\Source\\CppProject C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --with-dependencies C:\\Source\\CppProject filea.h C:\\Output\\CsProject");
+                Console.WriteLine("  CppToCsConverter --file-time-budget 30 C:\\Source\\CppProject C:\\Output\\CsProject");
                 return;
             }
 
-            string sourceDirectory = args[0];
-            string[]? specificFiles = null;
-            string outputDirectory;
-
-            // Parse arguments based on their structure
-            if (args.Length == 2)
-            {
-                // Could be: <source> <output> OR <source> <files>
-                if (args[1].Contains(",") || args[1].EndsWith(".h") || args[1].EndsWith(".cpp"))
-                {
-                    // It's a file list
-                    specificFiles = args[1].Split(',', StringSplitOptions.RemoveEmptyEntries)
-                                          .Select(f => f.Trim())
-                                          .ToArray();
-                    outputDirectory = Path.Combine(sourceDirectory, "Generated_CS");
-                }
-                else
-                {
-                    // It's an output directory
-                    outputDirectory = args[1];
-                }
-            }
-            else if (args.Length == 3)
-            {
-                // <source> <files> <output>
-                specificFiles = args[1].Split(',', StringSplitOptions.RemoveEmptyEntries)
-                                      .Select(f => f.Trim())
-                                      .ToArray();
-                outputDirectory = args[2];
-            }
-            else
-            {
-                // Default: <source>
-                outputDirectory = Path.Combine(sourceDirectory, "Generated_CS");
-            }
+            var job = ConversionJob.Parse(args);
+            string sourceDirectory = job.SourceDirectory;
+            string[]? specificFiles = job.Files;
+            string outputDirectory = job.OutputDirectory;
 
             if (!Directory.Exists(sourceDirectory))
             {
@@ -71,25 +189,150 @@ namespace CppToCsConverter
 
             try
             {
-                var converter = new CppToCsConverterApi();
-                
+                var converter = new CppToCsConverterApi(new ConsoleLogger(verbosity));
+                if (maxParallelism.HasValue)
+                {
+                    converter.MaxDegreeOfParallelism = maxParallelism.Value;
+                }
+                converter.Incremental = incremental;
+                converter.ParseCacheDirectory = parseCacheDirectory;
+                converter.MemoryBudgetBytes = memoryBudgetBytes;
+                converter.ResolveDependencies = withDependencies;
+                converter.FileTimeBudget = fileTimeBudget;
+
+                if (watch)
+                {
+                    if (specificFiles != null)
+                    {
+                        Console.WriteLine("Error: --watch converts a whole source directory and cannot be combined with a file list.");
+                        return;
+                    }
+                    WatchDirectory(converter, sourceDirectory, outputDirectory, metricsPath);
+                    return;
+                }
+
+                // Ctrl+C stops the conversion at the next file instead of killing the process mid-write
+                using var cancellation = new CancellationTokenSource();
+                Console.CancelKeyPress += (sender, e) =>
+                {
+                    e.Cancel = true;
+                    cancellation.Cancel();
+                };
+
                 if (specificFiles != null && specificFiles.Length > 0)
                 {
-                    converter.ConvertSpecificFiles(sourceDirectory, specificFiles, outputDirectory);
+                    converter.ConvertSpecificFilesAsync(sourceDirectory, specificFiles, outputDirectory, cancellationToken: cancellation.Token).GetAwaiter().GetResult();
                 }
                 else
                 {
-                    converter.ConvertDirectory(sourceDirectory, outputDirectory);
+                    converter.ConvertDirectoryAsync(sourceDirectory, outputDirectory, cancellationToken: cancellation.Token).GetAwaiter().GetResult();
+                }
+
+                if (metricsPath != null && converter.LastMetrics != null)
+                {
+                    converter.LastMetrics.Save(metricsPath);
+                    Console.WriteLine($"Metrics written to: {metricsPath}");
                 }
                 
-                Console.WriteLine($"Conversion completed successfully!");
+                var quarantined = converter.LastMetrics?.Quarantined ?? new List<QuarantineEntry>();
+                if (quarantined.Count > 0)
+                {
+                    Console.WriteLine($"Conversion completed with {quarantined.Count} file(s) left out for exceeding the file time budget:");
+                    foreach (var entry in quarantined)
+                    {
+                        Console.WriteLine($"  {entry.Stage}: {entry.Name}");
+                    }
+                    Environment.ExitCode = 1;
+                }
+                else
+                {
+                    Console.WriteLine($"Conversion completed successfully!");
+                }
                 Console.WriteLine($"Output directory: {outputDirectory}");
             }
+            catch (OperationCanceledException)
+            {
+                Console.WriteLine("Conversion cancelled.");
+                Environment.ExitCode = 1;
+            }
             catch (Exception ex)
             {
                 Console.WriteLine($"Error during conversion: {ex.Message}");
                 Console.WriteLine($"Stack trace: {ex.StackTrace}");
             }
         }
+
+        private static void RunBatch(string batchFile, int? maxConcurrentJobs, int? maxParallelism, bool incremental, string? parseCacheDirectory, long? memoryBudgetBytes, bool withDependencies, TimeSpan? fileTimeBudget, LogVerbosity verbosity, string? metricsPath)
+        {
+            List<ConversionJob> jobs;
+            try
+            {
+                jobs = ConversionJob.LoadJobFile(batchFile);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException || ex is FormatException)
+            {
+                Console.WriteLine($"Error: Cannot read job file: {ex.Message}");
+                Environment.ExitCode = 1;
+                return;
+            }
+
+            var converter = new CppToCsConverterApi(new ConsoleLogger(verbosity));
+            if (maxParallelism.HasValue)
+            {
+                converter.MaxDegreeOfParallelism = maxParallelism.Value;
+            }
+            converter.Incremental = incremental;
+            converter.ParseCacheDirectory = parseCacheDirectory;
+            converter.MemoryBudgetBytes = memoryBudgetBytes;
+            converter.ResolveDependencies = withDependencies;
+            converter.FileTimeBudget = fileTimeBudget;
+
+            Console.WriteLine($"Running {jobs.Count} conversion jobs from {batchFile}");
+            var results = converter.ConvertBatch(jobs, maxConcurrentJobs);
+
+            for (int i = 0; i < results.Count; i++)
+            {
+                var result = results[i];
+                Console.WriteLine(result.Succeeded
+                    ? $"  {result.Job}: converted to {result.Job.OutputDirectory}"
+                    : $"  {result.Job}: FAILED - {result.Error!.Message}");
+
+                // One metrics file per job: metrics.json becomes metrics.1.json, metrics.2.json, ...
+                if (metricsPath != null && result.Metrics != null)
+                {
+                    var jobMetricsPath = Path.Combine(Path.GetDirectoryName(metricsPath) ?? string.Empty,
+                        $"{Path.GetFileNameWithoutExtension(metricsPath)}.{i + 1}{Path.GetExtension(metricsPath)}");
+                    result.Metrics.Save(jobMetricsPath);
+                }
+            }
+
+            var failed = results.Count(r => !r.Succeeded);
+            Console.WriteLine($"Batch completed: {results.Count - failed} succeeded, {failed} failed");
+            if (failed > 0)
+            {
+                Environment.ExitCode = 1;
+            }
+        }
+
+        private static void WatchDirectory(CppToCsConverterApi converter, string sourceDirectory, string outputDirectory, string? metricsPath)
+        {
+            using var stopped = new ManualResetEventSlim();
+            Console.CancelKeyPress += (sender, e) =>
+            {
+                e.Cancel = true;
+                stopped.Set();
+            };
+
+            using var watcher = converter.WatchDirectory(sourceDirectory, outputDirectory);
+            if (metricsPath != null)
+            {
+                converter.LastMetrics?.Save(metricsPath);
+                watcher.Converted += (sender, metrics) => metrics.Save(metricsPath);
+            }
+
+            Console.WriteLine($"Output directory: {outputDirectory}");
+            Console.WriteLine("Press Ctrl+C to stop watching.");
+            stopped.Wait();
+        }
     }
 }
\ No newline at end of file